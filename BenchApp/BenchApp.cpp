@@ -0,0 +1,384 @@
+//
+//  This is a simple benchmark application for the generated lookup code. The
+//  build runs BenchGen to write out Bench.cqenum, which has synthetic enums of
+//  various sizes (10 to 10K values, dense, sparse and bitmap), then runs CQEnum
+//  on that to generate Bench.hpp and Bench.cpp, which we include.
+//
+//  For each enum we time the name, alt value, validity and text lookups, with
+//  a few hit/miss mixes, on one thread and on all of the available ones. The
+//  results are written to stdout as JSON, so that they can be compared from
+//  one version of the generator to the next. Optionally the minimum time to
+//  run each test, in milliseconds, can be passed.
+//
+//  Everything goes through the generated EnumTraits<> specializations, so it
+//  is all done with one template, and it calls the same functions that user
+//  code would.
+//
+//  The text translators throw on an invalid value, so they are only timed with
+//  all hits. Throwing is not something anyone should be doing in a loop.
+//
+//  The bulk alt value translations do a batch of c_uBulkCount values per op, so
+//  their times are per batch, not per value.
+//
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+#include "Bench.hpp"
+
+using namespace CQSL::Bench;
+using namespace CQSL::CQEnum;
+
+
+namespace
+{
+    // The number of inputs in each test list, a power of two so we can mask
+    constexpr uint32_t c_uInputCount = 4096;
+
+    // The number of values per op for the bulk translations
+    constexpr uint32_t c_uBulkCount = 64;
+
+    // The hit percentages we test at
+    constexpr uint32_t c_auHitPcts[] = { 100, 90, 50, 0 };
+
+    // The results of a single test, one per line of the JSON output
+    struct BenchResult
+    {
+        const char*     pszEnum;
+        const char*     pszKind;
+        uint32_t        uValues;
+        const char*     pszOp;
+        uint32_t        uThreads;
+        uint32_t        uHitPct;
+        uint64_t        uOps;
+        double          dNsPerOp;
+        double          dOpsPerSec;
+    };
+
+    std::vector<BenchResult>    vResults;
+    std::chrono::milliseconds   msMinTime(100);
+    std::vector<uint32_t>       vThreadCounts;
+
+
+    //
+    //  Run the passed op on the passed number of threads, each doing the passed
+    //  number of ops. Return the elapsed time in nanoseconds. The op returns a
+    //  bool for hit/miss, which we count so that the calls can't be optimized
+    //  away.
+    //
+    template <typename T>
+    double dRunOp(const uint32_t uThreads, const uint64_t uOpsPer, const T& fnOp)
+    {
+        std::atomic<uint32_t> uReady(0);
+        std::atomic<bool> bGo(false);
+        std::atomic<uint64_t> uHits(0);
+
+        std::vector<std::thread> vThreads;
+        for (uint32_t uIndex = 0; uIndex < uThreads; uIndex++)
+        {
+            vThreads.emplace_back
+            (
+                [&, uIndex]()
+                {
+                    uReady++;
+                    while (!bGo)
+                    {
+                        std::this_thread::yield();
+                    }
+
+                    // Start each thread at a different spot in the inputs
+                    uint64_t uCurHits = 0;
+                    uint32_t uAt = uIndex * 61;
+                    for (uint64_t uOp = 0; uOp < uOpsPer; uOp++)
+                    {
+                        if (fnOp(uAt & (c_uInputCount - 1)))
+                        {
+                            uCurHits++;
+                        }
+                        uAt++;
+                    }
+                    uHits += uCurHits;
+                }
+            );
+        }
+
+        while (uReady < uThreads)
+        {
+            std::this_thread::yield();
+        }
+
+        const auto tmStart = std::chrono::steady_clock::now();
+        bGo = true;
+        for (std::thread& thrCur : vThreads)
+        {
+            thrCur.join();
+        }
+        const auto tmEnd = std::chrono::steady_clock::now();
+
+        // Something to keep the hit counts alive
+        if (uHits == ~uint64_t(0))
+        {
+            std::cerr << "Impossible hit count" << std::endl;
+        }
+
+        return static_cast<double>
+        (
+            std::chrono::duration_cast<std::chrono::nanoseconds>(tmEnd - tmStart).count()
+        );
+    }
+
+
+    //
+    //  Time one op. We figure out on one thread how many ops it takes to run for
+    //  the minimum time, then do that number per thread for each thread count.
+    //
+    template <typename T>
+    void TimeOp(const   char* const pszEnum
+                , const char* const pszKind
+                , const uint32_t    uValues
+                , const char* const pszOp
+                , const uint32_t    uHitPct
+                , const T&          fnOp)
+    {
+        // Start small, since some of the lookups on the big enums are slow
+        uint64_t uOpsPer = 16;
+        const double dMinNs = static_cast<double>
+        (
+            std::chrono::duration_cast<std::chrono::nanoseconds>(msMinTime).count()
+        );
+        while (true)
+        {
+            const double dNs = dRunOp(1, uOpsPer, fnOp);
+            if (dNs >= dMinNs)
+            {
+                break;
+            }
+
+            // Scale up towards the min time, but at least double it
+            uOpsPer = (dNs > 0) ? static_cast<uint64_t>(uOpsPer * (dMinNs / dNs) * 1.1) : uOpsPer * 2;
+        }
+
+        for (const uint32_t uThreads : vThreadCounts)
+        {
+            const double dNs = dRunOp(uThreads, uOpsPer, fnOp);
+            const uint64_t uTotalOps = uOpsPer * uThreads;
+
+            //
+            //  The ns per op is from the view of a single thread, so it's the time
+            //  each op took. The throughput is for all of them together.
+            //
+            vResults.push_back
+            (
+                BenchResult
+                {
+                    pszEnum
+                    , pszKind
+                    , uValues
+                    , pszOp
+                    , uThreads
+                    , uHitPct
+                    , uTotalOps
+                    , (dNs * uThreads) / static_cast<double>(uTotalOps)
+                    , static_cast<double>(uTotalOps) / (dNs / 1e9)
+                }
+            );
+        }
+    }
+
+
+    //
+    //  Build up the input lists for an enum and time all of its lookups. The hit
+    //  inputs are picked randomly from the values, and the misses are things that
+    //  are close, names with extra characters on the end and values that are in
+    //  between or just outside the valid ones.
+    //
+    template <typename E>
+    void BenchEnum(const char* const pszEnum, const char* const pszKind)
+    {
+        using Traits = EnumTraits<E>;
+        using UnderType = typename Traits::UnderType;
+
+        const uint32_t uCount = Traits::c_uCount;
+        const E* const paeValues = EnumValueList<E>::s_aeValues;
+
+        std::unordered_set<int64_t> setValues;
+        std::unordered_set<int32_t> setAltVals;
+        for (uint32_t uIndex = 0; uIndex < uCount; uIndex++)
+        {
+            setValues.insert(static_cast<int64_t>(paeValues[uIndex]));
+
+            int32_t iAltVal = 0;
+            if (Traits::pfnToAltVal(paeValues[uIndex], iAltVal))
+            {
+                setAltVals.insert(iAltVal);
+            }
+        }
+
+        // Use a fixed seed so every run tests the same inputs
+        std::mt19937 randGen(uCount);
+        std::uniform_int_distribution<uint32_t> randIndex(0, uCount - 1);
+        std::uniform_int_distribution<uint32_t> randPct(0, 99);
+
+        // Get a random value that is not valid
+        const int64_t iRange = static_cast<int64_t>(paeValues[uCount - 1]) + uCount + 16;
+        auto fnBadValue = [&]() -> E
+        {
+            std::uniform_int_distribution<int64_t> randVal(0, iRange);
+            while (true)
+            {
+                const int64_t iVal = randVal(randGen);
+                if (!setValues.count(iVal))
+                {
+                    return static_cast<E>(static_cast<UnderType>(iVal));
+                }
+            }
+        };
+
+        auto fnBadAltVal = [&]() -> int32_t
+        {
+            std::uniform_int_distribution<int32_t> randVal(0, 200000);
+            while (true)
+            {
+                const int32_t iVal = randVal(randGen);
+                if (!setAltVals.count(iVal))
+                {
+                    return iVal;
+                }
+            }
+        };
+
+        std::vector<std::wstring> vNames(c_uInputCount);
+        std::vector<E> vValues(c_uInputCount);
+        std::vector<int32_t> vAltVals(c_uInputCount);
+        for (const uint32_t uHitPct : c_auHitPcts)
+        {
+            for (uint32_t uIndex = 0; uIndex < c_uInputCount; uIndex++)
+            {
+                const E eHit = paeValues[randIndex(randGen)];
+                if (randPct(randGen) < uHitPct)
+                {
+                    vNames[uIndex] = Traits::pfnToName(eHit);
+                    vValues[uIndex] = eHit;
+                    Traits::pfnToAltVal(eHit, vAltVals[uIndex]);
+                }
+                else
+                {
+                    vNames[uIndex] = Traits::pfnToName(eHit);
+                    vNames[uIndex].append(L"Zz");
+                    vValues[uIndex] = fnBadValue();
+                    vAltVals[uIndex] = fnBadAltVal();
+                }
+            }
+
+            TimeOp
+            (
+                pszEnum, pszKind, uCount, "bNameToEnum", uHitPct
+                , [&](const uint32_t uAt) { E eRes; return Traits::pfnFromName(vNames[uAt], eRes); }
+            );
+            TimeOp
+            (
+                pszEnum, pszKind, uCount, "pszEnumToName", uHitPct
+                , [&](const uint32_t uAt) { return Traits::pfnToName(vValues[uAt]) != nullptr; }
+            );
+            TimeOp
+            (
+                pszEnum, pszKind, uCount, "bEnumFromAltValue", uHitPct
+                , [&](const uint32_t uAt) { E eRes; return Traits::pfnFromAltVal(vAltVals[uAt], eRes); }
+            );
+            TimeOp
+            (
+                pszEnum, pszKind, uCount, "bIsValidEnumVal", uHitPct
+                , [&](const uint32_t uAt) { return Traits::pfnIsValid(vValues[uAt]); }
+            );
+
+            // Each thread needs its own output buffers
+            TimeOp
+            (
+                pszEnum, pszKind, uCount, "EnumsToAltValues64", uHitPct
+                , [&](const uint32_t uAt)
+                  {
+                      thread_local int32_t aiOut[c_uBulkCount];
+                      uint64_t uInvalid = 0;
+                      return Traits::pfnToAltVals
+                      (
+                          &vValues[uAt & ~(c_uBulkCount - 1)], c_uBulkCount, aiOut, &uInvalid
+                      ) == 0;
+                  }
+            );
+            TimeOp
+            (
+                pszEnum, pszKind, uCount, "AltValuesToEnums64", uHitPct
+                , [&](const uint32_t uAt)
+                  {
+                      thread_local E aeOut[c_uBulkCount];
+                      uint64_t uInvalid = 0;
+                      return Traits::pfnFromAltVals
+                      (
+                          &vAltVals[uAt & ~(c_uBulkCount - 1)], c_uBulkCount, aeOut, &uInvalid
+                      ) == 0;
+                  }
+            );
+
+            if (uHitPct == 100)
+            {
+                TimeOp
+                (
+                    pszEnum, pszKind, uCount, "pszEnumToAltText1", uHitPct
+                    , [&](const uint32_t uAt) { return Traits::pfnToText1(vValues[uAt]) != nullptr; }
+                );
+            }
+        }
+    }
+}
+
+
+int main(int iArgs, char* apszArgs[])
+{
+    if (iArgs > 1)
+    {
+        msMinTime = std::chrono::milliseconds(std::stoul(apszArgs[1]));
+    }
+
+    vThreadCounts.push_back(1);
+    const uint32_t uMaxThreads = std::thread::hardware_concurrency();
+    if (uMaxThreads > 1)
+    {
+        vThreadCounts.push_back(uMaxThreads);
+    }
+
+    BenchEnum<Dense10>("Dense10", "Dense");
+    BenchEnum<Dense100>("Dense100", "Dense");
+    BenchEnum<Dense1000>("Dense1000", "Dense");
+    BenchEnum<Dense10000>("Dense10000", "Dense");
+    BenchEnum<Sparse10>("Sparse10", "Sparse");
+    BenchEnum<Sparse100>("Sparse100", "Sparse");
+    BenchEnum<Sparse1000>("Sparse1000", "Sparse");
+    BenchEnum<Sparse10000>("Sparse10000", "Sparse");
+    BenchEnum<Bitmap10>("Bitmap10", "Bitmap");
+    BenchEnum<Bitmap31>("Bitmap31", "Bitmap");
+
+    std::cout << "{\n    \"results\" :\n    [\n";
+    for (size_t szIndex = 0; szIndex < vResults.size(); szIndex++)
+    {
+        const BenchResult& resCur = vResults[szIndex];
+        std::cout   << ((szIndex == 0) ? "          " : "        , ")
+                    << "{ \"enum\" : \"" << resCur.pszEnum
+                    << "\", \"kind\" : \"" << resCur.pszKind
+                    << "\", \"values\" : " << resCur.uValues
+                    << ", \"op\" : \"" << resCur.pszOp
+                    << "\", \"threads\" : " << resCur.uThreads
+                    << ", \"hit_pct\" : " << resCur.uHitPct
+                    << ", \"ops\" : " << resCur.uOps
+                    << ", \"ns_per_op\" : " << resCur.dNsPerOp
+                    << ", \"ops_per_sec\" : " << resCur.dOpsPerSec
+                    << " }\n";
+    }
+    std::cout << "    ]\n}" << std::endl;
+
+    return 0;
+}
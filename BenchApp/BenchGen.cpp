@@ -0,0 +1,134 @@
+//
+//  This is a small helper program for the benchmark application. It writes out
+//  a synthetic .cqenum file with enums of various sizes and types, which the
+//  benchmark build then runs CQEnum on, the same as the test app does with its
+//  hand written file. We don't want to check in 10K value definitions, and it
+//  lets the sizes be adjusted easily.
+//
+//  For each size class we generate a dense (Standard) enum and a sparse
+//  (Arbitrary) one, whose ordinals are spread out with gaps. Bitmaps can only
+//  have as many values as the underlying type has bits, so they only get the
+//  size classes that fit.
+//
+//  Every value gets a Text1 value and an alt value, so that all of the lookup
+//  paths are generated. The alt values are spread out as well, so that there
+//  are misses between them.
+//
+//  We only write the file if the content changed, since CQEnum regenerates its
+//  output when the source is newer, and that would force a rebuild every time.
+//
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+
+// The size classes we generate dense and sparse enums for
+static constexpr uint32_t c_auSizes[] = { 10, 100, 1000, 10000 };
+
+// And the bitmap ones, which are limited by the 32 bit underlying type
+static constexpr uint32_t c_auBmpSizes[] = { 10, 31 };
+
+
+static void WriteEnum(          std::ostream&   strmTar
+                        , const char* const     pszKind
+                        , const uint32_t        uCount)
+{
+    const std::string strKind(pszKind);
+    const bool bBitmap = (strKind == "Bitmap");
+    const bool bSparse = (strKind == "Sparse");
+
+    strmTar << "    Enum=" << strKind << uCount << "\n";
+    if (bBitmap)
+    {
+        strmTar << "        Type=Bitmap\n"
+                << "        UnderType=unsigned int\n";
+    }
+    else if (bSparse)
+    {
+        strmTar << "        Type=Arbitrary\n";
+    }
+    else
+    {
+        strmTar << "        Type=Standard\n";
+    }
+    strmTar << "        Flags=Text1 AltVal\n\n";
+
+    for (uint32_t uIndex = 0; uIndex < uCount; uIndex++)
+    {
+        strmTar << "        Val=" << strKind << "Item" << uIndex << "\n"
+                << "            Text1=\"The text for " << strKind << " item " << uIndex << "\"\n";
+
+        if (bBitmap)
+        {
+            strmTar << "            Ordinal=0x" << std::hex << (1UL << uIndex) << std::dec << "\n";
+        }
+        else if (bSparse)
+        {
+            // Leave gaps of varying size, so that it's not just a fixed stride
+            strmTar << "            Ordinal=" << ((uIndex * 7) + (uIndex % 3) + 1) << "\n";
+        }
+
+        strmTar << "            AltVal=" << (100000 + (uIndex * 3)) << "\n"
+                << "        EndVal\n";
+    }
+    strmTar << "    EndEnum\n\n";
+}
+
+
+int main(int iArgs, char* apszArgs[])
+{
+    if (iArgs != 2)
+    {
+        std::cout << "\nBenchGen tarfile\n\n    You must provide the target .cqenum file" << std::endl;
+        return 1;
+    }
+
+    std::stringstream strmOut;
+    strmOut << ";\n"
+            << "; This file is generated by BenchGen, do not edit it\n"
+            << ";\n"
+            << "File=\n"
+            << "    Version=1\n"
+            << "    Namespaces=CQSL Bench\n"
+            << "EndFile\n\n"
+            << "Enums=\n\n";
+
+    for (const uint32_t uSize : c_auSizes)
+    {
+        WriteEnum(strmOut, "Dense", uSize);
+        WriteEnum(strmOut, "Sparse", uSize);
+    }
+
+    for (const uint32_t uSize : c_auBmpSizes)
+    {
+        WriteEnum(strmOut, "Bitmap", uSize);
+    }
+
+    strmOut << "EndEnums\n\n";
+
+    // If it's already the same, leave it alone
+    const std::string strNew = strmOut.str();
+    {
+        std::ifstream strmOld(apszArgs[1], std::ios::binary);
+        if (strmOld)
+        {
+            std::stringstream strmCur;
+            strmCur << strmOld.rdbuf();
+            if (strmCur.str() == strNew)
+            {
+                return 0;
+            }
+        }
+    }
+
+    std::ofstream strmTar(apszArgs[1], std::ios::binary | std::ios::trunc);
+    if (!strmTar)
+    {
+        std::cout << "\nBenchGen could not create the target file" << std::endl;
+        return 1;
+    }
+    strmTar << strNew;
+    return strmTar ? 0 : 1;
+}
@@ -7,7 +7,9 @@
 //
 //  The output generator (who knows what the output files are for his 
 //  particular language) will tell us if we need to actually do any output
-//  or not. So we actually have to create that first before we parse.
+//  or not. The source file can name other files (table data, a previous
+//  version) that the output also depends on, so we parse first and then ask
+//  it, based on the newest of those files.
 //
 #include "CQEnum_Pch.hpp"
 #include "CQEnum.hpp"
@@ -76,22 +78,31 @@ int main(int iArgs, char* apszArgs[])
         std::filesystem::path pathSrc(strSrcFile);
         std::filesystem::path pathBaseName = pathSrc.stem();
 
+        // Open the source and parse into an info object
+        CQEnum::InputSrc srcData;
+        srcData.Open(strSrcFile);
+        CQEnum::CQEnumInfo cqeiData;
+        cqeiData.ParseFrom(srcData);
+
         //
-        //  Seems a bit backwards, but only the output generator can check if the
-        //  output is out of date wrt to the source file. So we create it first 
-        //  and ask it if we need to do anything.
+        //  The output is out of date if it's older than the source or any of the
+        //  files the source pulled in, so find the newest of them.
         //
-        std::filesystem::file_time_type tmSrc = std::filesystem::last_write_time(strTarDir);
+        std::filesystem::file_time_type tmSrc = std::filesystem::last_write_time(pathSrc);
+        for (const std::filesystem::path& pathDep : cqeiData.m_vDepFiles)
+        {
+            const std::filesystem::file_time_type tmDep = std::filesystem::last_write_time(pathDep);
+            if (tmDep > tmSrc)
+            {
+                tmSrc = tmDep;
+            }
+        }
+
+        // Only the output generator knows what files it creates, so ask it
         CQEnum::CQEnumCppOutput gceoFmt;
         if (gceoFmt.bMustGenerate(strTarDir, pathBaseName.string(), tmSrc))
         {
-            // He says do it, so open the source and parse into an info object
-            CQEnum::InputSrc srcData;
-            srcData.Open(strSrcFile);
-            CQEnum::CQEnumInfo cqeiData;
-            cqeiData.ParseFrom(srcData);
-
-            // Ask the output generator to spit out the info appropriately
+            // He says do it, so ask him to spit out the info appropriately
             gceoFmt.GenerateOutput(cqeiData, strTarDir, pathBaseName.string());
         }
     }
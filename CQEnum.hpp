@@ -7,5 +7,6 @@
 #include "CQEnum_InputSrc.hpp"
 #include "CQEnum_Constants.hpp"
 #include "CQEnum_EnumInfo.hpp"
+#include "CQEnum_MapInfo.hpp"
 #include "CQEnum_DataDef.hpp"
 #include "CQEnum_OutputIntf.hpp"
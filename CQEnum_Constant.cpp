@@ -4,6 +4,207 @@
 
 namespace CQSL { namespace CQEnum {
 
+namespace
+{
+    //
+    //  Load the values of a table from a CSV file. The values are separated by
+    //  commas, white space or new lines, and we don't pass judgement on them, they
+    //  are output as is. Quoted values can contain separators, and lines starting
+    //  with # are comments.
+    //
+    void LoadCsvTable(          InputSrc&                   srcFile
+                        , const std::filesystem::path&      pathData
+                        ,       std::vector<std::string>&   vToFill)
+    {
+        std::ifstream strmData(pathData, std::ifstream::in | std::ifstream::binary);
+        if (!strmData)
+        {
+            srcFile.ThrowParseErr("The table data file could not be opened: " + pathData.string());
+        }
+        const std::string strData
+        (
+            (std::istreambuf_iterator<char>(strmData)), std::istreambuf_iterator<char>()
+        );
+
+        size_t szAt = 0;
+        while (szAt < strData.size())
+        {
+            const char chCur = strData[szAt];
+            if ((chCur == ',') || std::isspace(static_cast<unsigned char>(chCur)))
+            {
+                szAt++;
+            }
+            else if (chCur == '#')
+            {
+                while ((szAt < strData.size()) && (strData[szAt] != '\n'))
+                {
+                    szAt++;
+                }
+            }
+            else if (chCur == '"')
+            {
+                const size_t szStart = szAt++;
+                while ((szAt < strData.size()) && (strData[szAt] != '"'))
+                {
+                    szAt += (strData[szAt] == '\\') ? 2 : 1;
+                }
+                if (szAt >= strData.size())
+                {
+                    srcFile.ThrowParseErr("Unterminated quoted value in table data file");
+                }
+                szAt++;
+                vToFill.push_back(strData.substr(szStart, szAt - szStart));
+            }
+            else
+            {
+                const size_t szStart = szAt;
+                while ((szAt < strData.size())
+                &&     (strData[szAt] != ',')
+                &&     !std::isspace(static_cast<unsigned char>(strData[szAt])))
+                {
+                    szAt++;
+                }
+                vToFill.push_back(strData.substr(szStart, szAt - szStart));
+            }
+        }
+    }
+
+
+    //
+    //  Load the values of a table from a binary file, which must be a packed array
+    //  of little endian values of the element type. Only fixed size integral types,
+    //  float and double are supported, since we have to know the size and format.
+    //
+    template <typename T> void FormatBinValues(         InputSrc&                   srcFile
+                                                , const std::string&                strData
+                                                ,       std::vector<std::string>&   vToFill)
+    {
+        if (strData.size() % sizeof(T))
+        {
+            srcFile.ThrowParseErr("The table data file size is not a multiple of the element size");
+        }
+
+        std::ostringstream strmFmt;
+        for (size_t szAt = 0; szAt < strData.size(); szAt += sizeof(T))
+        {
+            using BitsType = std::conditional_t
+            <
+                sizeof(T) == 8, uint64_t, std::conditional_t<sizeof(T) == 4, uint32_t, uint16_t>
+            >;
+            BitsType uBits = 0;
+            for (size_t szByte = 0; szByte < sizeof(T); szByte++)
+            {
+                uBits |= static_cast<BitsType>(static_cast<unsigned char>(strData[szAt + szByte])) << (szByte * 8);
+            }
+
+            strmFmt.str("");
+            if constexpr (std::is_floating_point_v<T>)
+            {
+                T tVal;
+                std::memcpy(&tVal, &uBits, sizeof(T));
+                if (!std::isfinite(tVal))
+                {
+                    srcFile.ThrowParseErr("Table data files cannot contain infinite or NaN values");
+                }
+                strmFmt << std::hexfloat << tVal << (std::is_same_v<T, float> ? "F" : "");
+            }
+            else if constexpr (std::is_signed_v<T>)
+            {
+                // The most negative value can't be written as a literal
+                const T tVal = static_cast<T>(static_cast<std::make_unsigned_t<T>>(uBits));
+                if (tVal == std::numeric_limits<T>::min())
+                {
+                    strmFmt << "(" << (static_cast<int64_t>(tVal) + 1) << " - 1)";
+                }
+                else
+                {
+                    strmFmt << static_cast<int64_t>(tVal);
+                }
+            }
+            else
+            {
+                strmFmt << "0x" << std::hex << std::uppercase << static_cast<uint64_t>(uBits);
+            }
+            vToFill.push_back(strmFmt.str());
+        }
+    }
+
+    void LoadBinTable(          InputSrc&                   srcFile
+                        , const std::filesystem::path&      pathData
+                        , const std::string&                strType
+                        ,       std::vector<std::string>&   vToFill)
+    {
+        std::ifstream strmData(pathData, std::ifstream::in | std::ifstream::binary);
+        if (!strmData)
+        {
+            srcFile.ThrowParseErr("The table data file could not be opened: " + pathData.string());
+        }
+        const std::string strData
+        (
+            (std::istreambuf_iterator<char>(strmData)), std::istreambuf_iterator<char>()
+        );
+
+        const std::string_view svType
+        (
+            (strType.compare(0, 5, "std::") == 0) ? std::string_view(strType).substr(5) : std::string_view(strType)
+        );
+        if ((svType == "int8_t") || (svType == "uint8_t"))
+        {
+            // There's no 8 bit word to assemble, so do these directly
+            for (const char chCur : strData)
+            {
+                if (svType == "int8_t")
+                {
+                    vToFill.push_back(std::to_string(static_cast<int>(static_cast<int8_t>(chCur))));
+                }
+                else
+                {
+                    vToFill.push_back(std::to_string(static_cast<unsigned int>(static_cast<unsigned char>(chCur))));
+                }
+            }
+        }
+        else if (svType == "int16_t")
+        {
+            FormatBinValues<int16_t>(srcFile, strData, vToFill);
+        }
+        else if (svType == "uint16_t")
+        {
+            FormatBinValues<uint16_t>(srcFile, strData, vToFill);
+        }
+        else if (svType == "int32_t")
+        {
+            FormatBinValues<int32_t>(srcFile, strData, vToFill);
+        }
+        else if (svType == "uint32_t")
+        {
+            FormatBinValues<uint32_t>(srcFile, strData, vToFill);
+        }
+        else if (svType == "int64_t")
+        {
+            FormatBinValues<int64_t>(srcFile, strData, vToFill);
+        }
+        else if (svType == "uint64_t")
+        {
+            FormatBinValues<uint64_t>(srcFile, strData, vToFill);
+        }
+        else if (svType == "float")
+        {
+            FormatBinValues<float>(srcFile, strData, vToFill);
+        }
+        else if (svType == "double")
+        {
+            FormatBinValues<double>(srcFile, strData, vToFill);
+        }
+        else
+        {
+            srcFile.ThrowParseErr
+            (
+                "Binary tables must be of a fixed size integral type, float, or double"
+            );
+        }
+    }
+}
+
 
 void ConstInfoList::ParseFrom(InputSrc& srcFile)
 {
@@ -79,6 +280,55 @@ void ConstInfoList::ParseFrom(InputSrc& srcFile)
                 srcFile.ThrowParseErr(strErrMsg);
             }
         }
+        else if (strType == "Table")
+        {
+            cinfoNew.m_eType = EConstTypes::Table;
+            srcFile.CheckEqualSign();
+
+            //
+            //  Then we have name, element type, format, and the data file, which is
+            //  relative to the source file.
+            //
+            srcFile.GetCommaSepValues(vTokens);
+            if (vTokens.size() != 4)
+            {
+                srcFile.ThrowParseErr("A table definition is a comma separated name, type, format and file");
+            }
+
+            if (m_sNameDupCheck.find(vTokens.at(0)) != m_sNameDupCheck.end())
+            {
+                std::string strErrMsg("Constant name '");
+                strErrMsg.append(vTokens.at(0));
+                strErrMsg.append("' is already used");
+                srcFile.ThrowParseErr(strErrMsg);
+            }
+
+            cinfoNew.m_strName = std::move(vTokens.at(0));
+            cinfoNew.m_strType = std::move(vTokens.at(1));
+            cinfoNew.m_strValue = std::move(vTokens.at(3));
+
+            const std::filesystem::path pathData = srcFile.pathSrcRelative(cinfoNew.m_strValue);
+            if (vTokens.at(2) == "Csv")
+            {
+                LoadCsvTable(srcFile, pathData, cinfoNew.m_vTableVals);
+            }
+            else if (vTokens.at(2) == "Binary")
+            {
+                LoadBinTable(srcFile, pathData, cinfoNew.m_strType, cinfoNew.m_vTableVals);
+            }
+            else
+            {
+                srcFile.ThrowParseErr("The table format must be Csv or Binary");
+            }
+
+            if (cinfoNew.m_vTableVals.empty())
+            {
+                srcFile.ThrowParseErr("The table data file has no values");
+            }
+
+            m_sNameDupCheck.insert(cinfoNew.m_strName);
+            m_vConstList.push_back(std::move(cinfoNew));
+        }
         else
         {
             srcFile.ThrowParseErr(pszExpectedErr);
@@ -8,7 +8,7 @@
 
 namespace CQSL { namespace CQEnum {
 
-enum class EConstTypes { Const, ConstExpr, ExtConst, Count };
+enum class EConstTypes { Const, ConstExpr, ExtConst, Table, Count };
 
 class ConstInfo
 {
@@ -26,10 +26,14 @@ class ConstInfo
         //  name, the data type, and the value of the constant. This is all loaded
         //  from the file during parsing of course.
         //
-        EConstTypes     m_eType;
-        std::string     m_strName;
-        std::string     m_strType;
-        std::string     m_strValue;
+        //  For tables, the values are loaded from the data file named in the
+        //  definition, and stored ready to output as the elements of an array.
+        //
+        EConstTypes                 m_eType;
+        std::string                 m_strName;
+        std::string                 m_strType;
+        std::string                 m_strValue;
+        std::vector<std::string>    m_vTableVals;
 };
 
 
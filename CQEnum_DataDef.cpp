@@ -28,6 +28,65 @@ void CQEnumInfo::ParseFrom(InputSrc& srcFile)
         m_strExportMacro.push_back(' ');
     }
 
+    //
+    //  We can have a list of headers to include, which must be either quoted or in
+    //  angle brackets, as they would be in an include statement.
+    //
+    m_vIncludes.clear();
+    if (srcFile.bCheckNextId("Includes", "Expected to see Includes= here", true, false))
+    {
+        srcFile.GetSpacedValues(m_vIncludes);
+        for (const std::string& strCur : m_vIncludes)
+        {
+            if ((strCur.size() < 3)
+            ||  !(((strCur.front() == '"') && (strCur.back() == '"'))
+            ||    ((strCur.front() == '<') && (strCur.back() == '>'))))
+            {
+                std::string strErrMsg("Include '");
+                strErrMsg.append(strCur);
+                strErrMsg.append("' must be quoted or in angle brackets");
+                srcFile.ThrowParseErr(strErrMsg);
+            }
+        }
+    }
+
+    //
+    //  We can have a previous version of this file, whose enums we generate remap
+    //  tables from. It's relative to this file.
+    //
+    m_vPrevEnums.clear();
+    m_vDepFiles.clear();
+    if (srcFile.bCheckNextId("PrevVersion", "Expected to see PrevVersion= here", true, false))
+    {
+        const std::string strPrev = srcFile.strGetToken("Expected the quoted previous version file");
+        if (!m_bIsPrevVersion)
+        {
+            const std::filesystem::path pathPrev = srcFile.pathSrcRelative(strPrev);
+            CQEnumInfo cqeiPrev;
+            cqeiPrev.m_bIsPrevVersion = true;
+            try
+            {
+                InputSrc srcPrev;
+                srcPrev.Open(pathPrev.string());
+                cqeiPrev.ParseFrom(srcPrev);
+            }
+
+            catch(const std::exception& except)
+            {
+                std::string strErrMsg("In previous version file ");
+                strErrMsg.append(strPrev);
+                strErrMsg.append(": ");
+                strErrMsg.append(except.what());
+                srcFile.ThrowParseErr(strErrMsg);
+            }
+            m_vPrevEnums = std::move(cqeiPrev.m_listEnums.m_vEnumList);
+
+            // It and anything it read are dependencies of ours
+            m_vDepFiles.push_back(pathPrev);
+            m_vDepFiles.insert(m_vDepFiles.end(), cqeiPrev.m_vDepFiles.begin(), cqeiPrev.m_vDepFiles.end());
+        }
+    }
+
     // We have to see the end of the file block
     srcFile.CheckBlockEnd("File");
 
@@ -35,6 +94,15 @@ void CQEnumInfo::ParseFrom(InputSrc& srcFile)
     if (srcFile.bCheckNextId("Constants", "Expected Constants=, Enums=", true, false))
     {
         m_listConsts.ParseFrom(srcFile);
+
+        // Table constants were loaded from data files, which we depend on
+        for (const ConstInfo& cinfoCur : m_listConsts.m_vConstList)
+        {
+            if (cinfoCur.m_eType == EConstTypes::Table)
+            {
+                m_vDepFiles.push_back(srcFile.pathSrcRelative(cinfoCur.m_strValue));
+            }
+        }
     }
 
     // If we have an enums block, parse it
@@ -43,6 +111,12 @@ void CQEnumInfo::ParseFrom(InputSrc& srcFile)
         m_listEnums.ParseFrom(srcFile);
     }
 
+    // If we have a maps block, parse it. It refers to the enums so it has to be last
+    if (srcFile.bCheckNextId("Maps", "Expected Maps=", true, false))
+    {
+        m_listMaps.ParseFrom(srcFile, m_listEnums);
+    }
+
 
     //
     //  Pre-build up the namespace prefix for the user's defined namespaces. This is used
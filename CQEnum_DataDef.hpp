@@ -31,11 +31,20 @@ class CQEnumInfo
         // The list of enums
         EnumInfoList                m_listEnums;
 
+        // The list of enum to enum maps
+        MapInfoList                 m_listMaps;
+
         int32_t                     m_iVersion = 1;
 
         // They can provide us with an export keyword to use for DLL based enums
         std::string                 m_strExportMacro;
 
+        //
+        //  Any headers to include into the generated header, e.g. for payload types.
+        //  They include the quotes or angle brackets.
+        //
+        std::vector<std::string>    m_vIncludes;
+
         //
         //  We pre-build the namespace prefix for the defined namespaces, from
         //  the m_vNamespaces list below. This saves a lot of busy work when
@@ -45,6 +54,21 @@ class CQEnumInfo
 
         // A list of nested namespaces to put the content in
         std::vector<std::string>    m_vNamespaces;
+
+        //
+        //  If a PrevVersion= file was given, the enums parsed from it, which we
+        //  generate remap tables from. The flag is set on the info we parse that
+        //  file into, since we only go back one version.
+        //
+        bool                        m_bIsPrevVersion = false;
+        std::vector<EnumInfo>       m_vPrevEnums;
+
+        //
+        //  Any other files we read while parsing, i.e. Table= data files and the
+        //  PrevVersion= file. The output is out of date if any of them is newer
+        //  than it, not just the definition file.
+        //
+        std::vector<std::filesystem::path> m_vDepFiles;
 };
 
 }};
@@ -4,6 +4,26 @@
 
 namespace CQSL { namespace CQEnum {
 
+namespace
+{
+    //
+    //  Some value attributes are the rest of the line, without leading/trailing
+    //  space, which we don't pass judgement on.
+    //
+    void GetValueRemainder(InputSrc& srcFile, std::string& strToFill)
+    {
+        srcFile.GetLineRemainder(strToFill);
+        while (!strToFill.empty() && std::isspace(static_cast<unsigned char>(strToFill.back())))
+        {
+            strToFill.pop_back();
+        }
+        while (!strToFill.empty() && std::isspace(static_cast<unsigned char>(strToFill.front())))
+        {
+            strToFill.erase(0, 1);
+        }
+    }
+}
+
 
 //
 //  At this point the Val= part has been eaten. So we should see the value
@@ -15,11 +35,19 @@ void EnumValInfo::ParseFrom(        InputSrc&       srcFile
                             , const bool            bAltVal
                             , const bool            bText1
                             , const bool            bText2
-                            , const std::string&    strEnumName)
+                            , const std::string&    strEnumName
+                            , const std::vector<std::pair<std::string, std::string>>& vAttrs)
 {
     // We have to get the name of the enum
     srcFile.GetIdToken("Expected enumeration value name", m_strName);
 
+    // We may be getting reused, so clear out any previous attribute values
+    m_bStableId = false;
+    m_strPayload.clear();
+    m_vAttrVals.clear();
+    m_vAttrVals.resize(vAttrs.size());
+    std::vector<bool> vGotAttrs(vAttrs.size(), false);
+
     const std::string strEndBlock("EndVal");
     std::string strCurToken;
     std::string strCurValue;
@@ -67,6 +95,63 @@ void EnumValInfo::ParseFrom(        InputSrc&       srcFile
             bGotAltVal = true;
             m_iAltValue = srcFile.iGetSignedToken("Expected a numeric alternative value");
         }
+        else if (strCurToken == "StableId")
+        {
+            if (m_bStableId)
+            {
+                srcFile.ThrowParseErr("The stable id was already set for this value");
+            }
+
+            const int32_t iId = srcFile.iGetSignedToken("Expected a numeric stable id");
+            if (iId < 0)
+            {
+                srcFile.ThrowParseErr("Stable ids cannot be negative");
+            }
+            m_bStableId = true;
+            m_uStableId = static_cast<uint32_t>(iId);
+        }
+        else if (strCurToken == "Payload")
+        {
+            if (!m_strPayload.empty())
+            {
+                srcFile.ThrowParseErr("The payload type was already set for this value");
+            }
+
+            GetValueRemainder(srcFile, m_strPayload);
+            if (m_strPayload.empty())
+            {
+                srcFile.ThrowParseErr("Expected a payload type");
+            }
+        }
+        else
+        {
+            // It has to be one of the custom attributes
+            std::vector<std::pair<std::string, std::string>>::const_iterator itAttr = std::find_if
+            (
+                vAttrs.begin()
+                , vAttrs.end()
+                , [&strCurToken](const std::pair<std::string, std::string>& pairCur)
+                  { return pairCur.first == strCurToken; }
+            );
+            if (itAttr == vAttrs.end())
+            {
+                std::string strErrMsg("'");
+                strErrMsg.append(strCurToken);
+                strErrMsg.append("' is not a valid value attribute for enum ");
+                strErrMsg.append(strEnumName);
+                srcFile.ThrowParseErr(strErrMsg);
+            }
+
+            // The value is the rest of the line, as with constants
+            const size_t szIndex = static_cast<size_t>(itAttr - vAttrs.begin());
+            GetValueRemainder(srcFile, strCurValue);
+            if (strCurValue.empty())
+            {
+                srcFile.ThrowParseErr("Expected a value for the attribute");
+            }
+            m_vAttrVals[szIndex] = std::move(strCurValue);
+            vGotAttrs[szIndex] = true;
+        }
     }
 
     // Make sure we got what we we supposed to and nothing we weren't
@@ -110,6 +195,18 @@ void EnumValInfo::ParseFrom(        InputSrc&       srcFile
         strErrMsg.append(strEnumName);
         throw std::runtime_error(strErrMsg);
     }
+
+    for (size_t szIndex = 0; szIndex < vAttrs.size(); szIndex++)
+    {
+        if (!vGotAttrs[szIndex])
+        {
+            std::string strErrMsg("Missing attribute '");
+            strErrMsg.append(vAttrs[szIndex].first);
+            strErrMsg.append("' for enum ");
+            strErrMsg.append(strEnumName);
+            throw std::runtime_error(strErrMsg);
+        }
+    }
 }
 
 
@@ -121,7 +218,9 @@ void EnumValInfo::ParseFrom(        InputSrc&       srcFile
 void EnumInfo::ParseFrom(InputSrc& srcFile)
 {
     // Make sure we are at defaults
+    m_bAliases = false;
     m_bIsMonotonic = false;
+    m_bTransitions = false;
     m_bText1 = false;
     m_bText2 = false;
     m_bDoAltVal = false;
@@ -130,7 +229,10 @@ void EnumInfo::ParseFrom(InputSrc& srcFile)
     m_eType = EEnumTypes::Count;
     m_strName.clear();
     m_strUnderType = "int";
+    m_vAttrs.clear();
+    m_vGroups.clear();
     m_vSynonyms.clear();
+    m_vTransitions.clear();
     m_vValues.clear();
 
     // We have to get a name next
@@ -161,7 +263,8 @@ void EnumInfo::ParseFrom(InputSrc& srcFile)
         if ((strCurToken == "Type")
         ||  (strCurToken == "UnderType")
         ||  (strCurToken == "Flags")
-        ||  (strCurToken == "StreamText"))
+        ||  (strCurToken == "StreamText")
+        ||  (strCurToken == "Attr"))
         {
             // These have to come before any values
             if (!m_vValues.empty())
@@ -188,6 +291,11 @@ void EnumInfo::ParseFrom(InputSrc& srcFile)
                 {
                     m_eType = EEnumTypes::Bitmap;
                 }
+                else if (strCurValue == "FlagSet")
+                {
+                    m_eType = EEnumTypes::FlagSet;
+                    m_bIsMonotonic = true;
+                }
                 else if (strCurValue == "Standard")
                 {
                     m_eType = EEnumTypes::Standard;
@@ -196,8 +304,8 @@ void EnumInfo::ParseFrom(InputSrc& srcFile)
                 else
                 {
                     std::string strErrMsg("'");
-                    strErrMsg.append(strCurToken);
-                    strErrMsg.append("' is not a valid enumeration type (Arbitrary, Bitmap, or Standard)");
+                    strErrMsg.append(strCurValue);
+                    strErrMsg.append("' is not a valid enumeration type (Arbitrary, Bitmap, FlagSet, or Standard)");
                     srcFile.ThrowParseErr(strErrMsg);
                 }
             }
@@ -214,7 +322,11 @@ void EnumInfo::ParseFrom(InputSrc& srcFile)
                 srcFile.GetSpacedValues(vFlags);
                 for (const std::string& strFlag : vFlags)
                 {
-                    if (strFlag == "AltVal")
+                    if (strFlag == "Aliases")
+                    {
+                        m_bAliases = true;
+                    }
+                    else if (strFlag == "AltVal")
                     {
                         m_bDoAltVal = true;
                     }
@@ -234,11 +346,44 @@ void EnumInfo::ParseFrom(InputSrc& srcFile)
                     {
                         std::string strErrMsg("'");
                         strErrMsg.append(strFlag);
-                        strErrMsg.append("' is not a valid enumeration flag value (AltVal, Inc, Text1, Text2");
+                        strErrMsg.append("' is not a valid enumeration flag value (Aliases, AltVal, Inc, Text1, Text2)");
                         srcFile.ThrowParseErr(strErrMsg);
                     }
                 }
             }
+            else if (strCurToken == "Attr")
+            {
+                // We get a name and C++ type for a custom attribute column
+                std::vector<std::string> vAttrInfo;
+                srcFile.GetCommaSepValues(vAttrInfo);
+                if (vAttrInfo.size() != 2)
+                {
+                    srcFile.ThrowParseErr("An attribute definition is a comma separated name and type");
+                }
+
+                // The name can't be a built in value attribute or a previous one
+                const std::string& strAttrName = vAttrInfo.at(0);
+                if ((strAttrName == "Text1")
+                ||  (strAttrName == "Text2")
+                ||  (strAttrName == "Ordinal")
+                ||  (strAttrName == "AltVal")
+                ||  (strAttrName == "Payload")
+                ||  (strAttrName == "StableId")
+                ||  (strAttrName == strEndBlock)
+                ||  (std::find_if(m_vAttrs.begin()
+                                  , m_vAttrs.end()
+                                  , [&strAttrName](const AttrPair& pairCur)
+                                    { return pairCur.first == strAttrName; }) != m_vAttrs.end()))
+                {
+                    std::string strErrMsg("Attribute name '");
+                    strErrMsg.append(strAttrName);
+                    strErrMsg.append("' is already used in enum '");
+                    strErrMsg.append(m_strName);
+                    strErrMsg.append("'");
+                    srcFile.ThrowParseErr(strErrMsg);
+                }
+                m_vAttrs.emplace_back(std::move(vAttrInfo.at(0)), std::move(vAttrInfo.at(1)));
+            }
             else if (strCurToken == "StreamText")
             {
                 // We get a 1 or 2 to indicate first or second text
@@ -322,15 +467,123 @@ void EnumInfo::ParseFrom(InputSrc& srcFile)
                 m_vSynonyms.emplace_back(strCurToken, itVal->m_iOrdinal);
             }
         }
+        else if (strCurToken == "Group")
+        {
+            srcFile.CheckEqualSign();
+
+            // We should get a 'name : val, val, ...' line, start with the name
+            srcFile.GetIdToken("Expected group name after equal sign", strCurToken);
+            if (itFindGroup(strCurToken) != m_vGroups.end())
+            {
+                std::string strErrMsg("Group '");
+                strErrMsg.append(strCurToken);
+                strErrMsg.append("' is already defined in enum '");
+                strErrMsg.append(m_strName);
+                strErrMsg.append("'");
+                srcFile.ThrowParseErr(strErrMsg);
+            }
+            srcFile.CheckColon();
+
+            //
+            //  The members have to be regular values, which must already have been
+            //  defined. We store their indices.
+            //
+            std::vector<std::string> vMembers;
+            srcFile.GetCommaSepValues(vMembers);
+            if (vMembers.empty())
+            {
+                srcFile.ThrowParseErr("Expected one or more group member values");
+            }
+
+            GroupPair pairNew(strCurToken, std::vector<uint32_t>());
+            for (const std::string& strCur : vMembers)
+            {
+                const uint32_t uIndex = uFindValueIndex(srcFile, strCur, "group");
+                if (std::find(pairNew.second.begin(), pairNew.second.end(), uIndex) != pairNew.second.end())
+                {
+                    std::string strErrMsg("'");
+                    strErrMsg.append(strCur);
+                    strErrMsg.append("' is already a member of group '");
+                    strErrMsg.append(pairNew.first);
+                    strErrMsg.append("'");
+                    srcFile.ThrowParseErr(strErrMsg);
+                }
+                pairNew.second.push_back(uIndex);
+            }
+            m_vGroups.push_back(std::move(pairNew));
+        }
+        else if (strCurToken == "Transitions")
+        {
+            //
+            //  These reference values by name, so they have to come after the values,
+            //  and there can only be one block.
+            //
+            if (m_vValues.empty())
+            {
+                srcFile.ThrowParseErr("Transitions must be defined after the enumeration values");
+            }
+            if (m_bTransitions)
+            {
+                srcFile.ThrowParseErr("Transitions have already been defined for this enumeration");
+            }
+            srcFile.CheckEqualSign();
+            m_bTransitions = true;
+
+            //
+            //  We should see lines in the form 'fromval : toval, toval, ...' until
+            //  we get the end of the block.
+            //
+            std::vector<std::string> vToValues;
+            while (true)
+            {
+                srcFile.GetIdToken("Expected transition source value or EndTransitions", strCurToken);
+                if (strCurToken == "EndTransitions")
+                {
+                    break;
+                }
+
+                const uint32_t uFrom = uFindValueIndex(srcFile, strCurToken, "transitions");
+                srcFile.CheckColon();
+                srcFile.GetCommaSepValues(vToValues);
+                if (vToValues.empty())
+                {
+                    srcFile.ThrowParseErr("Expected one or more transition target values");
+                }
+
+                for (const std::string& strCur : vToValues)
+                {
+                    const TransPair pairNew(uFrom, uFindValueIndex(srcFile, strCur, "transitions"));
+                    if (std::find(m_vTransitions.begin(), m_vTransitions.end(), pairNew) != m_vTransitions.end())
+                    {
+                        std::string strErrMsg("The transition ");
+                        strErrMsg.append(m_vValues[uFrom].m_strName);
+                        strErrMsg.append(" -> ");
+                        strErrMsg.append(strCur);
+                        strErrMsg.append(" was already defined");
+                        srcFile.ThrowParseErr(strErrMsg);
+                    }
+                    m_vTransitions.push_back(pairNew);
+                }
+            }
+        }
         else if (strCurToken == "Val")
         {
+            // The transitions would not see any values after them
+            if (m_bTransitions)
+            {
+                srcFile.ThrowParseErr("Enumeration values must be defined before transitions");
+            }
+
             srcFile.CheckEqualSign();
 
             //
             //  Let a value object parse itself out. We tell it if we must see an explicit
             //  ordinal based on our type.
             //
-            evaliNew.ParseFrom(srcFile, bExplicitOrdinal(), m_bDoAltVal, m_bText1, m_bText2, m_strName);
+            evaliNew.ParseFrom
+            (
+                srcFile, bExplicitOrdinal(), m_bDoAltVal, m_bText1, m_bText2, m_strName, m_vAttrs
+            );
 
             // It can't be the same as any existing value or synonym
             if ((itFindValue(evaliNew.m_strName) != m_vValues.end())
@@ -344,11 +597,43 @@ void EnumInfo::ParseFrom(InputSrc& srcFile)
                 srcFile.ThrowParseErr(strErrMsg);
             }
 
+            //
+            //  Stable ids are all or nothing, since they are used instead of the names
+            //  to match values with a previous version, and they must be unique.
+            //
+            if (!m_vValues.empty() && (evaliNew.m_bStableId != bHasStableIds()))
+            {
+                srcFile.ThrowParseErr("If any values have a StableId=, they all must");
+            }
+            if (evaliNew.m_bStableId)
+            {
+                const uint32_t uId = evaliNew.m_uStableId;
+                if (std::find_if
+                    (
+                        m_vValues.begin()
+                        , m_vValues.end()
+                        , [uId](const EnumValInfo& evaliCur) { return evaliCur.m_uStableId == uId; }
+                    ) != m_vValues.end())
+                {
+                    std::string strErrMsg("Stable id ");
+                    strErrMsg.append(std::to_string(uId));
+                    strErrMsg.append(" is already used in enum '");
+                    strErrMsg.append(m_strName);
+                    strErrMsg.append("'");
+                    srcFile.ThrowParseErr(strErrMsg);
+                }
+            }
+
             //
             //  If this type get an explicit ordinal, make sure that it is not
             //  already taken. They must be unique. And it must be greater than
             //  any so far (so they are in ascending order.)
             //
+            //
+            //  Otherwise they are numbered sequentially from zero. We do it here,
+            //  instead of after the fact, so that any synonyms that reference this
+            //  value get the correct ordinal.
+            //
             if (bExplicitOrdinal())
             {
                 if (!m_vValues.empty())
@@ -370,6 +655,10 @@ void EnumInfo::ParseFrom(InputSrc& srcFile)
                 }
                 iHighestVal = evaliNew.m_iOrdinal;
             }
+            else
+            {
+                evaliNew.m_iOrdinal = static_cast<int32_t>(m_vValues.size());
+            }
 
             m_vValues.push_back(std::move(evaliNew));
         }
@@ -383,6 +672,7 @@ void EnumInfo::ParseFrom(InputSrc& srcFile)
     if (m_eType == EEnumTypes::Count)
     {
         m_eType = EEnumTypes::Standard;
+        m_bIsMonotonic = true;
     }
 
     // If no values were defined, that's not valid
@@ -409,19 +699,6 @@ void EnumInfo::ParseFrom(InputSrc& srcFile)
     {
         srcFile.ThrowParseErr("Stream of text 2 was requested but text 2 is not enabled");
     }
-
-    //
-    //  If a standard style, go ahead and number the ordinals sequentially from zero
-    //  so we don't have to special case these during output.
-    //
-    if (m_eType == EEnumTypes::Standard)
-    {
-        int32_t iOrdinal = 0;
-        for (EnumValInfo& evaliCur : m_vValues)
-        {
-            evaliCur.m_iOrdinal = iOrdinal++;
-        }
-    }
 }
 
 
@@ -448,6 +725,43 @@ std::vector<EnumValInfo>::iterator EnumInfo::itFindValueByOrd(const int32_t iToF
     );
 }
 
+// Find a group by its name
+std::vector<EnumInfo::GroupPair>::iterator EnumInfo::itFindGroup(const std::string& strToFind)
+{
+    return std::find_if
+    (
+        m_vGroups.begin()
+        , m_vGroups.end()
+        , [&strToFind](const GroupPair& pairCur) { return pairCur.first == strToFind; }
+    );
+}
+
+
+//
+//  Find a value referenced in a transition or group and return its dense index.
+//  It has to be an actual value, not a synonym, which might not map to a single
+//  value.
+//
+uint32_t EnumInfo::uFindValueIndex(       InputSrc&           srcFile
+                                    , const std::string&        strToFind
+                                    , const std::string_view&   svWhere)
+{
+    std::vector<EnumValInfo>::iterator itVal = itFindValue(strToFind);
+    if (itVal == m_vValues.end())
+    {
+        std::string strErrMsg("'");
+        strErrMsg.append(strToFind);
+        strErrMsg.append("' in ");
+        strErrMsg.append(svWhere);
+        strErrMsg.append(" does not refer to an existing value of enum '");
+        strErrMsg.append(m_strName);
+        strErrMsg.append("'");
+        srcFile.ThrowParseErr(strErrMsg);
+    }
+    return static_cast<uint32_t>(itVal - m_vValues.begin());
+}
+
+
 // Find an enum synonum by its name
 std::vector<EnumInfo::KVSPair>::iterator EnumInfo::itFindSynonym(const std::string& strToFind)
 {
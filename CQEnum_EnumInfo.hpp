@@ -11,14 +11,17 @@
 namespace CQSL { namespace CQEnum {
 
 //
-//  The three types of enumerations we support. This controls what
-//  operations are generated.
+//  The types of enumerations we support. This controls what operations are
+//  generated. FlagSet is numbered like Standard, but each value is a bit
+//  position in a generated multi-word set type, so it isn't limited by the
+//  size of the underlying type.
 //
 enum class EEnumTypes
 {
     Standard
     , Bitmap
     , Arbitary
+    , FlagSet
 
     , Count
 };
@@ -45,14 +48,31 @@ class EnumValInfo
             , const bool            bText1
             , const bool            bText2
             , const std::string&    strEnumName
+            , const std::vector<std::pair<std::string, std::string>>& vAttrs
         );
 
 
-        int32_t         m_iAltValue = 0;
-        int32_t         m_iOrdinal = 0;
-        std::string     m_strName;
-        std::string     m_strText1;
-        std::string     m_strText2;
+        //
+        //  The values of any custom attribute columns defined for the enum, in the
+        //  same order as the enum's list of attributes. We don't pass judgement on
+        //  them, they are output as is.
+        //
+        //  The payload is the optional C++ type carried by this value in the enum's
+        //  generated tagged union. It's also output as is.
+        //
+        //  The stable id is an optional persistent identity for the value, which
+        //  doesn't change if values are inserted or reordered. It's used instead of
+        //  the name to match up values with a previous version of the enum.
+        //
+        bool                        m_bStableId = false;
+        int32_t                     m_iAltValue = 0;
+        int32_t                     m_iOrdinal = 0;
+        uint32_t                    m_uStableId = 0;
+        std::string                 m_strName;
+        std::string                 m_strPayload;
+        std::string                 m_strText1;
+        std::string                 m_strText2;
+        std::vector<std::string>    m_vAttrVals;
 };
 
 
@@ -67,6 +87,18 @@ class EnumInfo
         //
         using KVSPair = std::pair<std::string, int32_t>;
 
+        // Used for custom attribute columns, which have a name and a C++ type
+        using AttrPair = std::pair<std::string, std::string>;
+
+        //
+        //  Used for allowed state transitions, which are the (dense, 0 based) indices
+        //  of the from and to values.
+        //
+        using TransPair = std::pair<uint32_t, uint32_t>;
+
+        // Used for named groups of values, the name and the indices of its members
+        using GroupPair = std::pair<std::string, std::vector<uint32_t>>;
+
         // Indicates which text value to use for things, if any
         enum class ETextVals
         {
@@ -84,6 +116,23 @@ class EnumInfo
         EnumInfo& operator=(const EnumInfo&) = delete;
         EnumInfo& operator=(EnumInfo&&) = default;
 
+        // If any values have a payload type, a tagged union is generated
+        bool bHasPayloads() const noexcept
+        {
+            return std::find_if
+            (
+                m_vValues.begin()
+                , m_vValues.end()
+                , [](const EnumValInfo& evaliCur) { return !evaliCur.m_strPayload.empty(); }
+            ) != m_vValues.end();
+        }
+
+        // Either all of the values have stable ids or none of them do
+        bool bHasStableIds() const noexcept
+        {
+            return !m_vValues.empty() && m_vValues.front().m_bStableId;
+        }
+
         // Non-contiguous ones must provide an explicit ordinal value
         bool bExplicitOrdinal() const noexcept
         {
@@ -110,6 +159,23 @@ class EnumInfo
             const   std::string&        strToFind
         );
 
+        // Find one of our groups by name
+        std::vector<GroupPair>::iterator itFindGroup
+        (
+            const   std::string&        strToFind
+        );
+
+        //
+        //  Find a value named in a transition or group, returns its index or throws.
+        //  The where parameter is for the error message.
+        //
+        uint32_t uFindValueIndex
+        (
+                    InputSrc&           srcFile
+            , const std::string&        strToFind
+            , const std::string_view&   svWhere
+        );
+
 
         //
         //  We have flags to indicate what stuff the definition indicated
@@ -126,7 +192,22 @@ class EnumInfo
         //  controls the ordinal assignment, so we can't use a map or set or
         //  anything. Well, we could keep a separate one, but not worth it.
         //
+        //  The attributes list is any custom columns defined for the enum, and
+        //  each value has a value for each of them.
+        //
+        //  If a Transitions= block was seen, the transitions flag is set and the
+        //  list has the from/to pairs. It may be set but empty, in which case no
+        //  transitions are allowed.
+        //
+        //  The groups list is any named groups of values, which have to be made up
+        //  of values already defined when the group is seen.
+        //
+        //  The aliases flag indicates a runtime alias registry should be generated,
+        //  to let bNameToEnum() accept names added at runtime.
+        //
+        bool                        m_bAliases = false;
         bool                        m_bIsMonotonic = false;
+        bool                        m_bTransitions = false;
         bool                        m_bText1 = false;
         bool                        m_bText2 = false;
         bool                        m_bDoAltVal = false;
@@ -135,7 +216,10 @@ class EnumInfo
         EEnumTypes                  m_eType = EEnumTypes::Count;
         std::string                 m_strName;
         std::string                 m_strUnderType;
+        std::vector<AttrPair>       m_vAttrs;
+        std::vector<GroupPair>      m_vGroups;
         std::vector<KVSPair>        m_vSynonyms;
+        std::vector<TransPair>      m_vTransitions;
         std::vector<EnumValInfo>    m_vValues;
 };
 
@@ -13,6 +13,17 @@ bool InputSrc::bCheckNextId(const   std::string_view&   svCheck
                             , const bool                bWithEquals
                             , const bool                bThrowIfIfNot)
 {
+    //
+    //  Remember where we are, so that we can go back if it's not what we want.
+    //  Pushing back the token text isn't enough, since getting the token will
+    //  have eaten a trailing space, so two failed checks in a row would lose a
+    //  character.
+    //
+    const std::streampos posStart = m_strmSrc.tellg();
+    const bool bFirstLineChar = m_bFirstLineChar;
+    const uint32_t uColNum = m_uColNum;
+    const uint32_t uLineNum = m_uLineNum;
+
     if ((eGetNextToken(m_strTmpToken) != CQEnum::ETokens::Identifier)
     ||  (m_strTmpToken != svCheck))
     {
@@ -21,8 +32,12 @@ bool InputSrc::bCheckNextId(const   std::string_view&   svCheck
             ThrowParseErr(pszFailMsg);
         }
 
-        // Push the characters back
-        PushBack(m_strTmpToken);
+        // Go back to where we were
+        m_strmSrc.clear();
+        m_strmSrc.seekg(posStart);
+        m_bFirstLineChar = bFirstLineChar;
+        m_uColNum = uColNum;
+        m_uLineNum = uLineNum;
         return false;
     }
 
@@ -565,7 +580,12 @@ char InputSrc::chGetNext(const bool ignoreWS)
     char chRet = 0;
     while (m_strmSrc)
     {
-        m_strmSrc.get(chRet);
+        // If we hit the end, return a zero, not the last character we saw
+        if (!m_strmSrc.get(chRet))
+        {
+            chRet = 0;
+            break;
+        }
 
         if (!bIsSpace(chRet))
         {
@@ -645,6 +665,7 @@ void InputSrc::Open(const std::string& strSrcFile)
     {
         throw std::runtime_error("The input file could not be opened");
     }
+    m_pathSrcDir = std::filesystem::path(strSrcFile).parent_path();
 
     m_bFirstLineChar = true;
     m_uColNum = 1;
@@ -131,6 +131,12 @@ class InputSrc
 
         void Open(const std::string& strSrcFile);
 
+        // Files named in the source, like data files, are relative to the source file
+        std::filesystem::path pathSrcRelative(const std::string& strPath) const
+        {
+            return m_pathSrcDir / std::filesystem::path(strPath);
+        }
+
         //
         //  The throw needs to be visible to the code analyzer, so we do it
         //  this way.
@@ -185,6 +191,9 @@ class InputSrc
 
         std::ifstream   m_strmSrc;
 
+        // The directory of the source file
+        std::filesystem::path m_pathSrcDir;
+
         //
         //  Some temp strings for internal use. Don't assume they are unaffected
         //  across any call to any other method here.
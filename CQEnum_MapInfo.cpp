@@ -0,0 +1,198 @@
+#include "CQEnum_Pch.hpp"
+#include "CQEnum.hpp"
+
+
+namespace CQSL { namespace CQEnum {
+
+// Find a defined enum by name, throws if not found
+static const EnumInfo& enumiFindMapEnum(        InputSrc&       srcFile
+                                        , const EnumInfoList&   listEnums
+                                        , const std::string&    strToFind)
+{
+    std::vector<EnumInfo>::const_iterator itEnum = std::find_if
+    (
+        listEnums.m_vEnumList.begin()
+        , listEnums.m_vEnumList.end()
+        , [&strToFind](const EnumInfo& enumiCur) { return enumiCur.m_strName == strToFind; }
+    );
+    if (itEnum == listEnums.m_vEnumList.end())
+    {
+        std::string strErrMsg("'");
+        strErrMsg.append(strToFind);
+        strErrMsg.append("' is not a defined enumeration");
+        srcFile.ThrowParseErr(strErrMsg);
+    }
+    return *itEnum;
+}
+
+//
+//  Make sure a name is a value of the indicated enum. The target side can use
+//  synonyms, since those are just another name for a value, but the source
+//  side can't since they don't have their own slot.
+//
+static void CheckMapValue(          InputSrc&       srcFile
+                            , const EnumInfo&       enumiSrc
+                            , const std::string&    strToFind
+                            , const bool            bSynonyms)
+{
+    const bool bFound
+    (
+        (std::find_if(enumiSrc.m_vValues.begin()
+                      , enumiSrc.m_vValues.end()
+                      , [&strToFind](const EnumValInfo& evaliCur)
+                        { return evaliCur.m_strName == strToFind; }) != enumiSrc.m_vValues.end())
+        || (bSynonyms
+            && (std::find_if(enumiSrc.m_vSynonyms.begin()
+                            , enumiSrc.m_vSynonyms.end()
+                            , [&strToFind](const EnumInfo::KVSPair& pairCur)
+                              { return pairCur.first == strToFind; }) != enumiSrc.m_vSynonyms.end()))
+    );
+
+    if (!bFound)
+    {
+        std::string strErrMsg("'");
+        strErrMsg.append(strToFind);
+        strErrMsg.append("' does not refer to an existing value of enum '");
+        strErrMsg.append(enumiSrc.m_strName);
+        strErrMsg.append("'");
+        srcFile.ThrowParseErr(strErrMsg);
+    }
+}
+
+
+//
+//  At this point, the Map= of the block start line has been eaten. So we get
+//  the map name, then the source and target enums, an optional default, and
+//  then the 'srcval : tarval' lines until the end of the block.
+//
+void MapInfo::ParseFrom(InputSrc& srcFile, const EnumInfoList& listEnums)
+{
+    m_strDefault.clear();
+    m_strName.clear();
+    m_strSource.clear();
+    m_strTarget.clear();
+    m_vTargets.clear();
+
+    srcFile.GetIdToken("Expected to see map name", m_strName);
+
+    srcFile.bCheckNextId("Source", "Expected the Source= attribute", true, true);
+    srcFile.GetIdToken("Expected the source enumeration name", m_strSource);
+    const EnumInfo& enumiSrc = enumiFindMapEnum(srcFile, listEnums, m_strSource);
+
+    srcFile.bCheckNextId("Target", "Expected the Target= attribute", true, true);
+    srcFile.GetIdToken("Expected the target enumeration name", m_strTarget);
+    const EnumInfo& enumiTar = enumiFindMapEnum(srcFile, listEnums, m_strTarget);
+
+    if (srcFile.bCheckNextId("Default", "Expected Default= or a map value", true, false))
+    {
+        srcFile.GetIdToken("Expected the default target value", m_strDefault);
+        CheckMapValue(srcFile, enumiTar, m_strDefault, true);
+    }
+
+    // The targets are filled in as we see them, with the default if any
+    m_vTargets.resize(enumiSrc.m_vValues.size(), m_strDefault);
+    std::vector<bool> vMapped(enumiSrc.m_vValues.size(), false);
+
+    std::string strSrcVal;
+    std::string strTarVal;
+    while (true)
+    {
+        srcFile.GetIdToken("Expected source value or EndMap", strSrcVal);
+        if (strSrcVal == "EndMap")
+        {
+            break;
+        }
+
+        CheckMapValue(srcFile, enumiSrc, strSrcVal, false);
+        srcFile.CheckColon();
+        srcFile.GetIdToken("Expected target value", strTarVal);
+        CheckMapValue(srcFile, enumiTar, strTarVal, true);
+
+        const size_t szIndex = static_cast<size_t>
+        (
+            std::find_if
+            (
+                enumiSrc.m_vValues.begin()
+                , enumiSrc.m_vValues.end()
+                , [&strSrcVal](const EnumValInfo& evaliCur) { return evaliCur.m_strName == strSrcVal; }
+            ) - enumiSrc.m_vValues.begin()
+        );
+        if (vMapped[szIndex])
+        {
+            std::string strErrMsg("Source value '");
+            strErrMsg.append(strSrcVal);
+            strErrMsg.append("' was already mapped in map ");
+            strErrMsg.append(m_strName);
+            srcFile.ThrowParseErr(strErrMsg);
+        }
+        vMapped[szIndex] = true;
+        m_vTargets[szIndex] = std::move(strTarVal);
+    }
+
+    //
+    //  If no default, then every source value must be mapped, so that adding a
+    //  value to the source enum can't silently leave a hole.
+    //
+    if (m_strDefault.empty())
+    {
+        for (size_t szIndex = 0; szIndex < vMapped.size(); szIndex++)
+        {
+            if (!vMapped[szIndex])
+            {
+                std::string strErrMsg("Source value '");
+                strErrMsg.append(enumiSrc.m_vValues[szIndex].m_strName);
+                strErrMsg.append("' is not mapped in map ");
+                strErrMsg.append(m_strName);
+                strErrMsg.append(", and no default was set");
+                srcFile.ThrowParseErr(strErrMsg);
+            }
+        }
+
+        m_strDefault = enumiTar.m_vValues.front().m_strName;
+    }
+}
+
+
+//
+//  At this point the main parsing code has seen the Maps= opening line and
+//  knows that this is what is next. So we should see Map= blocks until we get
+//  the end of this overall Maps block.
+//
+void MapInfoList::ParseFrom(InputSrc& srcFile, const EnumInfoList& listEnums)
+{
+    MapInfo mapiNew;
+    while (true)
+    {
+        if (!srcFile.bNextChildOrEnd("Map", "EndMaps"))
+        {
+            break;
+        }
+
+        mapiNew.ParseFrom(srcFile, listEnums);
+
+        // The generated method can't have the same name as another map or an enum
+        const bool bDupMap = std::find_if
+        (
+            m_vMapList.begin()
+            , m_vMapList.end()
+            , [&mapiNew](const MapInfo& mapiCur) { return mapiCur.m_strName == mapiNew.m_strName; }
+        ) != m_vMapList.end();
+        const bool bDupEnum = std::find_if
+        (
+            listEnums.m_vEnumList.begin()
+            , listEnums.m_vEnumList.end()
+            , [&mapiNew](const EnumInfo& enumiCur) { return enumiCur.m_strName == mapiNew.m_strName; }
+        ) != listEnums.m_vEnumList.end();
+        if (bDupMap || bDupEnum)
+        {
+            std::string strErrMsg("'");
+            strErrMsg.append(mapiNew.m_strName);
+            strErrMsg.append("' is already used by another map or enumeration");
+            srcFile.ThrowParseErr(strErrMsg);
+        }
+
+        m_vMapList.push_back(std::move(mapiNew));
+    }
+}
+
+}};
@@ -0,0 +1,71 @@
+#pragma once
+
+//
+//  This file handles the maps section of the definition file. A map translates
+//  the values of one defined enum to the values of another. So we have a class
+//  to store the info for an individual map and then a list of maps. They are
+//  checked against the already parsed enums, so the maps block has to come
+//  after the enums block.
+//
+
+namespace CQSL { namespace CQEnum {
+
+class MapInfo
+{
+    public :
+        MapInfo() = default;
+        MapInfo(MapInfo&&) = default;
+        ~MapInfo() = default;
+
+        // Unimplemented
+        MapInfo(const MapInfo&) = delete;
+        MapInfo& operator=(const MapInfo&) = delete;
+        MapInfo& operator=(MapInfo&&) = delete;
+
+        void ParseFrom
+        (
+                    InputSrc&           srcFile
+            , const EnumInfoList&       listEnums
+        );
+
+
+        //
+        //  The name of the map, which is used for the generated translation method,
+        //  and the names of the source and target enums. Then the name of the target
+        //  value for each source value, in the order of the source values (so by
+        //  their dense index.) If a default was set, any source values that weren't
+        //  explicitly mapped get that, and it's what invalid source values map to.
+        //  Else it's the first target value.
+        //
+        std::string                 m_strDefault;
+        std::string                 m_strName;
+        std::string                 m_strSource;
+        std::string                 m_strTarget;
+        std::vector<std::string>    m_vTargets;
+};
+
+
+// Represents the overall maps definition block
+class MapInfoList
+{
+    public :
+        MapInfoList() = default;
+        ~MapInfoList() = default;
+
+        /// Unimplemented
+        MapInfoList(const MapInfoList&) = delete;
+        MapInfoList(MapInfoList&&) = delete;
+        MapInfoList& operator=(const MapInfoList&) = delete;
+        MapInfoList& operator=(MapInfoList&&) = delete;
+
+        void ParseFrom
+        (
+                    InputSrc&           srcFile
+            , const EnumInfoList&       listEnums
+        );
+
+        // We track a list of defined maps
+        std::vector<MapInfo>        m_vMapList;
+};
+
+}};
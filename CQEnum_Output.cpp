@@ -28,10 +28,11 @@ namespace
     //
     constexpr const char* const pszEnumTableTypes = 
     {
-        "enum class ETypes { Arbitrary, Bitmap, Standard };\n\n"
+        "enum class ETypes { Arbitrary, Bitmap, FlagSet, Standard };\n\n"
         "struct EnumTableVal\n"
         "{\n"
         "    const wchar_t* const   pszName;\n"
+        "    const char* const      pszNameU8;\n"
         "    int64_t                iOrdinal;\n"
         "    int32_t                iAltVal;\n"
         "    const wchar_t* const   pszText1;\n"
@@ -75,34 +76,3556 @@ namespace
         "    return std::numeric_limits<uint32_t>::max();\n"
         "}\n\n"
 
+        "#if defined(CQENUM_INSTRUMENT)\n"
+        "//\n"
+        "//  The number of entries a failed ordinal search looked at, for the lookup\n"
+        "//  instrumentation. It stops at the first one past the value it wants.\n"
+        "//\n"
+        "uint32_t uOrdinalMissProbes(const  EnumTableVal* const paTable\n"
+        "                           , const uint32_t            uCount\n"
+        "                           , const int64_t             iFind)\n"
+        "{\n"
+        "    uint32_t uIndex = 0;\n"
+        "    while ((uIndex < uCount) && (paTable[uIndex].iOrdinal < iFind))\n"
+        "    {\n"
+        "        uIndex++;\n"
+        "    }\n"
+        "    return (uIndex < uCount) ? uIndex + 1 : uCount;\n"
+        "}\n"
+        "#endif\n\n"
+
         "uint32_t uAltValToIndex(const  EnumTableVal* const paTable\n"
         "                       , const uint32_t            uCount\n"
         "                       , const int32_t             iFind)\n"
         "{\n"
-        "    for (uint32_t uIndex = 0; uIndex < uCount; uIndex++)\n"
+        "    for (uint32_t uIndex = 0; uIndex < uCount; uIndex++)\n"
+        "    {\n"
+        "        if (paTable[uIndex].iAltVal == iFind)\n"
+        "        {\n"
+        "            return uIndex;\n"
+        "        }\n"
+        "    }\n"
+        "    return std::numeric_limits<uint32_t>::max();\n"
+        "}\n\n"
+
+        "uint32_t uNameToIndex( const   EnumTableVal* const paTable\n"
+        "                       , const uint32_t            uCount\n"
+        "                       , const std::wstring_view&  svFind)\n"
+        "{\n"
+        "    for (uint32_t uIndex = 0; uIndex < uCount; uIndex++)\n"
+        "    {\n"
+        "        if (_wcsicmp(svFind.data(), paTable[uIndex].pszName) == 0)\n"
+        "        {\n"
+        "            return uIndex;\n"
+        "        }\n"
+        "    }\n"
+        "    return std::numeric_limits<uint32_t>::max();\n"
+        "}\n\n"
+    };
+
+    // Helpers for the EnumFromChars() methods, which go into the impl file as well
+    constexpr const char* const pszFromCharsHelpers =
+    {
+        "//\n"
+        "//  Support for the EnumFromChars() methods, which work on raw UTF-8 ranges. Names\n"
+        "//  are ASCII identifiers, so there's no need to widen anything.\n"
+        "//\n"
+        "bool bIsNameCharU8(const char chTest)\n"
+        "{\n"
+        "    return ((chTest >= 'A') && (chTest <= 'Z'))\n"
+        "           || ((chTest >= 'a') && (chTest <= 'z'))\n"
+        "           || ((chTest >= '0') && (chTest <= '9'))\n"
+        "           || (chTest == '_');\n"
+        "}\n"
+        "\n"
+        "bool bSameNameU8(const char* const pszName, const char* const pchTest, const size_t szLen)\n"
+        "{\n"
+        "    for (size_t szIndex = 0; szIndex < szLen; szIndex++)\n"
+        "    {\n"
+        "        char chName = pszName[szIndex];\n"
+        "        char chTest = pchTest[szIndex];\n"
+        "        if (!chName)\n"
+        "        {\n"
+        "            return false;\n"
+        "        }\n"
+        "        if ((chName >= 'a') && (chName <= 'z'))\n"
+        "        {\n"
+        "            chName -= 0x20;\n"
+        "        }\n"
+        "        if ((chTest >= 'a') && (chTest <= 'z'))\n"
+        "        {\n"
+        "            chTest -= 0x20;\n"
+        "        }\n"
+        "        if (chName != chTest)\n"
+        "        {\n"
+        "            return false;\n"
+        "        }\n"
+        "    }\n"
+        "    return pszName[szLen] == 0;\n"
+        "}\n"
+        "\n"
+        "std::from_chars_result frIndexFromChars(const   EnumTableVal* const     paTable\n"
+        "                                        , const uint32_t                uCount\n"
+        "                                        , const char* const             pszFirst\n"
+        "                                        , const char* const             pszLast\n"
+        "                                        , const CQSL::CQEnum::EFromChars eRules\n"
+        "                                        ,       uint32_t&               uIndex)\n"
+        "{\n"
+        "    std::from_chars_result frRet{ pszFirst, std::errc::invalid_argument };\n"
+        "    uIndex = std::numeric_limits<uint32_t>::max();\n"
+        "    if (pszFirst >= pszLast)\n"
+        "    {\n"
+        "        return frRet;\n"
+        "    }\n"
+        "\n"
+        "    // If it starts with a letter, it has to be a name\n"
+        "    const char chFirst = *pszFirst;\n"
+        "    if (((chFirst >= 'A') && (chFirst <= 'Z')) || ((chFirst >= 'a') && (chFirst <= 'z')))\n"
+        "    {\n"
+        "        const char* pszEnd = pszFirst + 1;\n"
+        "        while ((pszEnd < pszLast) && bIsNameCharU8(*pszEnd))\n"
+        "        {\n"
+        "            pszEnd++;\n"
+        "        }\n"
+        "\n"
+        "        if (CQSL::CQEnum::bFromCharsRule(eRules, CQSL::CQEnum::EFromChars::Names))\n"
+        "        {\n"
+        "            const size_t szLen = static_cast<size_t>(pszEnd - pszFirst);\n"
+        "            for (uint32_t uCur = 0; uCur < uCount; uCur++)\n"
+        "            {\n"
+        "                if (bSameNameU8(paTable[uCur].pszNameU8, pszFirst, szLen))\n"
+        "                {\n"
+        "                    uIndex = uCur;\n"
+        "                    frRet.ptr = pszEnd;\n"
+        "                    frRet.ec = std::errc();\n"
+        "                    break;\n"
+        "                }\n"
+        "            }\n"
+        "        }\n"
+        "        return frRet;\n"
+        "    }\n"
+        "\n"
+        "    // Else it has to be a decimal or 0x prefixed hex number, optionally negative\n"
+        "    const char* pszNum = pszFirst;\n"
+        "    const bool bNegative = (*pszNum == '-');\n"
+        "    if (bNegative)\n"
+        "    {\n"
+        "        pszNum++;\n"
+        "    }\n"
+        "\n"
+        "    int iRadix = 10;\n"
+        "    if (((pszLast - pszNum) > 2) && (pszNum[0] == '0') && ((pszNum[1] == 'x') || (pszNum[1] == 'X')))\n"
+        "    {\n"
+        "        iRadix = 16;\n"
+        "        pszNum += 2;\n"
+        "    }\n"
+        "\n"
+        "    uint64_t uValue = 0;\n"
+        "    const std::from_chars_result frNum = std::from_chars(pszNum, pszLast, uValue, iRadix);\n"
+        "    if (frNum.ec == std::errc::result_out_of_range)\n"
+        "    {\n"
+        "        frRet = frNum;\n"
+        "        return frRet;\n"
+        "    }\n"
+        "    else if (frNum.ec != std::errc())\n"
+        "    {\n"
+        "        return frRet;\n"
+        "    }\n"
+        "\n"
+        "    // Ordinals and alt values are both within the int32_t range\n"
+        "    if (uValue > (bNegative ? 0x80000000ULL : 0x7FFFFFFFULL))\n"
+        "    {\n"
+        "        frRet.ptr = frNum.ptr;\n"
+        "        frRet.ec = std::errc::result_out_of_range;\n"
+        "        return frRet;\n"
+        "    }\n"
+        "    const int64_t iValue = bNegative ? -static_cast<int64_t>(uValue) : static_cast<int64_t>(uValue);\n"
+        "\n"
+        "    if (CQSL::CQEnum::bFromCharsRule(eRules, CQSL::CQEnum::EFromChars::Ordinals))\n"
+        "    {\n"
+        "        uIndex = uOrdinalToIndex(paTable, uCount, iValue);\n"
+        "    }\n"
+        "\n"
+        "    if ((uIndex >= uCount)\n"
+        "    &&  CQSL::CQEnum::bFromCharsRule(eRules, CQSL::CQEnum::EFromChars::AltVals))\n"
+        "    {\n"
+        "        uIndex = uAltValToIndex(paTable, uCount, static_cast<int32_t>(iValue));\n"
+        "    }\n"
+        "\n"
+        "    if (uIndex < uCount)\n"
+        "    {\n"
+        "        frRet.ptr = frNum.ptr;\n"
+        "        frRet.ec = std::errc();\n"
+        "    }\n"
+        "    return frRet;\n"
+        "}\n"
+        "\n"
+    };
+
+    //
+    //  Support code that the generated headers use, which goes into a separate
+    //  CQEnumSupport.hpp header in the target directory, so that each generated
+    //  header just includes it instead of carrying its own copy. Each feature's
+    //  support is a separate string to stay within compiler literal size limits.
+    //
+    //  The version goes into the guard, and each generated header checks it, so
+    //  that headers from different versions of CQEnum can't silently use each
+    //  other's support code. It MUST be bumped if any of the support code changes.
+    //
+    constexpr uint32_t c_uSupportVersion = 3;
+
+    constexpr const char* const pszSupportName = "CQEnumSupport.hpp";
+
+    constexpr const char* const pszHdrSupportOpen =
+    {
+        "#include <algorithm>\n"
+        "#include <array>\n"
+        "#include <atomic>\n"
+        "#include <charconv>\n"
+        "#include <cstdint>\n"
+        "#include <initializer_list>\n"
+        "#include <iterator>\n"
+        "#include <mutex>\n"
+        "#include <new>\n"
+        "#include <stdexcept>\n"
+        "#include <string>\n"
+        "#include <system_error>\n"
+        "#include <thread>\n"
+        "#include <tuple>\n"
+        "#include <type_traits>\n"
+        "#include <utility>\n"
+        "#include <vector>\n"
+        "#if defined(__AVX2__) || defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))\n"
+        "#define CQENUM_SIMD_SSE2\n"
+        "#include <immintrin.h>\n"
+        "#endif\n"
+        "#if defined(__BMI2__) || (defined(_MSC_VER) && defined(__AVX2__))\n"
+        "#define CQENUM_BMI2\n"
+        "#include <immintrin.h>\n"
+        "#endif\n"
+        "#if defined(_MSC_VER)\n"
+        "#include <intrin.h>\n"
+        "#endif\n"
+        "#if defined(CQENUM_INSTRUMENT)\n"
+        "#include <ostream>\n"
+        "#endif\n"
+        "\n"
+        "namespace CQSL { namespace CQEnum {\n"
+    };
+
+    constexpr const char* const pszHdrValues =
+    {
+        "// A range of values, which can be used in a range based for loop\n"
+        "template <typename E> struct ValueRange\n"
+        "{\n"
+        "    const E*    pBegin;\n"
+        "    const E*    pEnd;\n"
+        "\n"
+        "    constexpr const E* begin() const noexcept { return pBegin; }\n"
+        "    constexpr const E* end() const noexcept { return pEnd; }\n"
+        "    constexpr bool bIsEmpty() const noexcept { return pBegin == pEnd; }\n"
+        "    constexpr uint32_t uCount() const noexcept { return static_cast<uint32_t>(pEnd - pBegin); }\n"
+        "};\n"
+        "\n"
+        "//\n"
+        "//  The generator specializes this for each enum, with all of the values in the\n"
+        "//  order defined, not including synonyms or magic values.\n"
+        "//\n"
+        "template <typename E> struct EnumValueList;\n"
+        "\n"
+        "// Iterate all of the values of an enum, e.g. for (auto eVal : AllValues<EMyEnum>())\n"
+        "template <typename E>\n"
+        "constexpr ValueRange<E> AllValues() noexcept\n"
+        "{\n"
+        "    return ValueRange<E>\n"
+        "    {\n"
+        "        EnumValueList<E>::s_aeValues\n"
+        "        , EnumValueList<E>::s_aeValues + EnumValueList<E>::c_uCount\n"
+        "    };\n"
+        "}\n"
+        "\n"
+    };
+
+    constexpr const char* const pszHdrTraits =
+    {
+        "// The kinds of enums, as reported by EnumTraits\n"
+        "enum class EEnumKinds { Arbitrary, Bitmap, FlagSet, Standard };\n"
+        "\n"
+        "//\n"
+        "//  The generator specializes this for each enum, with compile time info about\n"
+        "//  the enum, and pointers to its lookup functions so that generic code can get\n"
+        "//  to them without knowing the type. Pointers for lookups the enum doesn't have\n"
+        "//  (text or alt values not enabled) are null.\n"
+        "//\n"
+        "//      EnumType, UnderType\n"
+        "//      eKind, c_uCount, eMin, eMax (lowest and highest values)\n"
+        "//      bIsMonotonic, bHasText1, bHasText2, bHasAltVal, bHasInc\n"
+        "//      c_uFingerprint (the schema fingerprint)\n"
+        "//      pfnToName, pfnFromName, pfnFromChars, pfnIsValid, pfnToText1,\n"
+        "//      pfnToText2, pfnToAltVal, pfnFromAltVal, pfnToAltVals,\n"
+        "//      pfnFromAltVals (bulk alt value translation)\n"
+        "//\n"
+        "template <typename E> struct EnumTraits;\n"
+    };
+
+    constexpr const char* const pszHdrFlagSet =
+    {
+        "//\n"
+        "//  Support for FlagSet enums. The values are bit positions into a fixed\n"
+        "//  size array of 64 bit words, so it can be larger than any underlying type.\n"
+        "//  The bulk operations work a vector at a time where the target supports it.\n"
+        "//\n"
+        "enum class EWordOps { And, AndNot, Or, Xor };\n"
+        "\n"
+        "inline uint32_t uWordBitCount(const uint64_t uWord) noexcept\n"
+        "{\n"
+        "#if defined(__GNUC__) || defined(__clang__)\n"
+        "    return static_cast<uint32_t>(__builtin_popcountll(uWord));\n"
+        "#elif defined(_MSC_VER) && defined(_M_X64) && defined(__AVX__)\n"
+        "    return static_cast<uint32_t>(__popcnt64(uWord));\n"
+        "#else\n"
+        "    uint64_t uTmp = uWord - ((uWord >> 1) & 0x5555555555555555ULL);\n"
+        "    uTmp = (uTmp & 0x3333333333333333ULL) + ((uTmp >> 2) & 0x3333333333333333ULL);\n"
+        "    uTmp = (uTmp + (uTmp >> 4)) & 0x0F0F0F0F0F0F0F0FULL;\n"
+        "    return static_cast<uint32_t>((uTmp * 0x0101010101010101ULL) >> 56);\n"
+        "#endif\n"
+        "}\n"
+        "\n"
+        "// The caller must insure that at least one bit is on\n"
+        "inline uint32_t uWordLowBit(const uint64_t uWord) noexcept\n"
+        "{\n"
+        "#if defined(__GNUC__) || defined(__clang__)\n"
+        "    return static_cast<uint32_t>(__builtin_ctzll(uWord));\n"
+        "#elif defined(_MSC_VER) && defined(_M_X64)\n"
+        "    unsigned long ulIndex = 0;\n"
+        "    _BitScanForward64(&ulIndex, uWord);\n"
+        "    return static_cast<uint32_t>(ulIndex);\n"
+        "#else\n"
+        "    uint32_t uRet = 0;\n"
+        "    while (!(uWord & (1ULL << uRet)))\n"
+        "    {\n"
+        "        uRet++;\n"
+        "    }\n"
+        "    return uRet;\n"
+        "#endif\n"
+        "}\n"
+        "\n"
+        "// Combine the source words into the target words, using the indicated operation\n"
+        "template <EWordOps eOp>\n"
+        "inline void CombineWords(       uint64_t* const pauTar\n"
+        "                        , const uint64_t* const pauSrc\n"
+        "                        , const uint32_t        uWords) noexcept\n"
+        "{\n"
+        "    uint32_t uIndex = 0;\n"
+        "#if defined(__AVX2__)\n"
+        "    for (; uIndex + 4 <= uWords; uIndex += 4)\n"
+        "    {\n"
+        "        const __m256i vTar = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pauTar + uIndex));\n"
+        "        const __m256i vSrc = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pauSrc + uIndex));\n"
+        "        __m256i vRes;\n"
+        "        if constexpr (eOp == EWordOps::And) { vRes = _mm256_and_si256(vTar, vSrc); }\n"
+        "        else if constexpr (eOp == EWordOps::AndNot) { vRes = _mm256_andnot_si256(vSrc, vTar); }\n"
+        "        else if constexpr (eOp == EWordOps::Or) { vRes = _mm256_or_si256(vTar, vSrc); }\n"
+        "        else { vRes = _mm256_xor_si256(vTar, vSrc); }\n"
+        "        _mm256_storeu_si256(reinterpret_cast<__m256i*>(pauTar + uIndex), vRes);\n"
+        "    }\n"
+        "#endif\n"
+        "#if defined(CQENUM_SIMD_SSE2)\n"
+        "    for (; uIndex + 2 <= uWords; uIndex += 2)\n"
+        "    {\n"
+        "        const __m128i vTar = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pauTar + uIndex));\n"
+        "        const __m128i vSrc = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pauSrc + uIndex));\n"
+        "        __m128i vRes;\n"
+        "        if constexpr (eOp == EWordOps::And) { vRes = _mm_and_si128(vTar, vSrc); }\n"
+        "        else if constexpr (eOp == EWordOps::AndNot) { vRes = _mm_andnot_si128(vSrc, vTar); }\n"
+        "        else if constexpr (eOp == EWordOps::Or) { vRes = _mm_or_si128(vTar, vSrc); }\n"
+        "        else { vRes = _mm_xor_si128(vTar, vSrc); }\n"
+        "        _mm_storeu_si128(reinterpret_cast<__m128i*>(pauTar + uIndex), vRes);\n"
+        "    }\n"
+        "#endif\n"
+        "    for (; uIndex < uWords; uIndex++)\n"
+        "    {\n"
+        "        if constexpr (eOp == EWordOps::And) { pauTar[uIndex] &= pauSrc[uIndex]; }\n"
+        "        else if constexpr (eOp == EWordOps::AndNot) { pauTar[uIndex] &= ~pauSrc[uIndex]; }\n"
+        "        else if constexpr (eOp == EWordOps::Or) { pauTar[uIndex] |= pauSrc[uIndex]; }\n"
+        "        else { pauTar[uIndex] ^= pauSrc[uIndex]; }\n"
+        "    }\n"
+        "}\n"
+        "\n"
+        "//\n"
+        "//  Apply the operation to the two sets of words and return whether any bits are\n"
+        "//  on in the result, without storing it. It ORs the results together and only\n"
+        "//  tests once at the end, so it doesn't branch on the contents.\n"
+        "//\n"
+        "template <EWordOps eOp>\n"
+        "inline bool bAnyWordBits(const  uint64_t* const pauLHS\n"
+        "                        , const uint64_t* const pauRHS\n"
+        "                        , const uint32_t        uWords) noexcept\n"
+        "{\n"
+        "    uint32_t uIndex = 0;\n"
+        "    uint64_t uAccum = 0;\n"
+        "#if defined(__AVX2__)\n"
+        "    __m256i vAccum256 = _mm256_setzero_si256();\n"
+        "    for (; uIndex + 4 <= uWords; uIndex += 4)\n"
+        "    {\n"
+        "        const __m256i vLHS = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pauLHS + uIndex));\n"
+        "        const __m256i vRHS = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pauRHS + uIndex));\n"
+        "        if constexpr (eOp == EWordOps::And) { vAccum256 = _mm256_or_si256(vAccum256, _mm256_and_si256(vLHS, vRHS)); }\n"
+        "        else if constexpr (eOp == EWordOps::AndNot) { vAccum256 = _mm256_or_si256(vAccum256, _mm256_andnot_si256(vRHS, vLHS)); }\n"
+        "        else if constexpr (eOp == EWordOps::Or) { vAccum256 = _mm256_or_si256(vAccum256, _mm256_or_si256(vLHS, vRHS)); }\n"
+        "        else { vAccum256 = _mm256_or_si256(vAccum256, _mm256_xor_si256(vLHS, vRHS)); }\n"
+        "    }\n"
+        "    uAccum |= static_cast<uint64_t>(!_mm256_testz_si256(vAccum256, vAccum256));\n"
+        "#endif\n"
+        "#if defined(CQENUM_SIMD_SSE2)\n"
+        "    __m128i vAccum128 = _mm_setzero_si128();\n"
+        "    for (; uIndex + 2 <= uWords; uIndex += 2)\n"
+        "    {\n"
+        "        const __m128i vLHS = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pauLHS + uIndex));\n"
+        "        const __m128i vRHS = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pauRHS + uIndex));\n"
+        "        if constexpr (eOp == EWordOps::And) { vAccum128 = _mm_or_si128(vAccum128, _mm_and_si128(vLHS, vRHS)); }\n"
+        "        else if constexpr (eOp == EWordOps::AndNot) { vAccum128 = _mm_or_si128(vAccum128, _mm_andnot_si128(vRHS, vLHS)); }\n"
+        "        else if constexpr (eOp == EWordOps::Or) { vAccum128 = _mm_or_si128(vAccum128, _mm_or_si128(vLHS, vRHS)); }\n"
+        "        else { vAccum128 = _mm_or_si128(vAccum128, _mm_xor_si128(vLHS, vRHS)); }\n"
+        "    }\n"
+        "    uAccum |= static_cast<uint64_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(vAccum128, _mm_setzero_si128())) != 0xFFFF);\n"
+        "#endif\n"
+        "    for (; uIndex < uWords; uIndex++)\n"
+        "    {\n"
+        "        if constexpr (eOp == EWordOps::And) { uAccum |= pauLHS[uIndex] & pauRHS[uIndex]; }\n"
+        "        else if constexpr (eOp == EWordOps::AndNot) { uAccum |= pauLHS[uIndex] & ~pauRHS[uIndex]; }\n"
+        "        else if constexpr (eOp == EWordOps::Or) { uAccum |= pauLHS[uIndex] | pauRHS[uIndex]; }\n"
+        "        else { uAccum |= pauLHS[uIndex] ^ pauRHS[uIndex]; }\n"
+        "    }\n"
+        "    return uAccum != 0;\n"
+        "}\n"
+        "\n"
+        "\n"
+        "// Builds the words for a flag set with all of the defined bits on\n"
+        "template <uint32_t uBits>\n"
+        "constexpr std::array<uint64_t, (uBits + 63) / 64> auFlagSetMask() noexcept\n"
+        "{\n"
+        "    std::array<uint64_t, (uBits + 63) / 64> auRet = {};\n"
+        "    for (uint32_t uIndex = 0; uIndex < auRet.size(); uIndex++)\n"
+        "    {\n"
+        "        auRet[uIndex] = ~0ULL;\n"
+        "    }\n"
+        "    if (uBits % 64)\n"
+        "    {\n"
+        "        auRet[auRet.size() - 1] = (1ULL << (uBits % 64)) - 1;\n"
+        "    }\n"
+        "    return auRet;\n"
+        "}\n"
+        "\n"
+        "\n"
+        "//\n"
+        "//  The generator creates an alias of this for each FlagSet enum, with the value\n"
+        "//  count as the bit count. So E's values are 0 to uBits-1.\n"
+        "//\n"
+        "template <typename E, uint32_t uBits> class FlagSet\n"
+        "{\n"
+        "    public :\n"
+        "        static_assert(uBits > 0, \"A flag set must have at least one bit\");\n"
+        "\n"
+        "        static constexpr uint32_t c_uBits = uBits;\n"
+        "        static constexpr uint32_t c_uWords = (uBits + 63) / 64;\n"
+        "\n"
+        "        // Iterates the values of the bits that are on, in ascending order\n"
+        "        class Iterator\n"
+        "        {\n"
+        "            public :\n"
+        "                Iterator(const uint64_t* const pauWords, const uint32_t uWord) noexcept :\n"
+        "\n"
+        "                    m_pauWords(pauWords)\n"
+        "                    , m_uWord(uWord)\n"
+        "                    , m_uCurBits((uWord < c_uWords) ? pauWords[uWord] : 0)\n"
+        "                {\n"
+        "                    SkipEmpty();\n"
+        "                }\n"
+        "\n"
+        "                E operator*() const noexcept\n"
+        "                {\n"
+        "                    return static_cast<E>((m_uWord * 64) + uWordLowBit(m_uCurBits));\n"
+        "                }\n"
+        "\n"
+        "                Iterator& operator++() noexcept\n"
+        "                {\n"
+        "                    m_uCurBits &= m_uCurBits - 1;\n"
+        "                    SkipEmpty();\n"
+        "                    return *this;\n"
+        "                }\n"
+        "\n"
+        "                bool operator==(const Iterator& itSrc) const noexcept\n"
+        "                {\n"
+        "                    return (m_uWord == itSrc.m_uWord) && (m_uCurBits == itSrc.m_uCurBits);\n"
+        "                }\n"
+        "\n"
+        "                bool operator!=(const Iterator& itSrc) const noexcept\n"
+        "                {\n"
+        "                    return !operator==(itSrc);\n"
+        "                }\n"
+        "\n"
+        "            private :\n"
+        "                void SkipEmpty() noexcept\n"
+        "                {\n"
+        "                    while (!m_uCurBits && (m_uWord < c_uWords))\n"
+        "                    {\n"
+        "                        if (++m_uWord < c_uWords)\n"
+        "                        {\n"
+        "                            m_uCurBits = m_pauWords[m_uWord];\n"
+        "                        }\n"
+        "                    }\n"
+        "                }\n"
+        "\n"
+        "                const uint64_t* m_pauWords;\n"
+        "                uint32_t        m_uWord;\n"
+        "                uint64_t        m_uCurBits;\n"
+        "        };\n"
+        "\n"
+        "        //\n"
+        "        //  Parse a list of value names separated by | characters, as created by\n"
+        "        //  strFormat(). An empty string is an empty set.\n"
+        "        //\n"
+        "        static bool bParse(const std::wstring_view& svText, FlagSet& fsetToFill)\n"
+        "        {\n"
+        "            FlagSet fsetRet;\n"
+        "            std::wstring strName;\n"
+        "            E eVal;\n"
+        "            size_t szStart = 0;\n"
+        "            while (szStart <= svText.size())\n"
+        "            {\n"
+        "                size_t szEnd = svText.find(L'|', szStart);\n"
+        "                if (szEnd == std::wstring_view::npos)\n"
+        "                {\n"
+        "                    szEnd = svText.size();\n"
+        "                }\n"
+        "\n"
+        "                // Get the name out, without any leading or trailing space\n"
+        "                strName.assign(svText.substr(szStart, szEnd - szStart));\n"
+        "                const size_t szFirst = strName.find_first_not_of(L\" \\t\");\n"
+        "                const size_t szLast = strName.find_last_not_of(L\" \\t\");\n"
+        "                if (szFirst == std::wstring::npos)\n"
+        "                {\n"
+        "                    strName.clear();\n"
+        "                }\n"
+        "                else\n"
+        "                {\n"
+        "                    strName = strName.substr(szFirst, (szLast - szFirst) + 1);\n"
+        "                }\n"
+        "\n"
+        "                if (!strName.empty())\n"
+        "                {\n"
+        "                    if (!bNameToEnum(strName, eVal))\n"
+        "                    {\n"
+        "                        return false;\n"
+        "                    }\n"
+        "                    fsetRet.Set(eVal);\n"
+        "                }\n"
+        "                else if ((szEnd != svText.size()) || (szStart != 0))\n"
+        "                {\n"
+        "                    // An empty name is only valid for an empty list\n"
+        "                    return false;\n"
+        "                }\n"
+        "                szStart = szEnd + 1;\n"
+        "            }\n"
+        "            fsetToFill = fsetRet;\n"
+        "            return true;\n"
+        "        }\n"
+        "\n"
+        "        constexpr FlagSet() noexcept = default;\n"
+        "\n"
+        "        FlagSet(const std::initializer_list<E> ilBits) noexcept\n"
+        "        {\n"
+        "            for (const E eBit : ilBits)\n"
+        "            {\n"
+        "                Set(eBit);\n"
+        "            }\n"
+        "        }\n"
+        "\n"
+        "        bool operator==(const FlagSet& fsetSrc) const noexcept\n"
+        "        {\n"
+        "            return !bAnyWordBits<EWordOps::Xor>(m_auWords, fsetSrc.m_auWords, c_uWords);\n"
+        "        }\n"
+        "\n"
+        "        bool operator!=(const FlagSet& fsetSrc) const noexcept\n"
+        "        {\n"
+        "            return !operator==(fsetSrc);\n"
+        "        }\n"
+        "\n"
+        "        FlagSet& operator&=(const FlagSet& fsetSrc) noexcept\n"
+        "        {\n"
+        "            CombineWords<EWordOps::And>(m_auWords, fsetSrc.m_auWords, c_uWords);\n"
+        "            return *this;\n"
+        "        }\n"
+        "\n"
+        "        FlagSet& operator|=(const FlagSet& fsetSrc) noexcept\n"
+        "        {\n"
+        "            CombineWords<EWordOps::Or>(m_auWords, fsetSrc.m_auWords, c_uWords);\n"
+        "            return *this;\n"
+        "        }\n"
+        "\n"
+        "        FlagSet& operator^=(const FlagSet& fsetSrc) noexcept\n"
+        "        {\n"
+        "            CombineWords<EWordOps::Xor>(m_auWords, fsetSrc.m_auWords, c_uWords);\n"
+        "            return *this;\n"
+        "        }\n"
+        "\n"
+        "        FlagSet operator&(const FlagSet& fsetSrc) const noexcept\n"
+        "        {\n"
+        "            FlagSet fsetRet(*this);\n"
+        "            fsetRet &= fsetSrc;\n"
+        "            return fsetRet;\n"
+        "        }\n"
+        "\n"
+        "        FlagSet operator|(const FlagSet& fsetSrc) const noexcept\n"
+        "        {\n"
+        "            FlagSet fsetRet(*this);\n"
+        "            fsetRet |= fsetSrc;\n"
+        "            return fsetRet;\n"
+        "        }\n"
+        "\n"
+        "        FlagSet operator^(const FlagSet& fsetSrc) const noexcept\n"
+        "        {\n"
+        "            FlagSet fsetRet(*this);\n"
+        "            fsetRet ^= fsetSrc;\n"
+        "            return fsetRet;\n"
+        "        }\n"
+        "\n"
+        "        // Flips all of the defined bits, leaving any unused high bits off\n"
+        "        FlagSet operator~() const noexcept\n"
+        "        {\n"
+        "            FlagSet fsetRet;\n"
+        "            fsetRet.SetAll();\n"
+        "            fsetRet.AndNot(*this);\n"
+        "            return fsetRet;\n"
+        "        }\n"
+        "\n"
+        "        // True if all of the defined bits are on\n"
+        "        bool bAll() const noexcept\n"
+        "        {\n"
+        "            return !bAnyWordBits<EWordOps::AndNot>(s_auAllWords.data(), m_auWords, c_uWords);\n"
+        "        }\n"
+        "\n"
+        "        // True if all of the bits on in fsetTest are on in this set\n"
+        "        bool bAllOf(const FlagSet& fsetTest) const noexcept\n"
+        "        {\n"
+        "            return !bAnyWordBits<EWordOps::AndNot>(fsetTest.m_auWords, m_auWords, c_uWords);\n"
+        "        }\n"
+        "\n"
+        "        bool bAny() const noexcept\n"
+        "        {\n"
+        "            return bAnyWordBits<EWordOps::Or>(m_auWords, m_auWords, c_uWords);\n"
+        "        }\n"
+        "\n"
+        "        // True if any of the bits on in fsetTest are on in this set\n"
+        "        bool bAnyOf(const FlagSet& fsetTest) const noexcept\n"
+        "        {\n"
+        "            return bAnyWordBits<EWordOps::And>(m_auWords, fsetTest.m_auWords, c_uWords);\n"
+        "        }\n"
+        "\n"
+        "        bool bIsSet(const E eBit) const noexcept\n"
+        "        {\n"
+        "            const uint32_t uBit = static_cast<uint32_t>(eBit);\n"
+        "            return (uBit < uBits) && ((m_auWords[uBit / 64] >> (uBit % 64)) & 1);\n"
+        "        }\n"
+        "\n"
+        "        bool bNone() const noexcept\n"
+        "        {\n"
+        "            return !bAny();\n"
+        "        }\n"
+        "\n"
+        "        Iterator begin() const noexcept\n"
+        "        {\n"
+        "            return Iterator(m_auWords, 0);\n"
+        "        }\n"
+        "\n"
+        "        Iterator end() const noexcept\n"
+        "        {\n"
+        "            return Iterator(m_auWords, c_uWords);\n"
+        "        }\n"
+        "\n"
+        "        // Turn off any bits that are on in the source\n"
+        "        FlagSet& AndNot(const FlagSet& fsetSrc) noexcept\n"
+        "        {\n"
+        "            CombineWords<EWordOps::AndNot>(m_auWords, fsetSrc.m_auWords, c_uWords);\n"
+        "            return *this;\n"
+        "        }\n"
+        "\n"
+        "        void Clear(const E eBit) noexcept\n"
+        "        {\n"
+        "            const uint32_t uBit = static_cast<uint32_t>(eBit);\n"
+        "            if (uBit < uBits)\n"
+        "            {\n"
+        "                m_auWords[uBit / 64] &= ~(1ULL << (uBit % 64));\n"
+        "            }\n"
+        "        }\n"
+        "\n"
+        "        void ClearAll() noexcept\n"
+        "        {\n"
+        "            *this = FlagSet();\n"
+        "        }\n"
+        "\n"
+        "        const uint64_t* pauWords() const noexcept\n"
+        "        {\n"
+        "            return m_auWords;\n"
+        "        }\n"
+        "\n"
+        "        void Set(const E eBit) noexcept\n"
+        "        {\n"
+        "            const uint32_t uBit = static_cast<uint32_t>(eBit);\n"
+        "            if (uBit < uBits)\n"
+        "            {\n"
+        "                m_auWords[uBit / 64] |= (1ULL << (uBit % 64));\n"
+        "            }\n"
+        "        }\n"
+        "\n"
+        "        void SetAll() noexcept\n"
+        "        {\n"
+        "            for (uint32_t uIndex = 0; uIndex < c_uWords; uIndex++)\n"
+        "            {\n"
+        "                m_auWords[uIndex] = s_auAllWords[uIndex];\n"
+        "            }\n"
+        "        }\n"
+        "\n"
+        "        // Format out the names of the bits that are on, separated by | characters\n"
+        "        std::wstring strFormat() const\n"
+        "        {\n"
+        "            std::wstring strRet;\n"
+        "            for (const E eBit : *this)\n"
+        "            {\n"
+        "                if (!strRet.empty())\n"
+        "                {\n"
+        "                    strRet.push_back(L'|');\n"
+        "                }\n"
+        "                strRet.append(pszEnumToName(eBit));\n"
+        "            }\n"
+        "            return strRet;\n"
+        "        }\n"
+        "\n"
+        "        uint32_t uCount() const noexcept\n"
+        "        {\n"
+        "            uint32_t uRet = 0;\n"
+        "            for (uint32_t uIndex = 0; uIndex < c_uWords; uIndex++)\n"
+        "            {\n"
+        "                uRet += uWordBitCount(m_auWords[uIndex]);\n"
+        "            }\n"
+        "            return uRet;\n"
+        "        }\n"
+        "\n"
+        "\n"
+        "    private :\n"
+        "        // The words with only the defined bits on\n"
+        "        static constexpr std::array<uint64_t, c_uWords> s_auAllWords = auFlagSetMask<uBits>();\n"
+        "\n"
+        "        uint64_t    m_auWords[c_uWords] = {};\n"
+        "};\n"
+    };
+
+    constexpr const char* const pszHdrBitmap =
+    {
+        "\n"
+        "//\n"
+        "//  Support for the list versions of the Bitmap enum validity checks. This ORs\n"
+        "//  together all of the values in a list, a vector at a time where the target\n"
+        "//  supports it, so that they can be checked against the valid bits all at once.\n"
+        "//\n"
+        "template <typename E>\n"
+        "inline std::underlying_type_t<E> uOrAllBits(const E* const peList, const size_t szCount) noexcept\n"
+        "{\n"
+        "    using UnderType = std::underlying_type_t<E>;\n"
+        "    static_assert(sizeof(E) == sizeof(UnderType), \"Enum and underlying type sizes differ\");\n"
+        "\n"
+        "    UnderType uRet = 0;\n"
+        "    size_t szIndex = 0;\n"
+        "#if defined(__AVX2__)\n"
+        "    constexpr size_t c_szPerVec = 32 / sizeof(UnderType);\n"
+        "    if (szCount >= c_szPerVec)\n"
+        "    {\n"
+        "        __m256i vecAccum = _mm256_setzero_si256();\n"
+        "        for (; szIndex + c_szPerVec <= szCount; szIndex += c_szPerVec)\n"
+        "        {\n"
+        "            vecAccum = _mm256_or_si256\n"
+        "            (\n"
+        "                vecAccum, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(peList + szIndex))\n"
+        "            );\n"
+        "        }\n"
+        "        UnderType auLanes[c_szPerVec];\n"
+        "        _mm256_storeu_si256(reinterpret_cast<__m256i*>(auLanes), vecAccum);\n"
+        "        for (const UnderType uLane : auLanes)\n"
+        "        {\n"
+        "            uRet |= uLane;\n"
+        "        }\n"
+        "    }\n"
+        "#elif defined(CQENUM_SIMD_SSE2)\n"
+        "    constexpr size_t c_szPerVec = 16 / sizeof(UnderType);\n"
+        "    if (szCount >= c_szPerVec)\n"
+        "    {\n"
+        "        __m128i vecAccum = _mm_setzero_si128();\n"
+        "        for (; szIndex + c_szPerVec <= szCount; szIndex += c_szPerVec)\n"
+        "        {\n"
+        "            vecAccum = _mm_or_si128\n"
+        "            (\n"
+        "                vecAccum, _mm_loadu_si128(reinterpret_cast<const __m128i*>(peList + szIndex))\n"
+        "            );\n"
+        "        }\n"
+        "        UnderType auLanes[c_szPerVec];\n"
+        "        _mm_storeu_si128(reinterpret_cast<__m128i*>(auLanes), vecAccum);\n"
+        "        for (const UnderType uLane : auLanes)\n"
+        "        {\n"
+        "            uRet |= uLane;\n"
+        "        }\n"
+        "    }\n"
+        "#endif\n"
+        "    for (; szIndex < szCount; szIndex++)\n"
+        "    {\n"
+        "        uRet |= static_cast<UnderType>(peList[szIndex]);\n"
+        "    }\n"
+        "    return uRet;\n"
+        "}\n"
+        "\n"
+        "//\n"
+        "//  Returns true if every value in the list has exactly one bit on. It doesn't\n"
+        "//  branch per value, so that the compiler can vectorize it.\n"
+        "//\n"
+        "template <typename E>\n"
+        "inline bool bAllSingleBits(const E* const peList, const size_t szCount) noexcept\n"
+        "{\n"
+        "    using UnsignedType = std::make_unsigned_t<std::underlying_type_t<E>>;\n"
+        "    UnsignedType uMultiBits = 0;\n"
+        "    bool bAnyZero = false;\n"
+        "    for (size_t szIndex = 0; szIndex < szCount; szIndex++)\n"
+        "    {\n"
+        "        const UnsignedType uCur = static_cast<UnsignedType>(peList[szIndex]);\n"
+        "        uMultiBits |= static_cast<UnsignedType>(uCur & (uCur - 1));\n"
+        "        bAnyZero |= (uCur == 0);\n"
+        "    }\n"
+        "    return !uMultiBits && !bAnyZero;\n"
+        "}\n"
+        "\n"
+        "//\n"
+        "//  The generator specializes this for each Bitmap enum, with the mask of all of\n"
+        "//  its bits and how many there are. The generated uCombinationIndex() compacts\n"
+        "//  the defined bits of a value down into a dense index of that many bits.\n"
+        "//\n"
+        "template <typename E> struct BitmapCombos;\n"
+        "\n"
+        "//\n"
+        "//  A table with an entry per combination of the bits of a Bitmap enum, indexed\n"
+        "//  by the dense combination index, so a lookup is one compaction and one load.\n"
+        "//  Bits that aren't defined for the enum are ignored. It's stored inline, so it\n"
+        "//  is limited to 16 bits, i.e. 64K entries.\n"
+        "//\n"
+        "template <typename E, typename T> class EnumComboTable\n"
+        "{\n"
+        "    public :\n"
+        "        static constexpr uint32_t c_uBits = BitmapCombos<E>::c_uBits;\n"
+        "        static_assert(c_uBits <= 16, \"Combination tables are limited to enums of 16 bits\");\n"
+        "        static constexpr uint32_t c_uSize = 1UL << c_uBits;\n"
+        "\n"
+        "        EnumComboTable() = default;\n"
+        "\n"
+        "        explicit EnumComboTable(const T& tInit)\n"
+        "        {\n"
+        "            m_atEntries.fill(tInit);\n"
+        "        }\n"
+        "\n"
+        "        // Get the combination of bits for a dense combination index\n"
+        "        static constexpr E eCombination(const uint32_t uIndex) noexcept\n"
+        "        {\n"
+        "            uint32_t uMask = BitmapCombos<E>::c_uMask;\n"
+        "            uint32_t uRet = 0;\n"
+        "            for (uint32_t uBit = 1; uMask; uBit <<= 1)\n"
+        "            {\n"
+        "                const uint32_t uLow = uMask & (0 - uMask);\n"
+        "                if (uIndex & uBit)\n"
+        "                {\n"
+        "                    uRet |= uLow;\n"
+        "                }\n"
+        "                uMask ^= uLow;\n"
+        "            }\n"
+        "            return static_cast<E>(uRet);\n"
+        "        }\n"
+        "\n"
+        "        T& operator[](const E eBits) noexcept\n"
+        "        {\n"
+        "            return m_atEntries[uCombinationIndex(eBits)];\n"
+        "        }\n"
+        "\n"
+        "        const T& operator[](const E eBits) const noexcept\n"
+        "        {\n"
+        "            return m_atEntries[uCombinationIndex(eBits)];\n"
+        "        }\n"
+        "\n"
+        "        T* begin() noexcept { return m_atEntries.data(); }\n"
+        "        T* end() noexcept { return m_atEntries.data() + c_uSize; }\n"
+        "        const T* begin() const noexcept { return m_atEntries.data(); }\n"
+        "        const T* end() const noexcept { return m_atEntries.data() + c_uSize; }\n"
+        "\n"
+        "    private :\n"
+        "        std::array<T, c_uSize>  m_atEntries = {};\n"
+        "};\n"
+    };
+
+    constexpr const char* const pszHdrTransitions =
+    {
+        "\n"
+        "//\n"
+        "//  Support for enums with a Transitions= block. The generator creates a bit\n"
+        "//  matrix with a row of 64 bit words per value (in defined order), with a bit\n"
+        "//  on for each value that can be moved to from that one. This iterates the\n"
+        "//  bits that are on in a row, i.e. the successors of a value. It is also used\n"
+        "//  to iterate the members of value groups, which are a single such row.\n"
+        "//\n"
+        "template <typename E, uint32_t uWords> class SuccessorRange\n"
+        "{\n"
+        "    public :\n"
+        "        class Iterator\n"
+        "        {\n"
+        "            public :\n"
+        "                Iterator(const uint64_t* const pauRow, const uint32_t uWord) noexcept :\n"
+        "\n"
+        "                    m_pauRow(pauRow)\n"
+        "                    , m_uWord(uWord)\n"
+        "                    , m_uCurBits((uWord < uWords) ? pauRow[uWord] : 0)\n"
+        "                {\n"
+        "                    SkipEmpty();\n"
+        "                }\n"
+        "\n"
+        "                E operator*() const noexcept\n"
+        "                {\n"
+        "                    return EnumValueList<E>::s_aeValues[(m_uWord * 64) + uWordLowBit(m_uCurBits)];\n"
+        "                }\n"
+        "\n"
+        "                Iterator& operator++() noexcept\n"
+        "                {\n"
+        "                    m_uCurBits &= m_uCurBits - 1;\n"
+        "                    SkipEmpty();\n"
+        "                    return *this;\n"
+        "                }\n"
+        "\n"
+        "                bool operator==(const Iterator& itSrc) const noexcept\n"
+        "                {\n"
+        "                    return (m_uWord == itSrc.m_uWord) && (m_uCurBits == itSrc.m_uCurBits);\n"
+        "                }\n"
+        "\n"
+        "                bool operator!=(const Iterator& itSrc) const noexcept\n"
+        "                {\n"
+        "                    return !operator==(itSrc);\n"
+        "                }\n"
+        "\n"
+        "            private :\n"
+        "                void SkipEmpty() noexcept\n"
+        "                {\n"
+        "                    while (!m_uCurBits && (m_uWord < uWords))\n"
+        "                    {\n"
+        "                        if (++m_uWord < uWords)\n"
+        "                        {\n"
+        "                            m_uCurBits = m_pauRow[m_uWord];\n"
+        "                        }\n"
+        "                    }\n"
+        "                }\n"
+        "\n"
+        "                const uint64_t* m_pauRow;\n"
+        "                uint32_t        m_uWord;\n"
+        "                uint64_t        m_uCurBits;\n"
+        "        };\n"
+        "\n"
+        "        // A null row (for an invalid value) is an empty range\n"
+        "        explicit SuccessorRange(const uint64_t* const pauRow) noexcept :\n"
+        "\n"
+        "            m_pauRow(pauRow)\n"
+        "        {\n"
+        "        }\n"
+        "\n"
+        "        Iterator begin() const noexcept\n"
+        "        {\n"
+        "            return Iterator(m_pauRow, m_pauRow ? 0 : uWords);\n"
+        "        }\n"
+        "\n"
+        "        Iterator end() const noexcept\n"
+        "        {\n"
+        "            return Iterator(m_pauRow, uWords);\n"
+        "        }\n"
+        "\n"
+        "        bool bIsEmpty() const noexcept\n"
+        "        {\n"
+        "            return begin() == end();\n"
+        "        }\n"
+        "\n"
+        "        uint32_t uCount() const noexcept\n"
+        "        {\n"
+        "            uint32_t uRet = 0;\n"
+        "            for (uint32_t uIndex = 0; m_pauRow && (uIndex < uWords); uIndex++)\n"
+        "            {\n"
+        "                uRet += uWordBitCount(m_pauRow[uIndex]);\n"
+        "            }\n"
+        "            return uRet;\n"
+        "        }\n"
+        "\n"
+        "    private :\n"
+        "        const uint64_t* m_pauRow;\n"
+        "};\n"
+    };
+
+    constexpr const char* const pszHdrCounters =
+    {
+        "\n"
+        "//\n"
+        "//  Per-value counters that can be bumped from many threads. The counts are\n"
+        "//  spread over a set of shards, each on its own cache lines, and each thread\n"
+        "//  is assigned a shard round robin the first time it counts. So threads don't\n"
+        "//  bounce the same lines around (unless there are more threads than shards.)\n"
+        "//  Increment() is the hot path, Snapshot() sums the shards and is meant to be\n"
+        "//  called occasionally.\n"
+        "//\n"
+        "constexpr uint32_t c_uCacheLineSize = 64;\n"
+        "\n"
+        "inline uint32_t uCounterShard() noexcept\n"
+        "{\n"
+        "    static std::atomic<uint32_t> s_uNextShard(0);\n"
+        "    thread_local const uint32_t t_uShard = s_uNextShard.fetch_add(1, std::memory_order_relaxed);\n"
+        "    return t_uShard;\n"
+        "}\n"
+        "\n"
+        "template <typename E, uint32_t uShards = 16> class EnumCounters\n"
+        "{\n"
+        "    public :\n"
+        "        static_assert(uShards > 0, \"Enum counters must have at least one shard\");\n"
+        "\n"
+        "        static constexpr uint32_t c_uCount = EnumValueList<E>::c_uCount;\n"
+        "        static constexpr uint32_t c_uShards = uShards;\n"
+        "\n"
+        "        using CountList = std::array<uint64_t, c_uCount>;\n"
+        "\n"
+        "        EnumCounters() noexcept = default;\n"
+        "\n"
+        "        EnumCounters(const EnumCounters&) = delete;\n"
+        "        EnumCounters& operator=(const EnumCounters&) = delete;\n"
+        "\n"
+        "        // Invalid values are ignored\n"
+        "        void Increment(const E eVal, const uint64_t uBy = 1) noexcept\n"
+        "        {\n"
+        "            const uint32_t uIndex = uEnumToIndex(eVal);\n"
+        "            if (uIndex < c_uCount)\n"
+        "            {\n"
+        "                m_ashardList[uCounterShard() % uShards].auCounts[uIndex].fetch_add\n"
+        "                (\n"
+        "                    uBy, std::memory_order_relaxed\n"
+        "                );\n"
+        "            }\n"
+        "        }\n"
+        "\n"
+        "        // The counts of all values, by dense index\n"
+        "        CountList Snapshot() const noexcept\n"
+        "        {\n"
+        "            CountList auRet = {};\n"
+        "            for (const Shard& shardCur : m_ashardList)\n"
+        "            {\n"
+        "                for (uint32_t uIndex = 0; uIndex < c_uCount; uIndex++)\n"
+        "                {\n"
+        "                    auRet[uIndex] += shardCur.auCounts[uIndex].load(std::memory_order_relaxed);\n"
+        "                }\n"
+        "            }\n"
+        "            return auRet;\n"
+        "        }\n"
+        "\n"
+        "        uint64_t uValue(const E eVal) const noexcept\n"
+        "        {\n"
+        "            uint64_t uRet = 0;\n"
+        "            const uint32_t uIndex = uEnumToIndex(eVal);\n"
+        "            if (uIndex < c_uCount)\n"
+        "            {\n"
+        "                for (const Shard& shardCur : m_ashardList)\n"
+        "                {\n"
+        "                    uRet += shardCur.auCounts[uIndex].load(std::memory_order_relaxed);\n"
+        "                }\n"
+        "            }\n"
+        "            return uRet;\n"
+        "        }\n"
+        "\n"
+        "        // Not atomic wrt to concurrent increments, which may or may not be kept\n"
+        "        void Reset() noexcept\n"
+        "        {\n"
+        "            for (Shard& shardCur : m_ashardList)\n"
+        "            {\n"
+        "                for (std::atomic<uint64_t>& uCur : shardCur.auCounts)\n"
+        "                {\n"
+        "                    uCur.store(0, std::memory_order_relaxed);\n"
+        "                }\n"
+        "            }\n"
+        "        }\n"
+        "\n"
+        "    private :\n"
+        "        struct alignas(c_uCacheLineSize) Shard\n"
+        "        {\n"
+        "            std::atomic<uint64_t>   auCounts[c_uCount] = {};\n"
+        "        };\n"
+        "\n"
+        "        Shard   m_ashardList[uShards];\n"
+        "};\n"
+    };
+
+    constexpr const char* const pszHdrLazyTable =
+    {
+        "\n"
+        "//\n"
+        "//  A table with a lazily created entry per value, for caching something that is\n"
+        "//  expensive to create, by dense index. Each slot is created once, on first use,\n"
+        "//  by the init function passed to Get(). Each slot has its own state, so first\n"
+        "//  uses of different values don't hold each other up, and once a slot is ready\n"
+        "//  reading it is just an acquire load, with no locks.\n"
+        "//\n"
+        "//  If two threads ask for the same new slot, one creates it and the other waits\n"
+        "//  for it. If the init function throws, the slot is left empty, and the next\n"
+        "//  access will try again.\n"
+        "//\n"
+        "template <typename E, typename T> class LazyEnumTable\n"
+        "{\n"
+        "    public :\n"
+        "        static constexpr uint32_t c_uCount = EnumValueList<E>::c_uCount;\n"
+        "\n"
+        "        LazyEnumTable() noexcept = default;\n"
+        "\n"
+        "        LazyEnumTable(const LazyEnumTable&) = delete;\n"
+        "        LazyEnumTable& operator=(const LazyEnumTable&) = delete;\n"
+        "\n"
+        "        ~LazyEnumTable()\n"
+        "        {\n"
+        "            for (Slot& slotCur : m_aslotList)\n"
+        "            {\n"
+        "                if (slotCur.uState.load(std::memory_order_relaxed) == c_uReady)\n"
+        "                {\n"
+        "                    slotCur.pValue()->~T();\n"
+        "                }\n"
+        "            }\n"
+        "        }\n"
+        "\n"
+        "        // The init function is called with the value if it accepts it, else no parameters\n"
+        "        template <typename F> const T& Get(const E eVal, F&& fnInit)\n"
+        "        {\n"
+        "            Slot& slotTar = slotFor(eVal);\n"
+        "            if (slotTar.uState.load(std::memory_order_acquire) != c_uReady)\n"
+        "            {\n"
+        "                Create(slotTar, eVal, std::forward<F>(fnInit));\n"
+        "            }\n"
+        "            return *slotTar.pValue();\n"
+        "        }\n"
+        "\n"
+        "        // Returns null if the slot for the value has not been created yet\n"
+        "        const T* pFind(const E eVal) const noexcept\n"
+        "        {\n"
+        "            const uint32_t uIndex = uEnumToIndex(eVal);\n"
+        "            if ((uIndex >= c_uCount)\n"
+        "            ||  (m_aslotList[uIndex].uState.load(std::memory_order_acquire) != c_uReady))\n"
+        "            {\n"
+        "                return nullptr;\n"
+        "            }\n"
+        "            return m_aslotList[uIndex].pValue();\n"
+        "        }\n"
+        "\n"
+        "        bool bIsReady(const E eVal) const noexcept\n"
+        "        {\n"
+        "            return pFind(eVal) != nullptr;\n"
+        "        }\n"
+        "\n"
+        "    private :\n"
+        "        static constexpr uint8_t c_uEmpty = 0;\n"
+        "        static constexpr uint8_t c_uBusy = 1;\n"
+        "        static constexpr uint8_t c_uReady = 2;\n"
+        "\n"
+        "        struct Slot\n"
+        "        {\n"
+        "            T* pValue() noexcept { return std::launder(reinterpret_cast<T*>(abStorage)); }\n"
+        "            const T* pValue() const noexcept { return std::launder(reinterpret_cast<const T*>(abStorage)); }\n"
+        "\n"
+        "            std::atomic<uint8_t>            uState{ c_uEmpty };\n"
+        "            alignas(T) unsigned char        abStorage[sizeof(T)];\n"
+        "        };\n"
+        "\n"
+        "        Slot& slotFor(const E eVal)\n"
+        "        {\n"
+        "            const uint32_t uIndex = uEnumToIndex(eVal);\n"
+        "            if (uIndex >= c_uCount)\n"
+        "            {\n"
+        "                throw std::runtime_error(\"An invalid enum value was passed to a lazy enum table\");\n"
+        "            }\n"
+        "            return m_aslotList[uIndex];\n"
+        "        }\n"
+        "\n"
+        "        template <typename F> static void Create(Slot& slotTar, const E eVal, F&& fnInit)\n"
+        "        {\n"
+        "            while (true)\n"
+        "            {\n"
+        "                uint8_t uState = c_uEmpty;\n"
+        "                if (slotTar.uState.compare_exchange_strong(uState, c_uBusy, std::memory_order_acquire))\n"
+        "                {\n"
+        "                    try\n"
+        "                    {\n"
+        "                        if constexpr (std::is_invocable_v<F&, E>)\n"
+        "                        {\n"
+        "                            new (slotTar.abStorage) T(fnInit(eVal));\n"
+        "                        }\n"
+        "                        else\n"
+        "                        {\n"
+        "                            new (slotTar.abStorage) T(fnInit());\n"
+        "                        }\n"
+        "                    }\n"
+        "\n"
+        "                    catch(...)\n"
+        "                    {\n"
+        "                        slotTar.uState.store(c_uEmpty, std::memory_order_release);\n"
+        "                        NotifyAll(slotTar);\n"
+        "                        throw;\n"
+        "                    }\n"
+        "                    slotTar.uState.store(c_uReady, std::memory_order_release);\n"
+        "                    NotifyAll(slotTar);\n"
+        "                    return;\n"
+        "                }\n"
+        "\n"
+        "                // If it's ready, we are done, else someone else is creating it, so wait\n"
+        "                if (uState == c_uReady)\n"
+        "                {\n"
+        "                    return;\n"
+        "                }\n"
+        "#if defined(__cpp_lib_atomic_wait)\n"
+        "                slotTar.uState.wait(c_uBusy, std::memory_order_acquire);\n"
+        "#else\n"
+        "                while (slotTar.uState.load(std::memory_order_acquire) == c_uBusy)\n"
+        "                {\n"
+        "                    std::this_thread::yield();\n"
+        "                }\n"
+        "#endif\n"
+        "                if (slotTar.uState.load(std::memory_order_acquire) == c_uReady)\n"
+        "                {\n"
+        "                    return;\n"
+        "                }\n"
+        "            }\n"
+        "        }\n"
+        "\n"
+        "        static void NotifyAll(Slot& slotTar) noexcept\n"
+        "        {\n"
+        "#if defined(__cpp_lib_atomic_wait)\n"
+        "            slotTar.uState.notify_all();\n"
+        "#else\n"
+        "            (void)slotTar;\n"
+        "#endif\n"
+        "        }\n"
+        "\n"
+        "        Slot    m_aslotList[c_uCount];\n"
+        "};\n"
+    };
+
+    constexpr const char* const pszHdrBuckets =
+    {
+        "\n"
+        "//\n"
+        "//  Helpers for bucketing lists of things by an enum key, e.g. records with an\n"
+        "//  enum field. The key function gets the enum value from an item, and the item\n"
+        "//  type can just be the enum itself, in which case the key function can be left\n"
+        "//  out. Since the dense index and value count are known, these are linear, a\n"
+        "//  counting pass and a placement pass, instead of comparison sorts.\n"
+        "//\n"
+        "//  If asked for more than one thread, each pass is split into chunks done on\n"
+        "//  separate threads, each with its own counts, so the results are the same, i.e.\n"
+        "//  stable. Lists too small to be worth it are done on the calling thread. The key\n"
+        "//  function, and copying or moving the items, must not throw on the other threads\n"
+        "//  in that case. On the calling thread, or if a thread can't be created, it just\n"
+        "//  passes on the exception.\n"
+        "//\n"
+        "//  Items with invalid values go into an extra bucket at the end.\n"
+        "//\n"
+        "struct EnumIdentity\n"
+        "{\n"
+        "    template <typename E> constexpr E operator()(const E eVal) const noexcept\n"
+        "    {\n"
+        "        return eVal;\n"
+        "    }\n"
+        "};\n"
+        "\n"
+        "template <typename E> using EnumCountList = std::array<size_t, EnumValueList<E>::c_uCount + 1>;\n"
+        "\n"
+        "//\n"
+        "//  The bucket of a value, by dense index, with invalid values in the extra one at\n"
+        "//  the end. The generated uEnumToIndex() returns the count for those, but we clip\n"
+        "//  it here too, since an out of range index would write past the counts.\n"
+        "//\n"
+        "template <typename E> constexpr uint32_t uBucketIndex(const E eVal) noexcept\n"
+        "{\n"
+        "    return std::min(uEnumToIndex(eVal), EnumValueList<E>::c_uCount);\n"
+        "}\n"
+        "\n"
+        "// The start of each value's run of items in a bucketed list, by dense index\n"
+        "template <typename E> struct EnumBuckets\n"
+        "{\n"
+        "    static constexpr uint32_t c_uCount = EnumValueList<E>::c_uCount;\n"
+        "\n"
+        "    // Invalid values get the bucket of invalid values\n"
+        "    size_t szStart(const E eVal) const noexcept\n"
+        "    {\n"
+        "        return aszStarts[uBucketIndex(eVal)];\n"
+        "    }\n"
+        "\n"
+        "    size_t szCount(const E eVal) const noexcept\n"
+        "    {\n"
+        "        const uint32_t uIndex = uBucketIndex(eVal);\n"
+        "        return aszStarts[uIndex + 1] - aszStarts[uIndex];\n"
+        "    }\n"
+        "\n"
+        "    size_t szInvalidCount() const noexcept\n"
+        "    {\n"
+        "        return aszStarts[c_uCount + 1] - aszStarts[c_uCount];\n"
+        "    }\n"
+        "\n"
+        "    // Then the start of the invalid values, then the end\n"
+        "    std::array<size_t, c_uCount + 2> aszStarts;\n"
+        "};\n"
+        "\n"
+        "// The minimum items per thread when bucketing on multiple threads\n"
+        "constexpr size_t c_szMinBucketChunk = 16384;\n"
+        "\n"
+        "inline uint32_t uBucketChunks(const size_t szCount, const uint32_t uThreads) noexcept\n"
+        "{\n"
+        "    const size_t szMaxChunks = std::max(szCount / c_szMinBucketChunk, size_t(1));\n"
+        "    return static_cast<uint32_t>(std::min(static_cast<size_t>(std::max(uThreads, 1U)), szMaxChunks));\n"
+        "}\n"
+        "\n"
+        "//\n"
+        "//  Call the chunk function for each chunk of the list, with the extra ones on other\n"
+        "//  threads. If a thread can't be created, or our own chunk throws, we join the ones\n"
+        "//  already started before passing the exception on, since destroying a joinable\n"
+        "//  thread would terminate the program.\n"
+        "//\n"
+        "template <typename F> void RunBucketChunks(const size_t szCount, const uint32_t uChunks, F&& fnChunk)\n"
+        "{\n"
+        "    if (uChunks == 1)\n"
+        "    {\n"
+        "        fnChunk(0, size_t(0), szCount);\n"
+        "        return;\n"
+        "    }\n"
+        "\n"
+        "    std::vector<std::thread> vThreads;\n"
+        "    try\n"
+        "    {\n"
+        "        vThreads.reserve(uChunks - 1);\n"
+        "        for (uint32_t uChunk = 1; uChunk < uChunks; uChunk++)\n"
+        "        {\n"
+        "            vThreads.emplace_back\n"
+        "            (\n"
+        "                [&fnChunk, uChunk, szCount, uChunks]()\n"
+        "                {\n"
+        "                    fnChunk(uChunk, (szCount * uChunk) / uChunks, (szCount * (uChunk + 1)) / uChunks);\n"
+        "                }\n"
+        "            );\n"
+        "        }\n"
+        "        fnChunk(0, size_t(0), szCount / uChunks);\n"
+        "    }\n"
+        "\n"
+        "    catch(...)\n"
+        "    {\n"
+        "        for (std::thread& thrCur : vThreads)\n"
+        "        {\n"
+        "            thrCur.join();\n"
+        "        }\n"
+        "        throw;\n"
+        "    }\n"
+        "\n"
+        "    for (std::thread& thrCur : vThreads)\n"
+        "    {\n"
+        "        thrCur.join();\n"
+        "    }\n"
+        "}\n"
+        "\n"
+        "//\n"
+        "//  The core of the bucketing. It counts each chunk's items per value, then turns\n"
+        "//  those into where each chunk's items of each value go, and calls the place\n"
+        "//  function with the target and source indices of each item.\n"
+        "//\n"
+        "template <typename E, typename It, typename KF, typename PF>\n"
+        "EnumBuckets<E> BucketItems(const It itBegin, const size_t szCount, KF& fnKey, PF&& fnPlace, const uint32_t uThreads)\n"
+        "{\n"
+        "    constexpr uint32_t c_uCount = EnumValueList<E>::c_uCount;\n"
+        "    const uint32_t uChunks = uBucketChunks(szCount, uThreads);\n"
+        "    std::vector<EnumCountList<E>> vCounts(uChunks);\n"
+        "    RunBucketChunks\n"
+        "    (\n"
+        "        szCount\n"
+        "        , uChunks\n"
+        "        , [&](const uint32_t uChunk, const size_t szFrom, const size_t szTo)\n"
+        "          {\n"
+        "              EnumCountList<E>& aszCounts = vCounts[uChunk];\n"
+        "              for (size_t szIndex = szFrom; szIndex < szTo; szIndex++)\n"
+        "              {\n"
+        "                  aszCounts[uBucketIndex(fnKey(itBegin[szIndex]))]++;\n"
+        "              }\n"
+        "          }\n"
+        "    );\n"
+        "\n"
+        "    EnumBuckets<E> bktsRet;\n"
+        "    size_t szAt = 0;\n"
+        "    for (uint32_t uIndex = 0; uIndex <= c_uCount; uIndex++)\n"
+        "    {\n"
+        "        bktsRet.aszStarts[uIndex] = szAt;\n"
+        "        for (EnumCountList<E>& aszCounts : vCounts)\n"
+        "        {\n"
+        "            const size_t szCur = aszCounts[uIndex];\n"
+        "            aszCounts[uIndex] = szAt;\n"
+        "            szAt += szCur;\n"
+        "        }\n"
+        "    }\n"
+        "    bktsRet.aszStarts[c_uCount + 1] = szAt;\n"
+        "\n"
+        "    RunBucketChunks\n"
+        "    (\n"
+        "        szCount\n"
+        "        , uChunks\n"
+        "        , [&](const uint32_t uChunk, const size_t szFrom, const size_t szTo)\n"
+        "          {\n"
+        "              EnumCountList<E>& aszAts = vCounts[uChunk];\n"
+        "              for (size_t szIndex = szFrom; szIndex < szTo; szIndex++)\n"
+        "              {\n"
+        "                  fnPlace(aszAts[uBucketIndex(fnKey(itBegin[szIndex]))]++, szIndex);\n"
+        "              }\n"
+        "          }\n"
+        "    );\n"
+        "    return bktsRet;\n"
+        "}\n"
+        "\n"
+        "template <typename It, typename KF> using BucketKeyType = std::decay_t\n"
+        "<\n"
+        "    std::invoke_result_t<KF&, typename std::iterator_traits<It>::reference>\n"
+        ">;\n"
+        "\n"
+        "// Count the items per value, by dense index, with invalid values in the extra last slot\n"
+        "template <typename It, typename KF = EnumIdentity, typename E = BucketKeyType<It, KF>>\n"
+        "EnumCountList<E> EnumHistogram(const It itBegin, const It itEnd, KF fnKey = KF(), const uint32_t uThreads = 1)\n"
+        "{\n"
+        "    const size_t szCount = static_cast<size_t>(itEnd - itBegin);\n"
+        "    const uint32_t uChunks = uBucketChunks(szCount, uThreads);\n"
+        "    std::vector<EnumCountList<E>> vCounts(uChunks);\n"
+        "    RunBucketChunks\n"
+        "    (\n"
+        "        szCount\n"
+        "        , uChunks\n"
+        "        , [&](const uint32_t uChunk, const size_t szFrom, const size_t szTo)\n"
+        "          {\n"
+        "              EnumCountList<E>& aszCounts = vCounts[uChunk];\n"
+        "              for (size_t szIndex = szFrom; szIndex < szTo; szIndex++)\n"
+        "              {\n"
+        "                  aszCounts[uBucketIndex(fnKey(itBegin[szIndex]))]++;\n"
+        "              }\n"
+        "          }\n"
+        "    );\n"
+        "\n"
+        "    EnumCountList<E> aszRet = {};\n"
+        "    for (const EnumCountList<E>& aszCounts : vCounts)\n"
+        "    {\n"
+        "        for (size_t szIndex = 0; szIndex < aszRet.size(); szIndex++)\n"
+        "        {\n"
+        "            aszRet[szIndex] += aszCounts[szIndex];\n"
+        "        }\n"
+        "    }\n"
+        "    return aszRet;\n"
+        "}\n"
+        "\n"
+        "//\n"
+        "//  Copy the items to the output list, which must be as big, in the order of their\n"
+        "//  values, keeping the items of each value in their original order.\n"
+        "//\n"
+        "template <typename It, typename ItOut, typename KF = EnumIdentity, typename E = BucketKeyType<It, KF>>\n"
+        "EnumBuckets<E> EnumCountingSort(const It itBegin\n"
+        "                                , const It itEnd\n"
+        "                                , const ItOut itOut\n"
+        "                                , KF fnKey = KF()\n"
+        "                                , const uint32_t uThreads = 1)\n"
+        "{\n"
+        "    return BucketItems<E>\n"
+        "    (\n"
+        "        itBegin\n"
+        "        , static_cast<size_t>(itEnd - itBegin)\n"
+        "        , fnKey\n"
+        "        , [itBegin, itOut](const size_t szTar, const size_t szSrc) { itOut[szTar] = itBegin[szSrc]; }\n"
+        "        , uThreads\n"
+        "    );\n"
+        "}\n"
+        "\n"
+        "//\n"
+        "//  The indices of the items, grouped by their values, in the original order within\n"
+        "//  each group. The items themselves are not moved.\n"
+        "//\n"
+        "template <typename E> struct EnumGroups\n"
+        "{\n"
+        "    ValueRange<size_t> Group(const E eVal) const noexcept\n"
+        "    {\n"
+        "        const size_t* const pszFirst = vIndices.data() + bktsGroups.szStart(eVal);\n"
+        "        return ValueRange<size_t>{ pszFirst, pszFirst + bktsGroups.szCount(eVal) };\n"
+        "    }\n"
+        "\n"
+        "    EnumBuckets<E>      bktsGroups;\n"
+        "    std::vector<size_t> vIndices;\n"
+        "};\n"
+        "\n"
+        "template <typename It, typename KF = EnumIdentity, typename E = BucketKeyType<It, KF>>\n"
+        "EnumGroups<E> EnumGroupBy(const It itBegin, const It itEnd, KF fnKey = KF(), const uint32_t uThreads = 1)\n"
+        "{\n"
+        "    EnumGroups<E> grpsRet;\n"
+        "    grpsRet.vIndices.resize(static_cast<size_t>(itEnd - itBegin));\n"
+        "    size_t* const pszIndices = grpsRet.vIndices.data();\n"
+        "    grpsRet.bktsGroups = BucketItems<E>\n"
+        "    (\n"
+        "        itBegin\n"
+        "        , grpsRet.vIndices.size()\n"
+        "        , fnKey\n"
+        "        , [pszIndices](const size_t szTar, const size_t szSrc) { pszIndices[szTar] = szSrc; }\n"
+        "        , uThreads\n"
+        "    );\n"
+        "    return grpsRet;\n"
+        "}\n"
+        "\n"
+        "// Reorder the items in place by value, keeping the items of each value in order\n"
+        "template <typename It, typename KF = EnumIdentity, typename E = BucketKeyType<It, KF>>\n"
+        "EnumBuckets<E> EnumPartition(const It itBegin, const It itEnd, KF fnKey = KF(), const uint32_t uThreads = 1)\n"
+        "{\n"
+        "    using ItemType = typename std::iterator_traits<It>::value_type;\n"
+        "\n"
+        "    EnumGroups<E> grpsOrder = EnumGroupBy(itBegin, itEnd, fnKey, uThreads);\n"
+        "    std::vector<ItemType> vTmp;\n"
+        "    vTmp.reserve(grpsOrder.vIndices.size());\n"
+        "    for (const size_t szIndex : grpsOrder.vIndices)\n"
+        "    {\n"
+        "        vTmp.push_back(std::move(itBegin[szIndex]));\n"
+        "    }\n"
+        "    std::move(vTmp.begin(), vTmp.end(), itBegin);\n"
+        "    return grpsOrder.bktsGroups;\n"
+        "}\n"
+    };
+
+    constexpr const char* const pszHdrColumn =
+    {
+        "\n"
+        "//\n"
+        "//  Columnar storage of enum values, e.g. a field of millions of rows. The values\n"
+        "//  are stored as their dense indices, in the smallest unsigned type that holds\n"
+        "//  them, so usually one byte per row. Filters return a bitmap with a bit per row\n"
+        "//  (64 rows per word), and histograms are counts by dense index.\n"
+        "//\n"
+        "//  For byte sized columns, equality filters, group filters (for enums of up to 16\n"
+        "//  values) and histograms (for up to 16 values) work a vector at a time where the\n"
+        "//  target supports it. Otherwise they are simple loops over the indices.\n"
+        "//\n"
+        "template <typename E> class EnumColumn\n"
+        "{\n"
+        "    public :\n"
+        "        static constexpr uint32_t c_uCount = EnumValueList<E>::c_uCount;\n"
+        "\n"
+        "        using IndexType = std::conditional_t\n"
+        "        <\n"
+        "            (c_uCount <= 0x100)\n"
+        "            , uint8_t\n"
+        "            , std::conditional_t<(c_uCount <= 0x10000), uint16_t, uint32_t>\n"
+        "        >;\n"
+        "        using CountList = std::array<size_t, c_uCount>;\n"
+        "        using RowBitmap = std::vector<uint64_t>;\n"
+        "\n"
+        "        EnumColumn() = default;\n"
+        "\n"
+        "        // Count the rows on in a row bitmap\n"
+        "        static size_t szRowCount(const RowBitmap& bmpRows) noexcept\n"
+        "        {\n"
+        "            size_t szRet = 0;\n"
+        "            for (const uint64_t uCur : bmpRows)\n"
+        "            {\n"
+        "                szRet += uWordBitCount(uCur);\n"
+        "            }\n"
+        "            return szRet;\n"
+        "        }\n"
+        "\n"
+        "        // Invalid values are rejected, since they can't be stored as an index\n"
+        "        void Append(const E eVal)\n"
+        "        {\n"
+        "            m_vIndices.push_back(uToIndex(eVal));\n"
+        "        }\n"
+        "\n"
+        "        void Set(const size_t szRow, const E eVal)\n"
+        "        {\n"
+        "            m_vIndices.at(szRow) = uToIndex(eVal);\n"
+        "        }\n"
+        "\n"
+        "        E operator[](const size_t szRow) const noexcept\n"
+        "        {\n"
+        "            return EnumValueList<E>::s_aeValues[m_vIndices[szRow]];\n"
+        "        }\n"
+        "\n"
+        "        void Clear() noexcept\n"
+        "        {\n"
+        "            m_vIndices.clear();\n"
+        "        }\n"
+        "\n"
+        "        void Reserve(const size_t szRows)\n"
+        "        {\n"
+        "            m_vIndices.reserve(szRows);\n"
+        "        }\n"
+        "\n"
+        "        size_t szRows() const noexcept\n"
+        "        {\n"
+        "            return m_vIndices.size();\n"
+        "        }\n"
+        "\n"
+        "        // The raw dense indices\n"
+        "        const IndexType* pIndices() const noexcept\n"
+        "        {\n"
+        "            return m_vIndices.data();\n"
+        "        }\n"
+        "\n"
+        "        // The rows that have the value. An invalid value matches no rows\n"
+        "        RowBitmap FilterEq(const E eVal) const\n"
+        "        {\n"
+        "            RowBitmap bmpRet((m_vIndices.size() + 63) / 64, 0);\n"
+        "            const uint32_t uTarget = uEnumToIndex(eVal);\n"
+        "            if (uTarget >= c_uCount)\n"
+        "            {\n"
+        "                return bmpRet;\n"
+        "            }\n"
+        "\n"
+        "            size_t szRow = 0;\n"
+        "            if constexpr (sizeof(IndexType) == 1)\n"
+        "            {\n"
+        "                szRow = szFilterEqBytes(static_cast<uint8_t>(uTarget), bmpRet.data());\n"
+        "            }\n"
+        "            for (; szRow < m_vIndices.size(); szRow++)\n"
+        "            {\n"
+        "                bmpRet[szRow / 64] |= uint64_t(m_vIndices[szRow] == uTarget) << (szRow % 64);\n"
+        "            }\n"
+        "            return bmpRet;\n"
+        "        }\n"
+        "\n"
+        "        //\n"
+        "        //  The rows whose values are in a group, as a bitmap over dense indices, such\n"
+        "        //  as the ones generated for Group= definitions.\n"
+        "        //\n"
+        "        RowBitmap FilterIn(const uint64_t* const pauGroup) const\n"
+        "        {\n"
+        "            RowBitmap bmpRet((m_vIndices.size() + 63) / 64, 0);\n"
+        "            size_t szRow = 0;\n"
+        "            if constexpr ((sizeof(IndexType) == 1) && (c_uCount <= 16))\n"
+        "            {\n"
+        "                szRow = szFilterInBytes(pauGroup[0], bmpRet.data());\n"
+        "            }\n"
+        "\n"
+        "            std::array<uint8_t, c_uCount> auInGroup;\n"
+        "            for (uint32_t uIndex = 0; uIndex < c_uCount; uIndex++)\n"
+        "            {\n"
+        "                auInGroup[uIndex] = static_cast<uint8_t>((pauGroup[uIndex / 64] >> (uIndex % 64)) & 1);\n"
+        "            }\n"
+        "            for (; szRow < m_vIndices.size(); szRow++)\n"
+        "            {\n"
+        "                bmpRet[szRow / 64] |= uint64_t(auInGroup[m_vIndices[szRow]]) << (szRow % 64);\n"
+        "            }\n"
+        "            return bmpRet;\n"
+        "        }\n"
+        "\n"
+        "        RowBitmap FilterIn(const std::initializer_list<E> listVals) const\n"
+        "        {\n"
+        "            std::array<uint64_t, (c_uCount + 63) / 64> auGroup = {};\n"
+        "            for (const E eCur : listVals)\n"
+        "            {\n"
+        "                const uint32_t uIndex = uEnumToIndex(eCur);\n"
+        "                if (uIndex < c_uCount)\n"
+        "                {\n"
+        "                    auGroup[uIndex / 64] |= 1ULL << (uIndex % 64);\n"
+        "                }\n"
+        "            }\n"
+        "            return FilterIn(auGroup.data());\n"
+        "        }\n"
+        "\n"
+        "        // The count of rows per value, by dense index\n"
+        "        CountList Histogram() const noexcept\n"
+        "        {\n"
+        "            CountList aszRet = {};\n"
+        "            size_t szRow = 0;\n"
+        "            if constexpr ((sizeof(IndexType) == 1) && (c_uCount <= 16))\n"
+        "            {\n"
+        "                szRow = szHistogramBytes(aszRet);\n"
+        "            }\n"
+        "\n"
+        "            // Spread over a few sets of counts, so that runs of a value don't stall\n"
+        "            std::array<CountList, 4> aaszParts = {};\n"
+        "            for (; szRow + 4 <= m_vIndices.size(); szRow += 4)\n"
+        "            {\n"
+        "                aaszParts[0][m_vIndices[szRow]]++;\n"
+        "                aaszParts[1][m_vIndices[szRow + 1]]++;\n"
+        "                aaszParts[2][m_vIndices[szRow + 2]]++;\n"
+        "                aaszParts[3][m_vIndices[szRow + 3]]++;\n"
+        "            }\n"
+        "            for (; szRow < m_vIndices.size(); szRow++)\n"
+        "            {\n"
+        "                aaszParts[0][m_vIndices[szRow]]++;\n"
+        "            }\n"
+        "            for (uint32_t uIndex = 0; uIndex < c_uCount; uIndex++)\n"
+        "            {\n"
+        "                aszRet[uIndex] += aaszParts[0][uIndex] + aaszParts[1][uIndex]\n"
+        "                                  + aaszParts[2][uIndex] + aaszParts[3][uIndex];\n"
+        "            }\n"
+        "            return aszRet;\n"
+        "        }\n"
+        "\n"
+        "        // A row bitmap per value, by dense index, built in one pass\n"
+        "        std::array<RowBitmap, c_uCount> Postings() const\n"
+        "        {\n"
+        "            std::array<RowBitmap, c_uCount> abmpRet;\n"
+        "            for (RowBitmap& bmpCur : abmpRet)\n"
+        "            {\n"
+        "                bmpCur.resize((m_vIndices.size() + 63) / 64, 0);\n"
+        "            }\n"
+        "            for (size_t szRow = 0; szRow < m_vIndices.size(); szRow++)\n"
+        "            {\n"
+        "                abmpRet[m_vIndices[szRow]][szRow / 64] |= 1ULL << (szRow % 64);\n"
+        "            }\n"
+        "            return abmpRet;\n"
+        "        }\n"
+        "\n"
+        "    private :\n"
+        "        static IndexType uToIndex(const E eVal)\n"
+        "        {\n"
+        "            const uint32_t uIndex = uEnumToIndex(eVal);\n"
+        "            if (uIndex >= c_uCount)\n"
+        "            {\n"
+        "                throw std::runtime_error(\"An invalid enum value cannot be stored in an enum column\");\n"
+        "            }\n"
+        "            return static_cast<IndexType>(uIndex);\n"
+        "        }\n"
+        "\n"
+        "        // These do as many whole words of rows as they can, and return the next row\n"
+        "        size_t szFilterEqBytes(const uint8_t uTarget, uint64_t* const pauOut) const noexcept\n"
+        "        {\n"
+        "            size_t szRow = 0;\n"
+        "            const uint8_t* const pabData = reinterpret_cast<const uint8_t*>(m_vIndices.data());\n"
+        "#if defined(__AVX2__)\n"
+        "            const __m256i vecTarget = _mm256_set1_epi8(static_cast<char>(uTarget));\n"
+        "            for (; szRow + 64 <= m_vIndices.size(); szRow += 64)\n"
+        "            {\n"
+        "                const __m256i vecLow = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pabData + szRow));\n"
+        "                const __m256i vecHigh = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pabData + szRow + 32));\n"
+        "                pauOut[szRow / 64] = uint64_t(uint32_t(_mm256_movemask_epi8(_mm256_cmpeq_epi8(vecLow, vecTarget))))\n"
+        "                                     | (uint64_t(uint32_t(_mm256_movemask_epi8(_mm256_cmpeq_epi8(vecHigh, vecTarget)))) << 32);\n"
+        "            }\n"
+        "#elif defined(CQENUM_SIMD_SSE2)\n"
+        "            const __m128i vecTarget = _mm_set1_epi8(static_cast<char>(uTarget));\n"
+        "            for (; szRow + 64 <= m_vIndices.size(); szRow += 64)\n"
+        "            {\n"
+        "                uint64_t uWord = 0;\n"
+        "                for (uint32_t uPart = 0; uPart < 4; uPart++)\n"
+        "                {\n"
+        "                    const __m128i vecCur = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pabData + szRow + (uPart * 16)));\n"
+        "                    uWord |= uint64_t(uint16_t(_mm_movemask_epi8(_mm_cmpeq_epi8(vecCur, vecTarget)))) << (uPart * 16);\n"
+        "                }\n"
+        "                pauOut[szRow / 64] = uWord;\n"
+        "            }\n"
+        "#else\n"
+        "            (void)uTarget;\n"
+        "            (void)pabData;\n"
+        "            (void)pauOut;\n"
+        "#endif\n"
+        "            return szRow;\n"
+        "        }\n"
+        "\n"
+        "        //\n"
+        "        //  With up to 16 values, the indices can be used to shuffle a vector with\n"
+        "        //  0xFF in the bytes for the group members, to look them all up at once.\n"
+        "        //\n"
+        "        size_t szFilterInBytes(const uint64_t uGroup, uint64_t* const pauOut) const noexcept\n"
+        "        {\n"
+        "            size_t szRow = 0;\n"
+        "#if defined(__AVX2__) || defined(__SSSE3__)\n"
+        "            const uint8_t* const pabData = reinterpret_cast<const uint8_t*>(m_vIndices.data());\n"
+        "            alignas(16) uint8_t abLookup[16] = {};\n"
+        "            for (uint32_t uIndex = 0; uIndex < c_uCount; uIndex++)\n"
+        "            {\n"
+        "                abLookup[uIndex] = ((uGroup >> uIndex) & 1) ? 0xFF : 0;\n"
+        "            }\n"
+        "            const __m128i vecLookup = _mm_load_si128(reinterpret_cast<const __m128i*>(abLookup));\n"
+        "            for (; szRow + 64 <= m_vIndices.size(); szRow += 64)\n"
+        "            {\n"
+        "                uint64_t uWord = 0;\n"
+        "                for (uint32_t uPart = 0; uPart < 4; uPart++)\n"
+        "                {\n"
+        "                    const __m128i vecCur = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pabData + szRow + (uPart * 16)));\n"
+        "                    uWord |= uint64_t(uint16_t(_mm_movemask_epi8(_mm_shuffle_epi8(vecLookup, vecCur)))) << (uPart * 16);\n"
+        "                }\n"
+        "                pauOut[szRow / 64] = uWord;\n"
+        "            }\n"
+        "#else\n"
+        "            (void)uGroup;\n"
+        "            (void)pauOut;\n"
+        "#endif\n"
+        "            return szRow;\n"
+        "        }\n"
+        "\n"
+        "        //\n"
+        "        //  With up to 16 values, compare each vector of indices against each value,\n"
+        "        //  subtracting the all ones matches from byte counters, which are added up\n"
+        "        //  before they can overflow.\n"
+        "        //\n"
+        "        size_t szHistogramBytes(CountList& aszCounts) const noexcept\n"
+        "        {\n"
+        "            size_t szRow = 0;\n"
+        "#if defined(CQENUM_SIMD_SSE2)\n"
+        "            const uint8_t* const pabData = reinterpret_cast<const uint8_t*>(m_vIndices.data());\n"
+        "            const __m128i vecZero = _mm_setzero_si128();\n"
+        "            __m128i avecValues[c_uCount];\n"
+        "            __m128i avecSums[c_uCount];\n"
+        "            for (uint32_t uIndex = 0; uIndex < c_uCount; uIndex++)\n"
+        "            {\n"
+        "                avecValues[uIndex] = _mm_set1_epi8(static_cast<char>(uIndex));\n"
+        "                avecSums[uIndex] = vecZero;\n"
+        "            }\n"
+        "\n"
+        "            while (szRow + 16 <= m_vIndices.size())\n"
+        "            {\n"
+        "                __m128i avecBytes[c_uCount];\n"
+        "                for (uint32_t uIndex = 0; uIndex < c_uCount; uIndex++)\n"
+        "                {\n"
+        "                    avecBytes[uIndex] = vecZero;\n"
+        "                }\n"
+        "\n"
+        "                for (uint32_t uBlock = 0; (uBlock < 255) && (szRow + 16 <= m_vIndices.size()); uBlock++, szRow += 16)\n"
+        "                {\n"
+        "                    const __m128i vecCur = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pabData + szRow));\n"
+        "                    for (uint32_t uIndex = 0; uIndex < c_uCount; uIndex++)\n"
+        "                    {\n"
+        "                        avecBytes[uIndex] = _mm_sub_epi8(avecBytes[uIndex], _mm_cmpeq_epi8(vecCur, avecValues[uIndex]));\n"
+        "                    }\n"
+        "                }\n"
+        "\n"
+        "                for (uint32_t uIndex = 0; uIndex < c_uCount; uIndex++)\n"
+        "                {\n"
+        "                    avecSums[uIndex] = _mm_add_epi64(avecSums[uIndex], _mm_sad_epu8(avecBytes[uIndex], vecZero));\n"
+        "                }\n"
+        "            }\n"
+        "\n"
+        "            for (uint32_t uIndex = 0; uIndex < c_uCount; uIndex++)\n"
+        "            {\n"
+        "                alignas(16) uint64_t auHalves[2];\n"
+        "                _mm_store_si128(reinterpret_cast<__m128i*>(auHalves), avecSums[uIndex]);\n"
+        "                aszCounts[uIndex] += static_cast<size_t>(auHalves[0] + auHalves[1]);\n"
+        "            }\n"
+        "#else\n"
+        "            (void)aszCounts;\n"
+        "#endif\n"
+        "            return szRow;\n"
+        "        }\n"
+        "\n"
+        "        std::vector<IndexType>  m_vIndices;\n"
+        "};\n"
+    };
+
+    constexpr const char* const pszHdrAtomicFlags =
+    {
+        "\n"
+        "//\n"
+        "//  A lock free atomic wrapper for Bitmap enums, so that flags shared between\n"
+        "//  threads can be updated with single RMW operations and still be typed. The\n"
+        "//  generator creates an [enumname]AtomicFlags alias for each Bitmap enum. The\n"
+        "//  wait/notify methods use the C++20 atomic waits if available, else wait just\n"
+        "//  polls and yields and the notifies do nothing.\n"
+        "//\n"
+        "template <typename E> class AtomicFlags\n"
+        "{\n"
+        "    public :\n"
+        "        using UnderType = std::underlying_type_t<E>;\n"
+        "        static_assert(std::atomic<UnderType>::is_always_lock_free, \"The underlying type must be lock free\");\n"
+        "\n"
+        "        constexpr AtomicFlags() noexcept : m_uBits(0) {}\n"
+        "        constexpr explicit AtomicFlags(const E eInit) noexcept : m_uBits(static_cast<UnderType>(eInit)) {}\n"
+        "\n"
+        "        AtomicFlags(const AtomicFlags&) = delete;\n"
+        "        AtomicFlags& operator=(const AtomicFlags&) = delete;\n"
+        "\n"
+        "        E load(const std::memory_order eOrder = std::memory_order_seq_cst) const noexcept\n"
+        "        {\n"
+        "            return static_cast<E>(m_uBits.load(eOrder));\n"
+        "        }\n"
+        "\n"
+        "        void store(const E eBits, const std::memory_order eOrder = std::memory_order_seq_cst) noexcept\n"
+        "        {\n"
+        "            m_uBits.store(static_cast<UnderType>(eBits), eOrder);\n"
+        "        }\n"
+        "\n"
+        "        E exchange(const E eBits, const std::memory_order eOrder = std::memory_order_seq_cst) noexcept\n"
+        "        {\n"
+        "            return static_cast<E>(m_uBits.exchange(static_cast<UnderType>(eBits), eOrder));\n"
+        "        }\n"
+        "\n"
+        "        bool compare_exchange_strong(       E&                  eExpected\n"
+        "                                    , const E                   eNew\n"
+        "                                    , const std::memory_order   eOrder = std::memory_order_seq_cst) noexcept\n"
+        "        {\n"
+        "            UnderType uExpected = static_cast<UnderType>(eExpected);\n"
+        "            const bool bRet = m_uBits.compare_exchange_strong(uExpected, static_cast<UnderType>(eNew), eOrder);\n"
+        "            eExpected = static_cast<E>(uExpected);\n"
+        "            return bRet;\n"
+        "        }\n"
+        "\n"
+        "        // Turn on/off the indicated bits, returning the previous value\n"
+        "        E fetch_set(const E eBits, const std::memory_order eOrder = std::memory_order_seq_cst) noexcept\n"
+        "        {\n"
+        "            return static_cast<E>(m_uBits.fetch_or(static_cast<UnderType>(eBits), eOrder));\n"
+        "        }\n"
+        "\n"
+        "        E fetch_clear(const E eBits, const std::memory_order eOrder = std::memory_order_seq_cst) noexcept\n"
+        "        {\n"
+        "            return static_cast<E>(m_uBits.fetch_and(static_cast<UnderType>(~static_cast<UnderType>(eBits)), eOrder));\n"
+        "        }\n"
+        "\n"
+        "        E fetch_toggle(const E eBits, const std::memory_order eOrder = std::memory_order_seq_cst) noexcept\n"
+        "        {\n"
+        "            return static_cast<E>(m_uBits.fetch_xor(static_cast<UnderType>(eBits), eOrder));\n"
+        "        }\n"
+        "\n"
+        "        //\n"
+        "        //  Turn on the indicated bits, and return true if any of them were already\n"
+        "        //  on. So, for a single bit, false means this caller is the one that set it.\n"
+        "        //\n"
+        "        bool test_and_set(const E eBits, const std::memory_order eOrder = std::memory_order_seq_cst) noexcept\n"
+        "        {\n"
+        "            const UnderType uBits = static_cast<UnderType>(eBits);\n"
+        "            return (m_uBits.fetch_or(uBits, eOrder) & uBits) != 0;\n"
+        "        }\n"
+        "\n"
+        "        bool bAllOn(const E eBits, const std::memory_order eOrder = std::memory_order_seq_cst) const noexcept\n"
+        "        {\n"
+        "            const UnderType uBits = static_cast<UnderType>(eBits);\n"
+        "            return (m_uBits.load(eOrder) & uBits) == uBits;\n"
+        "        }\n"
+        "\n"
+        "        bool bAnyOn(const E eBits, const std::memory_order eOrder = std::memory_order_seq_cst) const noexcept\n"
+        "        {\n"
+        "            return (m_uBits.load(eOrder) & static_cast<UnderType>(eBits)) != 0;\n"
+        "        }\n"
+        "\n"
+        "        // Block until the value is no longer eOld\n"
+        "        void wait(const E eOld, const std::memory_order eOrder = std::memory_order_seq_cst) const noexcept\n"
+        "        {\n"
+        "#if defined(__cpp_lib_atomic_wait)\n"
+        "            m_uBits.wait(static_cast<UnderType>(eOld), eOrder);\n"
+        "#else\n"
+        "            while (m_uBits.load(eOrder) == static_cast<UnderType>(eOld))\n"
+        "            {\n"
+        "                std::this_thread::yield();\n"
+        "            }\n"
+        "#endif\n"
+        "        }\n"
+        "\n"
+        "        void notify_one() noexcept\n"
+        "        {\n"
+        "#if defined(__cpp_lib_atomic_wait)\n"
+        "            m_uBits.notify_one();\n"
+        "#endif\n"
+        "        }\n"
+        "\n"
+        "        void notify_all() noexcept\n"
+        "        {\n"
+        "#if defined(__cpp_lib_atomic_wait)\n"
+        "            m_uBits.notify_all();\n"
+        "#endif\n"
+        "        }\n"
+        "\n"
+        "    private :\n"
+        "        std::atomic<UnderType>  m_uBits;\n"
+        "};\n"
+    };
+
+    constexpr const char* const pszHdrAliases =
+    {
+        "\n"
+        "//\n"
+        "//  Enums with the Aliases flag get one of these, which holds extra names that\n"
+        "//  bNameToEnum() will accept, and which can be set at runtime (e.g. loaded from\n"
+        "//  config.) The static names are always checked first, so this is only hit on\n"
+        "//  a miss. Aliases are case insensitive, like the names.\n"
+        "//\n"
+        "//  Lookups are wait free. The aliases are in an immutable, sorted snapshot,\n"
+        "//  and updates build a new one and swap it in. Readers bump a counter for the\n"
+        "//  current epoch around their use of the snapshot, and the updater flips the\n"
+        "//  epoch and waits for the previous epoch's readers to drain, twice, before it\n"
+        "//  frees the old snapshot. Updates are serialized, and only they ever wait.\n"
+        "//\n"
+        "template <typename E> class AliasRegistry\n"
+        "{\n"
+        "    public :\n"
+        "        using AliasList = std::vector<std::pair<std::wstring, E>>;\n"
+        "\n"
+        "        constexpr AliasRegistry() noexcept = default;\n"
+        "\n"
+        "        AliasRegistry(const AliasRegistry&) = delete;\n"
+        "        AliasRegistry& operator=(const AliasRegistry&) = delete;\n"
+        "\n"
+        "        ~AliasRegistry()\n"
+        "        {\n"
+        "            delete m_psnapCur.load();\n"
+        "        }\n"
+        "\n"
+        "        bool bFind(const std::wstring_view& svName, E& eToFill) const noexcept\n"
+        "        {\n"
+        "            // Don't bother if there are no aliases, the usual case\n"
+        "            if (!m_psnapCur.load(std::memory_order_acquire))\n"
+        "            {\n"
+        "                return false;\n"
+        "            }\n"
+        "\n"
+        "            Readers& rdrsCur = m_ardrsEpochs[m_uEpoch.load() & 1];\n"
+        "            rdrsCur.uCount.fetch_add(1);\n"
+        "\n"
+        "            bool bRet = false;\n"
+        "            const Snapshot* const psnapCur = m_psnapCur.load();\n"
+        "            if (psnapCur)\n"
+        "            {\n"
+        "                typename AliasList::const_iterator itFind = std::lower_bound\n"
+        "                (\n"
+        "                    psnapCur->listAliases.begin()\n"
+        "                    , psnapCur->listAliases.end()\n"
+        "                    , svName\n"
+        "                    , [](const std::pair<std::wstring, E>& pairCur, const std::wstring_view& svFind)\n"
+        "                      { return iCompareAlias(pairCur.first, svFind) < 0; }\n"
+        "                );\n"
+        "                if ((itFind != psnapCur->listAliases.end()) && !iCompareAlias(itFind->first, svName))\n"
+        "                {\n"
+        "                    eToFill = itFind->second;\n"
+        "                    bRet = true;\n"
+        "                }\n"
+        "            }\n"
+        "\n"
+        "            rdrsCur.uCount.fetch_sub(1, std::memory_order_release);\n"
+        "            return bRet;\n"
+        "        }\n"
+        "\n"
+        "        uint32_t uCount() const noexcept\n"
+        "        {\n"
+        "            std::lock_guard<std::mutex> lockUpdate(m_mtxUpdate);\n"
+        "            const Snapshot* const psnapCur = m_psnapCur.load();\n"
+        "            return psnapCur ? static_cast<uint32_t>(psnapCur->listAliases.size()) : 0;\n"
+        "        }\n"
+        "\n"
+        "        // Add or update one alias\n"
+        "        void AddAlias(const std::wstring_view& svName, const E eVal)\n"
+        "        {\n"
+        "            std::lock_guard<std::mutex> lockUpdate(m_mtxUpdate);\n"
+        "            const Snapshot* const psnapCur = m_psnapCur.load();\n"
+        "            AliasList listNew;\n"
+        "            if (psnapCur)\n"
+        "            {\n"
+        "                listNew = psnapCur->listAliases;\n"
+        "            }\n"
+        "            listNew.emplace_back(std::wstring(svName), eVal);\n"
+        "            Replace(psnapMake(std::move(listNew)));\n"
+        "        }\n"
+        "\n"
+        "        void Clear()\n"
+        "        {\n"
+        "            std::lock_guard<std::mutex> lockUpdate(m_mtxUpdate);\n"
+        "            Replace(nullptr);\n"
+        "        }\n"
+        "\n"
+        "        // Replace all of the aliases. If a name is in the list more than once, the last one wins\n"
+        "        void SetAliases(AliasList listNew)\n"
+        "        {\n"
+        "            Snapshot* const psnapNew = listNew.empty() ? nullptr : psnapMake(std::move(listNew));\n"
+        "            std::lock_guard<std::mutex> lockUpdate(m_mtxUpdate);\n"
+        "            Replace(psnapNew);\n"
+        "        }\n"
+        "\n"
+        "    private :\n"
+        "        struct Snapshot\n"
+        "        {\n"
+        "            AliasList   listAliases;\n"
+        "        };\n"
+        "\n"
+        "        struct alignas(c_uCacheLineSize) Readers\n"
+        "        {\n"
+        "            std::atomic<uint32_t>   uCount{0};\n"
+        "        };\n"
+        "\n"
+        "        // Case insensitive compare, names are ASCII identifiers so we just fold a-z\n"
+        "        static int iCompareAlias(const std::wstring_view& svLHS, const std::wstring_view& svRHS) noexcept\n"
+        "        {\n"
+        "            const size_t szCount = (svLHS.size() < svRHS.size()) ? svLHS.size() : svRHS.size();\n"
+        "            for (size_t szIndex = 0; szIndex < szCount; szIndex++)\n"
+        "            {\n"
+        "                const wchar_t chLHS = ((svLHS[szIndex] >= L'a') && (svLHS[szIndex] <= L'z'))\n"
+        "                                      ? static_cast<wchar_t>(svLHS[szIndex] - 0x20) : svLHS[szIndex];\n"
+        "                const wchar_t chRHS = ((svRHS[szIndex] >= L'a') && (svRHS[szIndex] <= L'z'))\n"
+        "                                      ? static_cast<wchar_t>(svRHS[szIndex] - 0x20) : svRHS[szIndex];\n"
+        "                if (chLHS != chRHS)\n"
+        "                {\n"
+        "                    return (chLHS < chRHS) ? -1 : 1;\n"
+        "                }\n"
+        "            }\n"
+        "            if (svLHS.size() == svRHS.size())\n"
+        "            {\n"
+        "                return 0;\n"
+        "            }\n"
+        "            return (svLHS.size() < svRHS.size()) ? -1 : 1;\n"
+        "        }\n"
+        "\n"
+        "        // Sort the list, keeping only the last of any duplicates\n"
+        "        static Snapshot* psnapMake(AliasList&& listNew)\n"
+        "        {\n"
+        "            std::stable_sort\n"
+        "            (\n"
+        "                listNew.begin()\n"
+        "                , listNew.end()\n"
+        "                , [](const std::pair<std::wstring, E>& pairLHS, const std::pair<std::wstring, E>& pairRHS)\n"
+        "                  { return iCompareAlias(pairLHS.first, pairRHS.first) < 0; }\n"
+        "            );\n"
+        "\n"
+        "            Snapshot* psnapRet = new Snapshot;\n"
+        "            for (std::pair<std::wstring, E>& pairCur : listNew)\n"
+        "            {\n"
+        "                if (!psnapRet->listAliases.empty()\n"
+        "                &&  !iCompareAlias(psnapRet->listAliases.back().first, pairCur.first))\n"
+        "                {\n"
+        "                    psnapRet->listAliases.back() = std::move(pairCur);\n"
+        "                }\n"
+        "                else\n"
+        "                {\n"
+        "                    psnapRet->listAliases.push_back(std::move(pairCur));\n"
+        "                }\n"
+        "            }\n"
+        "            return psnapRet;\n"
+        "        }\n"
+        "\n"
+        "        // The caller must have the update lock\n"
+        "        void Replace(Snapshot* const psnapNew)\n"
+        "        {\n"
+        "            Snapshot* const psnapOld = m_psnapCur.exchange(psnapNew);\n"
+        "            if (!psnapOld)\n"
+        "            {\n"
+        "                return;\n"
+        "            }\n"
+        "\n"
+        "            //\n"
+        "            //  A reader can have read the epoch just before a flip and then count\n"
+        "            //  itself in the old one, so we have to drain both of them.\n"
+        "            //\n"
+        "            for (uint32_t uPass = 0; uPass < 2; uPass++)\n"
+        "            {\n"
+        "                const uint32_t uOldEpoch = m_uEpoch.fetch_add(1) & 1;\n"
+        "                while (m_ardrsEpochs[uOldEpoch].uCount.load() != 0)\n"
+        "                {\n"
+        "                    std::this_thread::yield();\n"
+        "                }\n"
+        "            }\n"
+        "            delete psnapOld;\n"
+        "        }\n"
+        "\n"
+        "        mutable Readers             m_ardrsEpochs[2];\n"
+        "        mutable std::mutex          m_mtxUpdate;\n"
+        "        std::atomic<Snapshot*>      m_psnapCur{nullptr};\n"
+        "        std::atomic<uint32_t>       m_uEpoch{0};\n"
+        "};\n"
+    };
+
+    constexpr const char* const pszHdrInstrument =
+    {
+        "\n"
+        "//\n"
+        "//  Optional instrumentation of the generated lookups. If CQENUM_INSTRUMENT is\n"
+        "//  defined when building, each lookup counts its calls, misses, and probes (the\n"
+        "//  number of table entries looked at) in thread local counters, so there is no\n"
+        "//  contention on the hot path. The counters of running threads and of threads\n"
+        "//  that have exited are summed by lcntsLookupTotals() and DumpLookupStats().\n"
+        "//  If not defined, the CQENUM_LOOKUP() calls in the lookups compile to nothing.\n"
+        "//\n"
+        "#if defined(CQENUM_INSTRUMENT)\n"
+        "\n"
+        "enum class ELookups : uint32_t\n"
+        "{\n"
+        "    AltValToEnum, EnumToAltVal, EnumToName, EnumToText1, EnumToText2, IsValid, NameToEnum\n"
+        "\n"
+        "    , Count\n"
+        "};\n"
+        "\n"
+        "inline const char* pszLookupName(const ELookups eLookup) noexcept\n"
+        "{\n"
+        "    constexpr const char* const apszNames[] =\n"
+        "    {\n"
+        "        \"AltValToEnum\", \"EnumToAltVal\", \"EnumToName\", \"EnumToText1\", \"EnumToText2\", \"IsValid\", \"NameToEnum\"\n"
+        "    };\n"
+        "    return (eLookup < ELookups::Count) ? apszNames[static_cast<uint32_t>(eLookup)] : \"???\";\n"
+        "}\n"
+        "\n"
+        "struct LookupCounts\n"
+        "{\n"
+        "    uint64_t    uCalls = 0;\n"
+        "    uint64_t    uMisses = 0;\n"
+        "    uint64_t    uProbes = 0;\n"
+        "};\n"
+        "\n"
+        "constexpr uint32_t c_uLookupCount = static_cast<uint32_t>(ELookups::Count);\n"
+        "\n"
+        "//\n"
+        "//  A thread's counters for one enum. Only the owning thread writes them, so the\n"
+        "//  bumps are relaxed load/store, not RMW. They register themselves with the\n"
+        "//  registry below on creation, and fold their counts into it on thread exit.\n"
+        "//\n"
+        "class LookupCounters\n"
+        "{\n"
+        "    public :\n"
+        "        explicit LookupCounters(const char* const pszEnum);\n"
+        "        ~LookupCounters();\n"
+        "\n"
+        "        LookupCounters(const LookupCounters&) = delete;\n"
+        "        LookupCounters& operator=(const LookupCounters&) = delete;\n"
+        "\n"
+        "        void Bump(const uint32_t uLookup, const bool bHit, const uint32_t uProbes) noexcept\n"
+        "        {\n"
+        "            m_auCalls[uLookup].store(m_auCalls[uLookup].load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);\n"
+        "            if (!bHit)\n"
+        "            {\n"
+        "                m_auMisses[uLookup].store(m_auMisses[uLookup].load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);\n"
+        "            }\n"
+        "            m_auProbes[uLookup].store(m_auProbes[uLookup].load(std::memory_order_relaxed) + uProbes, std::memory_order_relaxed);\n"
+        "        }\n"
+        "\n"
+        "        void AddTo(const uint32_t uLookup, LookupCounts& lcntsToFill) const noexcept\n"
+        "        {\n"
+        "            lcntsToFill.uCalls += m_auCalls[uLookup].load(std::memory_order_relaxed);\n"
+        "            lcntsToFill.uMisses += m_auMisses[uLookup].load(std::memory_order_relaxed);\n"
+        "            lcntsToFill.uProbes += m_auProbes[uLookup].load(std::memory_order_relaxed);\n"
+        "        }\n"
+        "\n"
+        "        const char*             m_pszEnum;\n"
+        "        LookupCounters*         m_plcntrsNext = nullptr;\n"
+        "\n"
+        "    private :\n"
+        "        std::atomic<uint64_t>   m_auCalls[c_uLookupCount] = {};\n"
+        "        std::atomic<uint64_t>   m_auMisses[c_uLookupCount] = {};\n"
+        "        std::atomic<uint64_t>   m_auProbes[c_uLookupCount] = {};\n"
+        "};\n"
+        "\n"
+        "class LookupRegistry\n"
+        "{\n"
+        "    public :\n"
+        "        using CountList = std::array<LookupCounts, c_uLookupCount>;\n"
+        "\n"
+        "        static LookupRegistry& lregInstance()\n"
+        "        {\n"
+        "            static LookupRegistry s_lregInstance;\n"
+        "            return s_lregInstance;\n"
+        "        }\n"
+        "\n"
+        "        void Add(LookupCounters* const plcntrsAdd)\n"
+        "        {\n"
+        "            std::lock_guard<std::mutex> lockList(m_mtxList);\n"
+        "            plcntrsAdd->m_plcntrsNext = m_plcntrsHead;\n"
+        "            m_plcntrsHead = plcntrsAdd;\n"
+        "        }\n"
+        "\n"
+        "        void Remove(LookupCounters* const plcntrsRem)\n"
+        "        {\n"
+        "            std::lock_guard<std::mutex> lockList(m_mtxList);\n"
+        "            LookupCounters** pplcntrsCur = &m_plcntrsHead;\n"
+        "            while (*pplcntrsCur && (*pplcntrsCur != plcntrsRem))\n"
+        "            {\n"
+        "                pplcntrsCur = &(*pplcntrsCur)->m_plcntrsNext;\n"
+        "            }\n"
+        "            if (*pplcntrsCur)\n"
+        "            {\n"
+        "                *pplcntrsCur = plcntrsRem->m_plcntrsNext;\n"
+        "            }\n"
+        "\n"
+        "            CountList& alcntsRetired = alcntsFindRetired(plcntrsRem->m_pszEnum);\n"
+        "            for (uint32_t uIndex = 0; uIndex < c_uLookupCount; uIndex++)\n"
+        "            {\n"
+        "                plcntrsRem->AddTo(uIndex, alcntsRetired[uIndex]);\n"
+        "            }\n"
+        "        }\n"
+        "\n"
+        "        // Get the counts for all enums, by enum name\n"
+        "        std::vector<std::pair<std::string, CountList>> vTotals()\n"
+        "        {\n"
+        "            std::lock_guard<std::mutex> lockList(m_mtxList);\n"
+        "            std::vector<std::pair<std::string, CountList>> vRet = m_vRetired;\n"
+        "            for (const LookupCounters* plcntrsCur = m_plcntrsHead; plcntrsCur; plcntrsCur = plcntrsCur->m_plcntrsNext)\n"
+        "            {\n"
+        "                std::vector<std::pair<std::string, CountList>>::iterator itEnum = std::find_if\n"
+        "                (\n"
+        "                    vRet.begin()\n"
+        "                    , vRet.end()\n"
+        "                    , [plcntrsCur](const std::pair<std::string, CountList>& pairCur)\n"
+        "                      { return pairCur.first == plcntrsCur->m_pszEnum; }\n"
+        "                );\n"
+        "                if (itEnum == vRet.end())\n"
+        "                {\n"
+        "                    itEnum = vRet.insert(vRet.end(), std::make_pair(std::string(plcntrsCur->m_pszEnum), CountList()));\n"
+        "                }\n"
+        "                for (uint32_t uIndex = 0; uIndex < c_uLookupCount; uIndex++)\n"
+        "                {\n"
+        "                    plcntrsCur->AddTo(uIndex, itEnum->second[uIndex]);\n"
+        "                }\n"
+        "            }\n"
+        "            return vRet;\n"
+        "        }\n"
+        "\n"
+        "    private :\n"
+        "        CountList& alcntsFindRetired(const char* const pszEnum)\n"
+        "        {\n"
+        "            for (std::pair<std::string, CountList>& pairCur : m_vRetired)\n"
+        "            {\n"
+        "                if (pairCur.first == pszEnum)\n"
+        "                {\n"
+        "                    return pairCur.second;\n"
+        "                }\n"
+        "            }\n"
+        "            m_vRetired.emplace_back(std::string(pszEnum), CountList());\n"
+        "            return m_vRetired.back().second;\n"
+        "        }\n"
+        "\n"
+        "        std::mutex                                      m_mtxList;\n"
+        "        LookupCounters*                                 m_plcntrsHead = nullptr;\n"
+        "        std::vector<std::pair<std::string, CountList>>  m_vRetired;\n"
+        "};\n"
+        "\n"
+        "inline LookupCounters::LookupCounters(const char* const pszEnum) :\n"
+        "\n"
+        "    m_pszEnum(pszEnum)\n"
+        "{\n"
+        "    LookupRegistry::lregInstance().Add(this);\n"
+        "}\n"
+        "\n"
+        "inline LookupCounters::~LookupCounters()\n"
+        "{\n"
+        "    LookupRegistry::lregInstance().Remove(this);\n"
+        "}\n"
+        "\n"
+        "// Called by the generated lookups, each enum gets its own thread local counters\n"
+        "template <typename E>\n"
+        "inline void RecordLookup(   const   char* const pszEnum\n"
+        "                            , const ELookups    eLookup\n"
+        "                            , const bool        bHit\n"
+        "                            , const uint32_t    uProbes)\n"
+        "{\n"
+        "    thread_local LookupCounters t_lcntrsEnum(pszEnum);\n"
+        "    t_lcntrsEnum.Bump(static_cast<uint32_t>(eLookup), bHit, uProbes);\n"
+        "}\n"
+        "\n"
+        "// The totals for one lookup of an enum, by its namespace qualified name\n"
+        "inline LookupCounts lcntsLookupTotals(const char* const pszEnum, const ELookups eLookup)\n"
+        "{\n"
+        "    for (const std::pair<std::string, LookupRegistry::CountList>& pairCur : LookupRegistry::lregInstance().vTotals())\n"
+        "    {\n"
+        "        if (pairCur.first == pszEnum)\n"
+        "        {\n"
+        "            return pairCur.second[static_cast<uint32_t>(eLookup)];\n"
+        "        }\n"
+        "    }\n"
+        "    return LookupCounts();\n"
+        "}\n"
+        "\n"
+        "// Format out the lookups that have been called, one per line\n"
+        "inline void DumpLookupStats(std::ostream& strmTar)\n"
+        "{\n"
+        "    for (const std::pair<std::string, LookupRegistry::CountList>& pairCur : LookupRegistry::lregInstance().vTotals())\n"
+        "    {\n"
+        "        for (uint32_t uIndex = 0; uIndex < c_uLookupCount; uIndex++)\n"
+        "        {\n"
+        "            const LookupCounts& lcntsCur = pairCur.second[uIndex];\n"
+        "            if (lcntsCur.uCalls)\n"
+        "            {\n"
+        "                strmTar << pairCur.first << \"::\" << pszLookupName(static_cast<ELookups>(uIndex))\n"
+        "                        << \" Calls=\" << lcntsCur.uCalls << \" Misses=\" << lcntsCur.uMisses\n"
+        "                        << \" AvgProbes=\" << (static_cast<double>(lcntsCur.uProbes) / lcntsCur.uCalls)\n"
+        "                        << \"\\n\";\n"
+        "            }\n"
+        "        }\n"
+        "    }\n"
+        "}\n"
+        "\n"
+        "#define CQENUM_LOOKUP(E, Lookup, bHit, uProbes) \\\n"
+        "    CQSL::CQEnum::RecordLookup<E>(#E, CQSL::CQEnum::ELookups::Lookup, bHit, uProbes)\n"
+        "\n"
+        "#else\n"
+        "\n"
+        "#define CQENUM_LOOKUP(E, Lookup, bHit, uProbes)\n"
+        "\n"
+        "#endif\n"
+    };
+
+    constexpr const char* const pszHdrVisit =
+    {
+        "\n"
+        "//\n"
+        "//  Jump table dispatch on enum values. EnumVisit() takes a handler per value,\n"
+        "//  in the order defined, and passing the wrong number of them is a compile\n"
+        "//  error, so adding a value breaks any visits that don't handle it. A handler\n"
+        "//  is called with a std::integral_constant of its value if it accepts one, else\n"
+        "//  with no parameters. They should all return the type the first one does.\n"
+        "//\n"
+        "//  The dispatch is one indexed indirect call, through the dense index for\n"
+        "//  sparse enums. An invalid value goes to a last slot that throws.\n"
+        "//\n"
+        "template <typename E, size_t uIndex> using EnumConst = std::integral_constant\n"
+        "<\n"
+        "    E, EnumValueList<E>::s_aeValues[uIndex]\n"
+        ">;\n"
+        "\n"
+        "template <typename E, size_t uIndex, typename H> struct VisitResult\n"
+        "{\n"
+        "    using Type = typename std::conditional_t\n"
+        "    <\n"
+        "        std::is_invocable_v<H&, EnumConst<E, uIndex>>\n"
+        "        , std::invoke_result<H&, EnumConst<E, uIndex>>\n"
+        "        , std::invoke_result<H&>\n"
+        "    >::type;\n"
+        "};\n"
+        "\n"
+        "template <typename E, typename R, size_t uIndex, typename HT> R VisitOne(HT& tupHandlers)\n"
+        "{\n"
+        "    auto& hndlrCur = std::get<uIndex>(tupHandlers);\n"
+        "    if constexpr (std::is_invocable_v<decltype(hndlrCur), EnumConst<E, uIndex>>)\n"
+        "    {\n"
+        "        return hndlrCur(EnumConst<E, uIndex>());\n"
+        "    }\n"
+        "    else\n"
+        "    {\n"
+        "        return hndlrCur();\n"
+        "    }\n"
+        "}\n"
+        "\n"
+        "template <typename E, typename R, typename HT> [[noreturn]] R VisitBadValue(HT&)\n"
+        "{\n"
+        "    throw std::runtime_error(\"An invalid enum value was passed to EnumVisit\");\n"
+        "}\n"
+        "\n"
+        "template <typename E, typename R, typename HT, size_t... auIndices>\n"
+        "R VisitIndex(const uint32_t uIndex, HT& tupHandlers, std::index_sequence<auIndices...>)\n"
+        "{\n"
+        "    using PFnHandler = R (*)(HT&);\n"
+        "    static constexpr PFnHandler apfnTable[] =\n"
+        "    {\n"
+        "        &VisitOne<E, R, auIndices, HT>..., &VisitBadValue<E, R, HT>\n"
+        "    };\n"
+        "    constexpr uint32_t c_uCount = static_cast<uint32_t>(sizeof...(auIndices));\n"
+        "    return apfnTable[(uIndex < c_uCount) ? uIndex : c_uCount](tupHandlers);\n"
+        "}\n"
+        "\n"
+        "template <typename E, typename... Handlers>\n"
+        "decltype(auto) EnumVisit(const E eVal, Handlers&&... handlers)\n"
+        "{\n"
+        "    static_assert\n"
+        "    (\n"
+        "        sizeof...(Handlers) == EnumValueList<E>::c_uCount\n"
+        "        , \"EnumVisit requires a handler for every value of the enum\"\n"
+        "    );\n"
+        "\n"
+        "    using HT = std::tuple<Handlers&...>;\n"
+        "    using R = typename VisitResult<E, 0, std::tuple_element_t<0, std::tuple<Handlers...>>>::Type;\n"
+        "    HT tupHandlers(handlers...);\n"
+        "    return VisitIndex<E, R, HT>\n"
+        "    (\n"
+        "        uEnumToIndex(eVal), tupHandlers, std::make_index_sequence<sizeof...(Handlers)>()\n"
+        "    );\n"
+        "}\n"
+    };
+
+    constexpr const char* const pszHdrUnion =
+    {
+        "\n"
+        "//\n"
+        "//  Support for enums whose values have payload types. The generator creates an\n"
+        "//  alias of this for each such enum, with a payload type per value, in the order\n"
+        "//  defined, using NoPayload for values that don't have one. The payload is stored\n"
+        "//  inline, and the enum value is the discriminant. Copy, move, destruction and\n"
+        "//  Visit() go through tables indexed by the dense index of the current value, so\n"
+        "//  there are no virtual calls or heap allocations.\n"
+        "//\n"
+        "//  A default constructed one holds the first value, with a default constructed\n"
+        "//  payload. Payload types have to be no throw movable.\n"
+        "//\n"
+        "struct NoPayload {};\n"
+        "\n"
+        "template <typename E, typename... Payloads> class TaggedUnion\n"
+        "{\n"
+        "    public :\n"
+        "        static constexpr uint32_t c_uCount = EnumValueList<E>::c_uCount;\n"
+        "        static_assert\n"
+        "        (\n"
+        "            sizeof...(Payloads) == c_uCount\n"
+        "            , \"A tagged union needs a payload type for every value of the enum\"\n"
+        "        );\n"
+        "        static_assert\n"
+        "        (\n"
+        "            (std::is_nothrow_move_constructible_v<Payloads> && ...)\n"
+        "            , \"Tagged union payload types must be no throw movable\"\n"
+        "        );\n"
+        "\n"
+        "        template <E eVal> using PayloadType = std::tuple_element_t\n"
+        "        <\n"
+        "            uEnumToIndex(eVal), std::tuple<Payloads...>\n"
+        "        >;\n"
+        "\n"
+        "        // Create one with the indicated value, constructing its payload in place\n"
+        "        template <E eVal, typename... Args> static TaggedUnion Make(Args&&... args)\n"
+        "        {\n"
+        "            return TaggedUnion(std::integral_constant<E, eVal>(), std::forward<Args>(args)...);\n"
+        "        }\n"
+        "\n"
+        "        TaggedUnion() :\n"
+        "\n"
+        "            m_eTag(EnumValueList<E>::s_aeValues[0])\n"
+        "        {\n"
+        "            new (m_abStorage) PayloadAt<0>();\n"
+        "        }\n"
+        "\n"
+        "        TaggedUnion(const TaggedUnion& tuSrc) :\n"
+        "\n"
+        "            m_eTag(tuSrc.m_eTag)\n"
+        "        {\n"
+        "            CopyFrom(tuSrc, std::make_index_sequence<c_uCount>());\n"
+        "        }\n"
+        "\n"
+        "        TaggedUnion(TaggedUnion&& tuSrc) noexcept :\n"
+        "\n"
+        "            m_eTag(tuSrc.m_eTag)\n"
+        "        {\n"
+        "            MoveFrom(tuSrc, std::make_index_sequence<c_uCount>());\n"
+        "        }\n"
+        "\n"
+        "        ~TaggedUnion()\n"
+        "        {\n"
+        "            Destroy(std::make_index_sequence<c_uCount>());\n"
+        "        }\n"
+        "\n"
+        "        // Copy first, so that we are unchanged if the payload's copy throws\n"
+        "        TaggedUnion& operator=(const TaggedUnion& tuSrc)\n"
+        "        {\n"
+        "            if (&tuSrc != this)\n"
+        "            {\n"
+        "                TaggedUnion tuTmp(tuSrc);\n"
+        "                *this = std::move(tuTmp);\n"
+        "            }\n"
+        "            return *this;\n"
+        "        }\n"
+        "\n"
+        "        TaggedUnion& operator=(TaggedUnion&& tuSrc) noexcept\n"
+        "        {\n"
+        "            if (&tuSrc != this)\n"
+        "            {\n"
+        "                Destroy(std::make_index_sequence<c_uCount>());\n"
+        "                m_eTag = tuSrc.m_eTag;\n"
+        "                MoveFrom(tuSrc, std::make_index_sequence<c_uCount>());\n"
+        "            }\n"
+        "            return *this;\n"
+        "        }\n"
+        "\n"
+        "        E eTag() const noexcept\n"
+        "        {\n"
+        "            return m_eTag;\n"
+        "        }\n"
+        "\n"
+        "        template <E eVal> bool bIs() const noexcept\n"
+        "        {\n"
+        "            return m_eTag == eVal;\n"
+        "        }\n"
+        "\n"
+        "        // Get the payload if it is the current value, else throws\n"
+        "        template <E eVal> PayloadType<eVal>& Get()\n"
+        "        {\n"
+        "            CheckTag(eVal);\n"
+        "            return *std::launder(reinterpret_cast<PayloadType<eVal>*>(m_abStorage));\n"
+        "        }\n"
+        "\n"
+        "        template <E eVal> const PayloadType<eVal>& Get() const\n"
+        "        {\n"
+        "            CheckTag(eVal);\n"
+        "            return *std::launder(reinterpret_cast<const PayloadType<eVal>*>(m_abStorage));\n"
+        "        }\n"
+        "\n"
+        "        // Get the payload if it is the current value, else null\n"
+        "        template <E eVal> PayloadType<eVal>* pGet() noexcept\n"
+        "        {\n"
+        "            return (m_eTag == eVal) ? std::launder(reinterpret_cast<PayloadType<eVal>*>(m_abStorage)) : nullptr;\n"
+        "        }\n"
+        "\n"
+        "        template <E eVal> const PayloadType<eVal>* pGet() const noexcept\n"
+        "        {\n"
+        "            return (m_eTag == eVal)\n"
+        "                   ? std::launder(reinterpret_cast<const PayloadType<eVal>*>(m_abStorage)) : nullptr;\n"
+        "        }\n"
+        "\n"
+        "        //\n"
+        "        //  Change to the indicated value, constructing its payload in place. If the\n"
+        "        //  payload's constructor can throw, we build it first and move it in, so\n"
+        "        //  that we are unchanged if it does.\n"
+        "        //\n"
+        "        template <E eVal, typename... Args> PayloadType<eVal>& Set(Args&&... args)\n"
+        "        {\n"
+        "            using NewType = PayloadType<eVal>;\n"
+        "            if constexpr (std::is_nothrow_constructible_v<NewType, Args...>)\n"
+        "            {\n"
+        "                Destroy(std::make_index_sequence<c_uCount>());\n"
+        "                m_eTag = eVal;\n"
+        "                new (m_abStorage) NewType(std::forward<Args>(args)...);\n"
+        "            }\n"
+        "            else\n"
+        "            {\n"
+        "                NewType ptNew(std::forward<Args>(args)...);\n"
+        "                Destroy(std::make_index_sequence<c_uCount>());\n"
+        "                m_eTag = eVal;\n"
+        "                new (m_abStorage) NewType(std::move(ptNew));\n"
+        "            }\n"
+        "            return *std::launder(reinterpret_cast<NewType*>(m_abStorage));\n"
+        "        }\n"
+        "\n"
+        "        //\n"
+        "        //  Like EnumVisit(), it takes a handler per value, in the order defined. A\n"
+        "        //  handler is called with the payload if it accepts it, else with no\n"
+        "        //  parameters.\n"
+        "        //\n"
+        "        template <typename... Handlers> decltype(auto) Visit(Handlers&&... handlers)\n"
+        "        {\n"
+        "            return VisitImpl<unsigned char>(m_abStorage, std::forward<Handlers>(handlers)...);\n"
+        "        }\n"
+        "\n"
+        "        template <typename... Handlers> decltype(auto) Visit(Handlers&&... handlers) const\n"
+        "        {\n"
+        "            return VisitImpl<const unsigned char>(m_abStorage, std::forward<Handlers>(handlers)...);\n"
+        "        }\n"
+        "\n"
+        "    private :\n"
+        "        template <size_t uIndex> using PayloadAt = std::tuple_element_t<uIndex, std::tuple<Payloads...>>;\n"
+        "\n"
+        "        using PFnCopy = void (*)(unsigned char*, const unsigned char*);\n"
+        "        using PFnMove = void (*)(unsigned char*, unsigned char*);\n"
+        "        using PFnDestroy = void (*)(unsigned char*);\n"
+        "\n"
+        "        template <E eVal, typename... Args>\n"
+        "        explicit TaggedUnion(std::integral_constant<E, eVal>, Args&&... args) :\n"
+        "\n"
+        "            m_eTag(eVal)\n"
+        "        {\n"
+        "            new (m_abStorage) PayloadType<eVal>(std::forward<Args>(args)...);\n"
+        "        }\n"
+        "\n"
+        "        void CheckTag(const E eVal) const\n"
+        "        {\n"
+        "            if (m_eTag != eVal)\n"
+        "            {\n"
+        "                throw std::runtime_error(\"The tagged union does not hold the requested value\");\n"
+        "            }\n"
+        "        }\n"
+        "\n"
+        "        template <size_t uIndex> static void CopyOne(unsigned char* const pabTar, const unsigned char* const pabSrc)\n"
+        "        {\n"
+        "            new (pabTar) PayloadAt<uIndex>(*std::launder(reinterpret_cast<const PayloadAt<uIndex>*>(pabSrc)));\n"
+        "        }\n"
+        "\n"
+        "        template <size_t uIndex> static void MoveOne(unsigned char* const pabTar, unsigned char* const pabSrc)\n"
+        "        {\n"
+        "            new (pabTar) PayloadAt<uIndex>(std::move(*std::launder(reinterpret_cast<PayloadAt<uIndex>*>(pabSrc))));\n"
+        "        }\n"
+        "\n"
+        "        template <size_t uIndex> static void DestroyOne(unsigned char* const pabTar)\n"
+        "        {\n"
+        "            std::launder(reinterpret_cast<PayloadAt<uIndex>*>(pabTar))->~PayloadAt<uIndex>();\n"
+        "        }\n"
+        "\n"
+        "        template <size_t... auIndices>\n"
+        "        void CopyFrom(const TaggedUnion& tuSrc, std::index_sequence<auIndices...>)\n"
+        "        {\n"
+        "            static constexpr PFnCopy apfnTable[] = { &CopyOne<auIndices>... };\n"
+        "            apfnTable[uEnumToIndex(m_eTag)](m_abStorage, tuSrc.m_abStorage);\n"
+        "        }\n"
+        "\n"
+        "        template <size_t... auIndices>\n"
+        "        void MoveFrom(TaggedUnion& tuSrc, std::index_sequence<auIndices...>) noexcept\n"
+        "        {\n"
+        "            static constexpr PFnMove apfnTable[] = { &MoveOne<auIndices>... };\n"
+        "            apfnTable[uEnumToIndex(m_eTag)](m_abStorage, tuSrc.m_abStorage);\n"
+        "        }\n"
+        "\n"
+        "        template <size_t... auIndices> void Destroy(std::index_sequence<auIndices...>) noexcept\n"
+        "        {\n"
+        "            static constexpr PFnDestroy apfnTable[] = { &DestroyOne<auIndices>... };\n"
+        "            apfnTable[uEnumToIndex(m_eTag)](m_abStorage);\n"
+        "        }\n"
+        "\n"
+        "        template <typename R, size_t uIndex, typename S, typename HT>\n"
+        "        static R VisitOne(S* const pabStorage, HT& tupHandlers)\n"
+        "        {\n"
+        "            using ParamType = std::conditional_t<std::is_const_v<S>, const PayloadAt<uIndex>, PayloadAt<uIndex>>;\n"
+        "            auto& hndlrCur = std::get<uIndex>(tupHandlers);\n"
+        "            if constexpr (std::is_invocable_v<decltype(hndlrCur), ParamType&>)\n"
+        "            {\n"
+        "                return hndlrCur(*std::launder(reinterpret_cast<ParamType*>(pabStorage)));\n"
+        "            }\n"
+        "            else\n"
+        "            {\n"
+        "                return hndlrCur();\n"
+        "            }\n"
+        "        }\n"
+        "\n"
+        "        template <typename R, typename S, typename HT, size_t... auIndices>\n"
+        "        R VisitIndex(S* const pabStorage, HT& tupHandlers, std::index_sequence<auIndices...>) const\n"
+        "        {\n"
+        "            using PFnHandler = R (*)(S*, HT&);\n"
+        "            static constexpr PFnHandler apfnTable[] = { &VisitOne<R, auIndices, S, HT>... };\n"
+        "            return apfnTable[uEnumToIndex(m_eTag)](pabStorage, tupHandlers);\n"
+        "        }\n"
+        "\n"
+        "        template <typename S, typename... Handlers>\n"
+        "        decltype(auto) VisitImpl(S* const pabStorage, Handlers&&... handlers) const\n"
+        "        {\n"
+        "            static_assert\n"
+        "            (\n"
+        "                sizeof...(Handlers) == c_uCount\n"
+        "                , \"Visit requires a handler for every value of the enum\"\n"
+        "            );\n"
+        "\n"
+        "            using HT = std::tuple<Handlers&...>;\n"
+        "            using FirstType = std::tuple_element_t<0, std::tuple<Handlers...>>;\n"
+        "            using ParamType = std::conditional_t<std::is_const_v<S>, const PayloadAt<0>, PayloadAt<0>>;\n"
+        "            using R = typename std::conditional_t\n"
+        "            <\n"
+        "                std::is_invocable_v<FirstType&, ParamType&>\n"
+        "                , std::invoke_result<FirstType&, ParamType&>\n"
+        "                , std::invoke_result<FirstType&>\n"
+        "            >::type;\n"
+        "\n"
+        "            HT tupHandlers(handlers...);\n"
+        "            return VisitIndex<R>(pabStorage, tupHandlers, std::make_index_sequence<c_uCount>());\n"
+        "        }\n"
+        "\n"
+        "        E   m_eTag;\n"
+        "        alignas(Payloads...) unsigned char m_abStorage[std::max({ sizeof(Payloads)... })];\n"
+        "};\n"
+    };
+
+    constexpr const char* const pszHdrFromChars =
+    {
+        "\n"
+        "//\n"
+        "//  The forms of input that the generated EnumFromChars() methods will accept.\n"
+        "//  If both ordinals and alt values are enabled, a number is checked as an\n"
+        "//  ordinal first. Alt values are ignored for enums that don't define them.\n"
+        "//\n"
+        "enum class EFromChars : uint32_t\n"
+        "{\n"
+        "    Names           = 0x0001\n"
+        "    , Ordinals      = 0x0002\n"
+        "    , AltVals       = 0x0004\n"
+        "\n"
+        "    , NamesAndOrdinals = 0x0003\n"
+        "    , All           = 0x0007\n"
+        "};\n"
+        "\n"
+        "constexpr EFromChars operator|(const EFromChars eLHS, const EFromChars eRHS) noexcept\n"
+        "{\n"
+        "    return static_cast<EFromChars>(static_cast<uint32_t>(eLHS) | static_cast<uint32_t>(eRHS));\n"
+        "}\n"
+        "\n"
+        "constexpr bool bFromCharsRule(const EFromChars eRules, const EFromChars eTest) noexcept\n"
+        "{\n"
+        "    return (static_cast<uint32_t>(eRules) & static_cast<uint32_t>(eTest)) != 0;\n"
+        "}\n"
+    };
+
+    constexpr const char* const pszHdrNameTrie =
+    {
+        "\n"
+        "//\n"
+        "//  Support for incremental and prefix matching of value names. The generator\n"
+        "//  builds a trie of each enum's names (case insensitive, ASCII upper cased) and\n"
+        "//  specializes NameTrie for it. The names are sorted, so the names below any\n"
+        "//  node are a contiguous range of the sorted name list.\n"
+        "//\n"
+        "enum class ENameMatch { Match, NoMatch, NeedMore };\n"
+        "\n"
+        "struct NameTrieEdge\n"
+        "{\n"
+        "    char        chUpper;\n"
+        "    uint32_t    uTarget;\n"
+        "};\n"
+        "\n"
+        "struct NameTrieNode\n"
+        "{\n"
+        "    uint32_t    uFirstEdge;\n"
+        "    uint32_t    uEdgeCount;\n"
+        "\n"
+        "    // The range of sorted names that start with the text that leads to this node\n"
+        "    uint32_t    uFirstName;\n"
+        "    uint32_t    uEndName;\n"
+        "\n"
+        "    // If a name ends at this node, its sorted name index, else uNoName\n"
+        "    uint32_t    uNameIndex;\n"
+        "};\n"
+        "\n"
+        "constexpr uint32_t c_uTrieNoName = 0xFFFFFFFF;\n"
+        "\n"
+        "template <typename E> struct NameTrie;\n"
+        "\n"
+        "constexpr char chTrieUpper(const char chSrc) noexcept\n"
+        "{\n"
+        "    return ((chSrc >= 'a') && (chSrc <= 'z')) ? static_cast<char>(chSrc - 0x20) : chSrc;\n"
+        "}\n"
+        "\n"
+        "// Returns the node reached from uNode on the character, or c_uTrieNoName\n"
+        "template <typename E>\n"
+        "constexpr uint32_t uTrieStep(const uint32_t uNode, const char chNext) noexcept\n"
+        "{\n"
+        "    const char chUpper = chTrieUpper(chNext);\n"
+        "    const NameTrieNode& nodeCur = NameTrie<E>::s_anodeTable[uNode];\n"
+        "    for (uint32_t uIndex = 0; uIndex < nodeCur.uEdgeCount; uIndex++)\n"
+        "    {\n"
+        "        const NameTrieEdge& edgeCur = NameTrie<E>::s_aedgeTable[nodeCur.uFirstEdge + uIndex];\n"
+        "        if (edgeCur.chUpper == chUpper)\n"
+        "        {\n"
+        "            return edgeCur.uTarget;\n"
+        "        }\n"
+        "        if (edgeCur.chUpper > chUpper)\n"
+        "        {\n"
+        "            break;\n"
+        "        }\n"
+        "    }\n"
+        "    return c_uTrieNoName;\n"
+        "}\n"
+        "\n"
+        "// A range of values, in name order\n"
+        "template <typename E> using NameRange = ValueRange<E>;\n"
+        "\n"
+        "// Get the values (in name order) whose names start with the prefix\n"
+        "template <typename E>\n"
+        "constexpr NameRange<E> PrefixRange(const std::string_view& svPrefix) noexcept\n"
+        "{\n"
+        "    uint32_t uNode = 0;\n"
+        "    for (const char chCur : svPrefix)\n"
+        "    {\n"
+        "        uNode = uTrieStep<E>(uNode, chCur);\n"
+        "        if (uNode == c_uTrieNoName)\n"
+        "        {\n"
+        "            return NameRange<E>{ NameTrie<E>::s_aeByName, NameTrie<E>::s_aeByName };\n"
+        "        }\n"
+        "    }\n"
+        "    const NameTrieNode& nodeEnd = NameTrie<E>::s_anodeTable[uNode];\n"
+        "    return NameRange<E>\n"
+        "    {\n"
+        "        NameTrie<E>::s_aeByName + nodeEnd.uFirstName, NameTrie<E>::s_aeByName + nodeEnd.uEndName\n"
+        "    };\n"
+        "}\n"
+        "\n"
+        "//\n"
+        "//  Matches a name that arrives in chunks. Each chunk is fed in and it reports\n"
+        "//  a match, no match, or that it needs more input. A match is reported as soon\n"
+        "//  as a name is complete and no other, longer, name starts with it. Otherwise the\n"
+        "//  first character that can't continue a name ends it, or call eEnd() if the input\n"
+        "//  is done. In either case, szUsed indicates how much of the chunk was consumed,\n"
+        "//  so the caller can continue from there.\n"
+        "//\n"
+        "template <typename E> class NameMatcher\n"
+        "{\n"
+        "    public :\n"
+        "        constexpr NameMatcher() noexcept = default;\n"
+        "\n"
+        "        ENameMatch eEnd() noexcept\n"
+        "        {\n"
+        "            if (m_eState == ENameMatch::NeedMore)\n"
+        "            {\n"
+        "                m_eState = (NameTrie<E>::s_anodeTable[m_uNode].uNameIndex == c_uTrieNoName)\n"
+        "                           ? ENameMatch::NoMatch : ENameMatch::Match;\n"
+        "            }\n"
+        "            return m_eState;\n"
+        "        }\n"
+        "\n"
+        "        ENameMatch eFeed(const char* const pchChunk, const size_t szLen, size_t& szUsed) noexcept\n"
+        "        {\n"
+        "            szUsed = 0;\n"
+        "            while ((m_eState == ENameMatch::NeedMore) && (szUsed < szLen))\n"
+        "            {\n"
+        "                const uint32_t uNext = uTrieStep<E>(m_uNode, pchChunk[szUsed]);\n"
+        "                if (uNext == c_uTrieNoName)\n"
+        "                {\n"
+        "                    // This char ends it, and isn't consumed\n"
+        "                    return eEnd();\n"
+        "                }\n"
+        "\n"
+        "                m_uNode = uNext;\n"
+        "                szUsed++;\n"
+        "\n"
+        "                const NameTrieNode& nodeCur = NameTrie<E>::s_anodeTable[m_uNode];\n"
+        "                if ((nodeCur.uNameIndex != c_uTrieNoName) && !nodeCur.uEdgeCount)\n"
+        "                {\n"
+        "                    m_eState = ENameMatch::Match;\n"
+        "                }\n"
+        "            }\n"
+        "            return m_eState;\n"
+        "        }\n"
+        "\n"
+        "        // Only valid once a match has been reported\n"
+        "        E eMatch() const noexcept\n"
+        "        {\n"
+        "            return NameTrie<E>::s_aeByName[NameTrie<E>::s_anodeTable[m_uNode].uNameIndex];\n"
+        "        }\n"
+        "\n"
+        "        // The values whose names start with what has been fed so far\n"
+        "        NameRange<E> rangeCandidates() const noexcept\n"
+        "        {\n"
+        "            if (m_eState == ENameMatch::NoMatch)\n"
+        "            {\n"
+        "                return NameRange<E>{ NameTrie<E>::s_aeByName, NameTrie<E>::s_aeByName };\n"
+        "            }\n"
+        "            const NameTrieNode& nodeCur = NameTrie<E>::s_anodeTable[m_uNode];\n"
+        "            return NameRange<E>\n"
+        "            {\n"
+        "                NameTrie<E>::s_aeByName + nodeCur.uFirstName\n"
+        "                , NameTrie<E>::s_aeByName + nodeCur.uEndName\n"
+        "            };\n"
+        "        }\n"
+        "\n"
+        "        void Reset() noexcept\n"
+        "        {\n"
+        "            m_uNode = 0;\n"
+        "            m_eState = ENameMatch::NeedMore;\n"
+        "        }\n"
+        "\n"
+        "    private :\n"
+        "        uint32_t    m_uNode = 0;\n"
+        "        ENameMatch  m_eState = ENameMatch::NeedMore;\n"
+        "};\n"
+    };
+
+    constexpr const char* const pszHdrRemap =
+    {
+        "//\n"
+        "//  Bulk remapping of persisted ordinals through a generated [enum]Remap table,\n"
+        "//  which is indexed by the old ordinal and has the new one. Old values outside\n"
+        "//  of the table, or whose entry is the removed marker, get the bad value, and we\n"
+        "//  return how many did. The source and target can be the same. 4 byte values are\n"
+        "//  done 8 at a time with AVX2 gathers, and 1 byte values 16 at a time with a\n"
+        "//  byte shuffle if the table has 16 or fewer entries.\n"
+        "//\n"
+        "template <typename T>\n"
+        "size_t szRemapValues(const  T* const    patSrc\n"
+        "                    , const size_t      szCount\n"
+        "                    ,       T* const    patTar\n"
+        "                    , const T* const    patTable\n"
+        "                    , const uint32_t    uTableSize\n"
+        "                    , const T           tRemoved\n"
+        "                    , const T           tBad) noexcept\n"
+        "{\n"
+        "    static_assert(std::is_integral_v<T>, \"Remapping is only for integral ordinals\");\n"
+        "\n"
+        "    size_t szBad = 0;\n"
+        "    size_t szIndex = 0;\n"
+        "#if defined(__AVX2__)\n"
+        "    if constexpr (sizeof(T) == 4)\n"
         "    {\n"
-        "        if (paTable[uIndex].iAltVal == iFind)\n"
+        "        if (uTableSize)\n"
         "        {\n"
-        "            return uIndex;\n"
+        "            // Unsigned min against the last index tells us if it's in range\n"
+        "            const __m256i vecLast = _mm256_set1_epi32(static_cast<int32_t>(uTableSize - 1));\n"
+        "            const __m256i vecRemoved = _mm256_set1_epi32(static_cast<int32_t>(tRemoved));\n"
+        "            const __m256i vecBad = _mm256_set1_epi32(static_cast<int32_t>(tBad));\n"
+        "            for (; szIndex + 8 <= szCount; szIndex += 8)\n"
+        "            {\n"
+        "                const __m256i vecOld = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(patSrc + szIndex));\n"
+        "                const __m256i vecIn = _mm256_cmpeq_epi32(_mm256_min_epu32(vecOld, vecLast), vecOld);\n"
+        "                const __m256i vecNew = _mm256_mask_i32gather_epi32\n"
+        "                (\n"
+        "                    vecBad, reinterpret_cast<const int*>(patTable), vecOld, vecIn, 4\n"
+        "                );\n"
+        "                const __m256i vecGone = _mm256_or_si256\n"
+        "                (\n"
+        "                    _mm256_andnot_si256(vecIn, _mm256_set1_epi32(-1))\n"
+        "                    , _mm256_cmpeq_epi32(vecNew, vecRemoved)\n"
+        "                );\n"
+        "                _mm256_storeu_si256\n"
+        "                (\n"
+        "                    reinterpret_cast<__m256i*>(patTar + szIndex), _mm256_blendv_epi8(vecNew, vecBad, vecGone)\n"
+        "                );\n"
+        "                szBad += uWordBitCount(uint32_t(_mm256_movemask_ps(_mm256_castsi256_ps(vecGone))));\n"
+        "            }\n"
         "        }\n"
         "    }\n"
-        "    return std::numeric_limits<uint32_t>::max();\n"
-        "}\n\n"
+        "#endif\n"
+        "#if defined(__AVX2__) || defined(__SSSE3__)\n"
+        "    if constexpr (sizeof(T) == 1)\n"
+        "    {\n"
+        "        if (uTableSize && (uTableSize <= 16))\n"
+        "        {\n"
+        "            alignas(16) T atLookup[16];\n"
+        "            for (uint32_t uAt = 0; uAt < 16; uAt++)\n"
+        "            {\n"
+        "                atLookup[uAt] = (uAt < uTableSize) ? patTable[uAt] : tRemoved;\n"
+        "            }\n"
+        "\n"
+        "            const __m128i vecLookup = _mm_load_si128(reinterpret_cast<const __m128i*>(atLookup));\n"
+        "            const __m128i vecLast = _mm_set1_epi8(static_cast<char>(uTableSize - 1));\n"
+        "            const __m128i vecRemoved = _mm_set1_epi8(static_cast<char>(tRemoved));\n"
+        "            const __m128i vecBad = _mm_set1_epi8(static_cast<char>(tBad));\n"
+        "            for (; szIndex + 16 <= szCount; szIndex += 16)\n"
+        "            {\n"
+        "                const __m128i vecOld = _mm_loadu_si128(reinterpret_cast<const __m128i*>(patSrc + szIndex));\n"
+        "                const __m128i vecIn = _mm_cmpeq_epi8(_mm_min_epu8(vecOld, vecLast), vecOld);\n"
+        "                const __m128i vecNew = _mm_shuffle_epi8(vecLookup, vecOld);\n"
+        "                const __m128i vecGone = _mm_or_si128\n"
+        "                (\n"
+        "                    _mm_andnot_si128(vecIn, _mm_set1_epi8(-1)), _mm_cmpeq_epi8(vecNew, vecRemoved)\n"
+        "                );\n"
+        "                _mm_storeu_si128\n"
+        "                (\n"
+        "                    reinterpret_cast<__m128i*>(patTar + szIndex)\n"
+        "                    , _mm_or_si128(_mm_and_si128(vecGone, vecBad), _mm_andnot_si128(vecGone, vecNew))\n"
+        "                );\n"
+        "                szBad += uWordBitCount(uint32_t(_mm_movemask_epi8(vecGone)));\n"
+        "            }\n"
+        "        }\n"
+        "    }\n"
+        "#endif\n"
+        "    for (; szIndex < szCount; szIndex++)\n"
+        "    {\n"
+        "        const T tOld = patSrc[szIndex];\n"
+        "        T tNew = tRemoved;\n"
+        "        if (static_cast<uint64_t>(tOld) < uTableSize)\n"
+        "        {\n"
+        "            tNew = patTable[static_cast<size_t>(tOld)];\n"
+        "        }\n"
+        "\n"
+        "        if (tNew == tRemoved)\n"
+        "        {\n"
+        "            tNew = tBad;\n"
+        "            szBad++;\n"
+        "        }\n"
+        "        patTar[szIndex] = tNew;\n"
+        "    }\n"
+        "    return szBad;\n"
+        "}\n"
+    };
 
-        "uint32_t uNameToIndex( const   EnumTableVal* const paTable\n"
-        "                       , const uint32_t            uCount\n"
-        "                       , const std::wstring_view&  svFind)\n"
+    constexpr const char* const pszHdrXlat =
+    {
+        "//\n"
+        "//  Bulk translation of values through a generated table, used for the alt value\n"
+        "//  conversions. If the keys are close enough together, the table is dense, indexed\n"
+        "//  by the key minus the lowest one, and unused entries have a marker value that is\n"
+        "//  not a valid result. Else it has the keys in sorted order, and the results that\n"
+        "//  go with them, which we binary search.\n"
+        "//\n"
+        "template <typename TK, typename TR> struct XlatTable\n"
         "{\n"
-        "    for (uint32_t uIndex = 0; uIndex < uCount; uIndex++)\n"
+        "    TK          tDenseMin;\n"
+        "    uint32_t    uDenseSize;\n"
+        "    const TR*   patDense;\n"
+        "    TR          tUnused;\n"
+        "    uint32_t    uSortedCount;\n"
+        "    const TK*   patSortedKeys;\n"
+        "    const TR*   patSortedRes;\n"
+        "};\n"
+        "\n"
+        "//\n"
+        "//  Translate a buffer of keys. Invalid ones get the bad value, and we return how\n"
+        "//  many there were. If an invalid mask is passed, it must have a bit per key, in\n"
+        "//  64 bit words, and the bits for the invalid ones are set. When the keys and the\n"
+        "//  results are both 4 bytes, they are done 8 at a time with AVX2. For a dense table\n"
+        "//  that's a gather. For a small sorted one we compare against each key, else it is\n"
+        "//  a branchless binary search of all 8 at once, with gathers.\n"
+        "//\n"
+        "template <typename TS, typename TK, typename TR>\n"
+        "size_t szXlatValues(const   TS* const               patSrc\n"
+        "                    , const size_t                  szCount\n"
+        "                    ,       TR* const               patTar\n"
+        "                    , const XlatTable<TK, TR>&      xtblSrc\n"
+        "                    , const TR                      tBad\n"
+        "                    ,       uint64_t* const         pauInvalid) noexcept\n"
+        "{\n"
+        "    static_assert(std::is_integral_v<TK>, \"Translation keys must be integral\");\n"
+        "\n"
+        "    if (pauInvalid)\n"
         "    {\n"
-        "        if (_wcsicmp(svFind.data(), paTable[uIndex].pszName) == 0)\n"
+        "        std::fill(pauInvalid, pauInvalid + ((szCount + 63) / 64), uint64_t(0));\n"
+        "    }\n"
+        "\n"
+        "    size_t szBad = 0;\n"
+        "    size_t szIndex = 0;\n"
+        "#if defined(__AVX2__)\n"
+        "    if constexpr ((sizeof(TS) == 4) && (sizeof(TK) == 4) && (sizeof(TR) == 4))\n"
+        "    {\n"
+        "        const __m256i vecBad = _mm256_set1_epi32(static_cast<int32_t>(tBad));\n"
+        "        auto fnStore = [&](const __m256i vecNew, const __m256i vecGone)\n"
         "        {\n"
-        "            return uIndex;\n"
+        "            _mm256_storeu_si256\n"
+        "            (\n"
+        "                reinterpret_cast<__m256i*>(patTar + szIndex), _mm256_blendv_epi8(vecNew, vecBad, vecGone)\n"
+        "            );\n"
+        "            const uint32_t uGone = uint32_t(_mm256_movemask_ps(_mm256_castsi256_ps(vecGone)));\n"
+        "            szBad += uWordBitCount(uGone);\n"
+        "            if (pauInvalid)\n"
+        "            {\n"
+        "                pauInvalid[szIndex / 64] |= uint64_t(uGone) << (szIndex % 64);\n"
+        "            }\n"
+        "        };\n"
+        "\n"
+        "        if (xtblSrc.uDenseSize)\n"
+        "        {\n"
+        "            // Unsigned min against the last index tells us if it's in range\n"
+        "            const __m256i vecMin = _mm256_set1_epi32(static_cast<int32_t>(xtblSrc.tDenseMin));\n"
+        "            const __m256i vecLast = _mm256_set1_epi32(static_cast<int32_t>(xtblSrc.uDenseSize - 1));\n"
+        "            const __m256i vecUnused = _mm256_set1_epi32(static_cast<int32_t>(xtblSrc.tUnused));\n"
+        "            for (; szIndex + 8 <= szCount; szIndex += 8)\n"
+        "            {\n"
+        "                const __m256i vecAt = _mm256_sub_epi32\n"
+        "                (\n"
+        "                    _mm256_loadu_si256(reinterpret_cast<const __m256i*>(patSrc + szIndex)), vecMin\n"
+        "                );\n"
+        "                const __m256i vecIn = _mm256_cmpeq_epi32(_mm256_min_epu32(vecAt, vecLast), vecAt);\n"
+        "                const __m256i vecNew = _mm256_mask_i32gather_epi32\n"
+        "                (\n"
+        "                    vecBad, reinterpret_cast<const int*>(xtblSrc.patDense), vecAt, vecIn, 4\n"
+        "                );\n"
+        "                fnStore\n"
+        "                (\n"
+        "                    vecNew\n"
+        "                    , _mm256_or_si256\n"
+        "                      (\n"
+        "                          _mm256_andnot_si256(vecIn, _mm256_set1_epi32(-1))\n"
+        "                          , _mm256_cmpeq_epi32(vecNew, vecUnused)\n"
+        "                      )\n"
+        "                );\n"
+        "            }\n"
+        "        }\n"
+        "        else if (xtblSrc.uSortedCount <= 32)\n"
+        "        {\n"
+        "            for (; szIndex + 8 <= szCount; szIndex += 8)\n"
+        "            {\n"
+        "                const __m256i vecKey = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(patSrc + szIndex));\n"
+        "                __m256i vecNew = vecBad;\n"
+        "                __m256i vecFound = _mm256_setzero_si256();\n"
+        "                for (uint32_t uAt = 0; uAt < xtblSrc.uSortedCount; uAt++)\n"
+        "                {\n"
+        "                    const __m256i vecMatch = _mm256_cmpeq_epi32\n"
+        "                    (\n"
+        "                        vecKey, _mm256_set1_epi32(static_cast<int32_t>(xtblSrc.patSortedKeys[uAt]))\n"
+        "                    );\n"
+        "                    vecNew = _mm256_blendv_epi8\n"
+        "                    (\n"
+        "                        vecNew, _mm256_set1_epi32(static_cast<int32_t>(xtblSrc.patSortedRes[uAt])), vecMatch\n"
+        "                    );\n"
+        "                    vecFound = _mm256_or_si256(vecFound, vecMatch);\n"
+        "                }\n"
+        "                fnStore(vecNew, _mm256_andnot_si256(vecFound, _mm256_set1_epi32(-1)));\n"
+        "            }\n"
+        "        }\n"
+        "        else\n"
+        "        {\n"
+        "            //\n"
+        "            //  Find the last key that is <= each one, which is the one we want if it\n"
+        "            //  is there at all. Unsigned keys are flipped to use the signed compare.\n"
+        "            //\n"
+        "            const __m256i vecFlip = _mm256_set1_epi32(std::is_signed_v<TK> ? 0 : INT32_MIN);\n"
+        "            const int* const piKeys = reinterpret_cast<const int*>(xtblSrc.patSortedKeys);\n"
+        "            for (; szIndex + 8 <= szCount; szIndex += 8)\n"
+        "            {\n"
+        "                const __m256i vecKey = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(patSrc + szIndex));\n"
+        "                const __m256i vecCmpKey = _mm256_xor_si256(vecKey, vecFlip);\n"
+        "                __m256i vecBase = _mm256_setzero_si256();\n"
+        "                for (uint32_t uLeft = xtblSrc.uSortedCount; uLeft > 1; )\n"
+        "                {\n"
+        "                    const uint32_t uHalf = uLeft / 2;\n"
+        "                    const __m256i vecHalf = _mm256_set1_epi32(static_cast<int32_t>(uHalf));\n"
+        "                    const __m256i vecProbe = _mm256_xor_si256\n"
+        "                    (\n"
+        "                        _mm256_i32gather_epi32(piKeys, _mm256_add_epi32(vecBase, vecHalf), 4), vecFlip\n"
+        "                    );\n"
+        "                    vecBase = _mm256_add_epi32\n"
+        "                    (\n"
+        "                        vecBase, _mm256_andnot_si256(_mm256_cmpgt_epi32(vecProbe, vecCmpKey), vecHalf)\n"
+        "                    );\n"
+        "                    uLeft -= uHalf;\n"
+        "                }\n"
+        "                const __m256i vecFound = _mm256_cmpeq_epi32(_mm256_i32gather_epi32(piKeys, vecBase, 4), vecKey);\n"
+        "                const __m256i vecNew = _mm256_mask_i32gather_epi32\n"
+        "                (\n"
+        "                    vecBad, reinterpret_cast<const int*>(xtblSrc.patSortedRes), vecBase, vecFound, 4\n"
+        "                );\n"
+        "                fnStore(vecNew, _mm256_andnot_si256(vecFound, _mm256_set1_epi32(-1)));\n"
+        "            }\n"
         "        }\n"
         "    }\n"
-        "    return std::numeric_limits<uint32_t>::max();\n"
-        "}\n\n"
+        "#endif\n"
+        "    for (; szIndex < szCount; szIndex++)\n"
+        "    {\n"
+        "        const TK tKey = static_cast<TK>(patSrc[szIndex]);\n"
+        "        TR tNew = tBad;\n"
+        "        bool bFound = false;\n"
+        "        if (xtblSrc.uDenseSize)\n"
+        "        {\n"
+        "            // Wrapping makes keys below the min out of range as well\n"
+        "            const uint64_t uAt = static_cast<uint64_t>(tKey) - static_cast<uint64_t>(xtblSrc.tDenseMin);\n"
+        "            if (uAt < xtblSrc.uDenseSize)\n"
+        "            {\n"
+        "                tNew = xtblSrc.patDense[uAt];\n"
+        "                bFound = (tNew != xtblSrc.tUnused);\n"
+        "            }\n"
+        "        }\n"
+        "        else\n"
+        "        {\n"
+        "            // Branchless, since invalid and random keys make the branches unpredictable\n"
+        "            uint32_t uBase = 0;\n"
+        "            for (uint32_t uLeft = xtblSrc.uSortedCount; uLeft > 1; )\n"
+        "            {\n"
+        "                const uint32_t uHalf = uLeft / 2;\n"
+        "                uBase += (xtblSrc.patSortedKeys[uBase + uHalf] <= tKey) ? uHalf : 0;\n"
+        "                uLeft -= uHalf;\n"
+        "            }\n"
+        "            if (xtblSrc.patSortedKeys[uBase] == tKey)\n"
+        "            {\n"
+        "                tNew = xtblSrc.patSortedRes[uBase];\n"
+        "                bFound = true;\n"
+        "            }\n"
+        "        }\n"
+        "\n"
+        "        if (!bFound)\n"
+        "        {\n"
+        "            tNew = tBad;\n"
+        "            szBad++;\n"
+        "            if (pauInvalid)\n"
+        "            {\n"
+        "                pauInvalid[szIndex / 64] |= uint64_t(1) << (szIndex % 64);\n"
+        "            }\n"
+        "        }\n"
+        "        patTar[szIndex] = tNew;\n"
+        "    }\n"
+        "    return szBad;\n"
+        "}\n"
+    };
+
+    constexpr const char* const pszHdrRegistry =
+    {
+        "//\n"
+        "//  The static reflection registry. Each generated cpp file has a constant, type\n"
+        "//  name sorted list of descriptors for its enums, and puts a pointer to it into\n"
+        "//  a linker section. The linker gathers those up, so there's nothing done at\n"
+        "//  startup, and finding an enum by name is a binary search of each file's list.\n"
+        "//  Values are passed as int64_t so that generic code doesn't need the type. The\n"
+        "//  text lookups are null if the enum doesn't have them, and they throw for an\n"
+        "//  invalid value, as the typed ones do.\n"
+        "//\n"
+        "//  The registry is per module, so a DLL or shared library only sees its own\n"
+        "//  enums. If the linker section isn't supported, CQENUM_REGISTRY_SECTION isn't\n"
+        "//  defined and the registry is just empty.\n"
+        "//\n"
+        "struct EnumDescriptor\n"
+        "{\n"
+        "    const char*         pszTypeName;\n"
+        "    EEnumKinds          eKind;\n"
+        "    uint32_t            uCount;\n"
+        "    uint64_t            uFingerprint;\n"
+        "    int64_t             (*pfnValueAt)(uint32_t);\n"
+        "    const wchar_t*      (*pfnToName)(int64_t);\n"
+        "    bool                (*pfnFromName)(const std::wstring_view&, int64_t&);\n"
+        "    bool                (*pfnIsValid)(int64_t);\n"
+        "    const wchar_t*      (*pfnToText1)(int64_t);\n"
+        "    const wchar_t*      (*pfnToText2)(int64_t);\n"
+        "};\n"
+        "\n"
+        "struct EnumDescriptorList\n"
+        "{\n"
+        "    const EnumDescriptor*   paDescs;\n"
+        "    uint32_t                uCount;\n"
+        "};\n"
+        "\n"
+        "// The type erased wrappers the descriptors point to\n"
+        "template <typename E> int64_t iDescValueAt(const uint32_t uIndex)\n"
+        "{\n"
+        "    return static_cast<int64_t>(EnumValueList<E>::s_aeValues[uIndex]);\n"
+        "}\n"
+        "template <typename E> const wchar_t* pszDescToName(const int64_t iVal)\n"
+        "{\n"
+        "    return EnumTraits<E>::pfnToName(static_cast<E>(iVal));\n"
+        "}\n"
+        "template <typename E> bool bDescFromName(const std::wstring_view& svName, int64_t& iToFill)\n"
+        "{\n"
+        "    E eVal;\n"
+        "    if (!EnumTraits<E>::pfnFromName(svName, eVal))\n"
+        "    {\n"
+        "        return false;\n"
+        "    }\n"
+        "    iToFill = static_cast<int64_t>(eVal);\n"
+        "    return true;\n"
+        "}\n"
+        "template <typename E> bool bDescIsValid(const int64_t iVal)\n"
+        "{\n"
+        "    return EnumTraits<E>::pfnIsValid(static_cast<E>(iVal));\n"
+        "}\n"
+        "template <typename E> const wchar_t* pszDescToText1(const int64_t iVal)\n"
+        "{\n"
+        "    return EnumTraits<E>::pfnToText1(static_cast<E>(iVal));\n"
+        "}\n"
+        "template <typename E> const wchar_t* pszDescToText2(const int64_t iVal)\n"
+        "{\n"
+        "    return EnumTraits<E>::pfnToText2(static_cast<E>(iVal));\n"
+        "}\n"
+        "\n"
+        "#if defined(_MSC_VER)\n"
+        "#pragma section(\"cqenum$a\", read)\n"
+        "#pragma section(\"cqenum$m\", read)\n"
+        "#pragma section(\"cqenum$z\", read)\n"
+        "#define CQENUM_REGISTRY_SECTION __declspec(allocate(\"cqenum$m\"))\n"
+        "__declspec(allocate(\"cqenum$a\")) __declspec(selectany) extern const EnumDescriptorList* const pedlRegStart = nullptr;\n"
+        "__declspec(allocate(\"cqenum$z\")) __declspec(selectany) extern const EnumDescriptorList* const pedlRegEnd = nullptr;\n"
+        "#elif defined(__APPLE__)\n"
+        "#define CQENUM_REGISTRY_SECTION __attribute__((used, section(\"__DATA,cqenum_reg\")))\n"
+        "extern \"C\" const EnumDescriptorList* const pedlRegStart __asm(\"section$start$__DATA$cqenum_reg\");\n"
+        "extern \"C\" const EnumDescriptorList* const pedlRegEnd __asm(\"section$end$__DATA$cqenum_reg\");\n"
+        "#elif defined(__ELF__)\n"
+        "#if defined(__has_attribute)\n"
+        "#if __has_attribute(retain)\n"
+        "#define CQENUM_REGISTRY_SECTION __attribute__((used, retain, section(\"cqenum_reg\")))\n"
+        "#endif\n"
+        "#endif\n"
+        "#if !defined(CQENUM_REGISTRY_SECTION)\n"
+        "#define CQENUM_REGISTRY_SECTION __attribute__((used, section(\"cqenum_reg\")))\n"
+        "#endif\n"
+        "extern \"C\" const EnumDescriptorList* const __start_cqenum_reg[] __attribute__((weak));\n"
+        "extern \"C\" const EnumDescriptorList* const __stop_cqenum_reg[] __attribute__((weak));\n"
+        "#endif\n"
+        "\n"
+        "//\n"
+        "//  Call back for each file's list. The MSVC linker can pad the section with zeros,\n"
+        "//  so we skip nulls.\n"
+        "//\n"
+        "template <typename T> void ForEachEnumDescriptorList(T&& fnCallback)\n"
+        "{\n"
+        "#if defined(_MSC_VER)\n"
+        "    const EnumDescriptorList* const* ppedlCur = &pedlRegStart + 1;\n"
+        "    const EnumDescriptorList* const* const ppedlEnd = &pedlRegEnd;\n"
+        "#elif defined(__APPLE__)\n"
+        "    const EnumDescriptorList* const* ppedlCur = &pedlRegStart;\n"
+        "    const EnumDescriptorList* const* const ppedlEnd = &pedlRegEnd;\n"
+        "#elif defined(__ELF__)\n"
+        "    const EnumDescriptorList* const* ppedlCur = __start_cqenum_reg;\n"
+        "    const EnumDescriptorList* const* const ppedlEnd = __stop_cqenum_reg;\n"
+        "#else\n"
+        "    const EnumDescriptorList* const* ppedlCur = nullptr;\n"
+        "    const EnumDescriptorList* const* const ppedlEnd = nullptr;\n"
+        "#endif\n"
+        "    for (; ppedlCur < ppedlEnd; ppedlCur++)\n"
+        "    {\n"
+        "        if (*ppedlCur)\n"
+        "        {\n"
+        "            fnCallback(**ppedlCur);\n"
+        "        }\n"
+        "    }\n"
+        "}\n"
+        "\n"
+        "// Call back for every registered enum\n"
+        "template <typename T> void ForEachEnumDescriptor(T&& fnCallback)\n"
+        "{\n"
+        "    ForEachEnumDescriptorList\n"
+        "    (\n"
+        "        [&fnCallback](const EnumDescriptorList& edlCur)\n"
+        "        {\n"
+        "            for (uint32_t uIndex = 0; uIndex < edlCur.uCount; uIndex++)\n"
+        "            {\n"
+        "                fnCallback(edlCur.paDescs[uIndex]);\n"
+        "            }\n"
+        "        }\n"
+        "    );\n"
+        "}\n"
+        "\n"
+        "// Find an enum by its namespace qualified type name, e.g. \"MyNS::EColors\"\n"
+        "inline const EnumDescriptor* pFindEnumDescriptor(const std::string_view& svTypeName)\n"
+        "{\n"
+        "    const EnumDescriptor* pedescRet = nullptr;\n"
+        "    ForEachEnumDescriptorList\n"
+        "    (\n"
+        "        [&](const EnumDescriptorList& edlCur)\n"
+        "        {\n"
+        "            if (pedescRet)\n"
+        "            {\n"
+        "                return;\n"
+        "            }\n"
+        "\n"
+        "            const EnumDescriptor* const pedescEnd = edlCur.paDescs + edlCur.uCount;\n"
+        "            const EnumDescriptor* const pedescFound = std::lower_bound\n"
+        "            (\n"
+        "                edlCur.paDescs\n"
+        "                , pedescEnd\n"
+        "                , svTypeName\n"
+        "                , [](const EnumDescriptor& edescCur, const std::string_view& svFind)\n"
+        "                  {\n"
+        "                      return std::string_view(edescCur.pszTypeName) < svFind;\n"
+        "                  }\n"
+        "            );\n"
+        "            if ((pedescFound != pedescEnd) && (svTypeName == pedescFound->pszTypeName))\n"
+        "            {\n"
+        "                pedescRet = pedescFound;\n"
+        "            }\n"
+        "        }\n"
+        "    );\n"
+        "    return pedescRet;\n"
+        "}\n"
+    };
+
+    constexpr const char* const pszHdrSupportClose =
+    {
+        "\n}};\n"
+        "#endif\n\n"
     };
+
+
+    //
+    //  Build the schema fingerprint of an enum. It covers what persisted values mean,
+    //  so the type, the underlying type, and the identity (stable id if it has them,
+    //  else the name) and ordinal of each value. Text, attributes and so forth can
+    //  change without changing it. It's a 64 bit FNV-1a hash.
+    //
+    uint64_t uSchemaFingerprint(const EnumInfo& enumiSrc)
+    {
+        std::string strSchema;
+        switch(enumiSrc.m_eType)
+        {
+            case EEnumTypes::Arbitary : strSchema = "Arbitrary"; break;
+            case EEnumTypes::Bitmap : strSchema = "Bitmap"; break;
+            case EEnumTypes::FlagSet : strSchema = "FlagSet"; break;
+            case EEnumTypes::Standard : strSchema = "Standard"; break;
+
+            default :
+                throw std::runtime_error("Internal: Unknown enum type in schema fingerprint");
+                break;
+        };
+        strSchema.push_back(':');
+        strSchema.append(enumiSrc.m_strUnderType);
+        strSchema.push_back('|');
+        for (const EnumValInfo& evalCur : enumiSrc.m_vValues)
+        {
+            if (evalCur.m_bStableId)
+            {
+                strSchema.push_back('#');
+                strSchema.append(std::to_string(evalCur.m_uStableId));
+            }
+            else
+            {
+                strSchema.append(evalCur.m_strName);
+            }
+            strSchema.push_back('=');
+            strSchema.append(std::to_string(evalCur.m_iOrdinal));
+            strSchema.push_back(';');
+        }
+
+        uint64_t uHash = 0xCBF29CE484222325ULL;
+        for (const char chCur : strSchema)
+        {
+            uHash ^= static_cast<unsigned char>(chCur);
+            uHash *= 0x100000001B3ULL;
+        }
+        return uHash;
+    }
+
+
+    //
+    //  Generate a table for bulk translation of keys to results. If the keys are
+    //  close enough together, we do a dense table indexed by the key minus the lowest
+    //  key, else sorted keys and results. Alt values can be duplicated, so the first
+    //  one wins, as it does in the one at a time lookups. The results are passed as
+    //  numbers, with a cast put around them if they are enums.
+    //
+    void GenXlatTable(          std::ostream&                               strmTar
+                        , const std::string&                                strName
+                        , const std::string&                                strKeyType
+                        , const std::string&                                strResType
+                        , const bool                                        bResEnum
+                        , const std::vector<std::pair<int64_t, int64_t>>&   vPairs)
+    {
+        std::vector<std::pair<int64_t, int64_t>> vSorted;
+        for (const std::pair<int64_t, int64_t>& pairCur : vPairs)
+        {
+            const bool bDup = std::any_of
+            (
+                vSorted.begin()
+                , vSorted.end()
+                , [&pairCur](const std::pair<int64_t, int64_t>& pairTest) { return pairTest.first == pairCur.first; }
+            );
+            if (!bDup)
+            {
+                vSorted.push_back(pairCur);
+            }
+        }
+        std::sort
+        (
+            vSorted.begin()
+            , vSorted.end()
+            , [](const std::pair<int64_t, int64_t>& pairL, const std::pair<int64_t, int64_t>& pairR)
+              { return pairL.first < pairR.first; }
+        );
+
+        auto fnRes = [&strResType, bResEnum](const int64_t iRes)
+        {
+            if (bResEnum)
+            {
+                return "static_cast<" + strResType + ">(" + std::to_string(iRes) + ")";
+            }
+            return std::to_string(iRes);
+        };
+
+        // The lowest non-negative value that isn't a result marks unused dense slots
+        int64_t iUnused = 0;
+        while (std::any_of
+        (
+            vSorted.begin()
+            , vSorted.end()
+            , [iUnused](const std::pair<int64_t, int64_t>& pairTest) { return pairTest.second == iUnused; }))
+        {
+            iUnused++;
+        }
+
+        const uint64_t uSpan = static_cast<uint64_t>(vSorted.back().first)
+                               - static_cast<uint64_t>(vSorted.front().first) + 1;
+        const bool bDense = (uSpan <= (vSorted.size() * 8) + 64) && (uSpan <= 65536);
+
+        strmTar << "const " << strResType << " at" << strName << "Res[" << (bDense ? uSpan : vSorted.size())
+                << "] =\n{\n";
+        if (bDense)
+        {
+            size_t szPair = 0;
+            for (uint64_t uAt = 0; uAt < uSpan; uAt++)
+            {
+                strmTar << (uAt ? "  , " : "    ");
+                if (vSorted[szPair].first == vSorted.front().first + static_cast<int64_t>(uAt))
+                {
+                    strmTar << fnRes(vSorted[szPair].second) << "\n";
+                    szPair++;
+                }
+                else
+                {
+                    strmTar << fnRes(iUnused) << " // Unused\n";
+                }
+            }
+        }
+        else
+        {
+            for (size_t szIndex = 0; szIndex < vSorted.size(); szIndex++)
+            {
+                strmTar << (szIndex ? "  , " : "    ") << fnRes(vSorted[szIndex].second) << "\n";
+            }
+            strmTar << "};\nconst " << strKeyType << " at" << strName << "Keys[" << vSorted.size() << "] =\n{\n";
+            for (size_t szIndex = 0; szIndex < vSorted.size(); szIndex++)
+            {
+                strmTar << (szIndex ? "  , " : "    ") << vSorted[szIndex].first << "\n";
+            }
+        }
+        strmTar << "};\nconst CQSL::CQEnum::XlatTable<" << strKeyType << ", " << strResType << "> xtbl"
+                << strName << " =\n{\n    ";
+        if (bDense)
+        {
+            strmTar << vSorted.front().first << ", " << uSpan << ", at" << strName << "Res, "
+                    << fnRes(iUnused) << ", 0, nullptr, nullptr";
+        }
+        else
+        {
+            strmTar << "0, 0, nullptr, " << fnRes(0) << ", " << vSorted.size() << ", at" << strName
+                    << "Keys, at" << strName << "Res";
+        }
+        strmTar << "\n};\n\n";
+    }
 }
 
 
@@ -114,20 +3637,25 @@ bool CQEnumCppOutput::bMustGenerate(const   std::string&    strTarDir
                                     , const std::string&    strBaseName
                                     , const file_time_type& tmSource)
 {
-    // Generate the paths to our output files (hpp, cpp)
-    path pathHdr, pathImpl;
-    CreatePaths(strTarDir, strBaseName, pathHdr, pathImpl);
-
-    // If either doesn't exist or is older than the source
-    const file_time_type tmHdr = std::filesystem::last_write_time(pathHdr);
-    const file_time_type tmImpl = std::filesystem::last_write_time(pathImpl);
+    // Generate the paths to our output files (hpp, cpp, support hpp)
+    path pathHdr, pathImpl, pathSupport;
+    CreatePaths(strTarDir, strBaseName, pathHdr, pathImpl, pathSupport);
 
+    //
+    //  If either doesn't exist or is older than the source. The caller passes the
+    //  newest time of the source and any files it depends on. Check existence first
+    //  since getting the time of a missing file throws.
+    //
+    //  The support header is only rewritten if it changes, so it can be older than
+    //  the source. It just has to exist.
+    //
     const bool bRet
     (
         !std::filesystem::exists(pathHdr)
-        || (tmHdr < tmSource)
+        || (std::filesystem::last_write_time(pathHdr) < tmSource)
         || !std::filesystem::exists(pathImpl)
-        || (tmImpl < tmSource)
+        || (std::filesystem::last_write_time(pathImpl) < tmSource)
+        || !std::filesystem::exists(pathSupport)
     );
 
     if (bRet)
@@ -149,8 +3677,8 @@ CQEnumCppOutput::GenerateOutput( const   CQEnumInfo&    cqeiSrc
                                 , const std::string&    strBaseName)
 {
     // Create our target file paths and then open streams for them
-    path pathHdr, pathImpl;
-    CreatePaths(strTarDir, strBaseName, pathHdr, pathImpl);
+    path pathHdr, pathImpl, pathSupport;
+    CreatePaths(strTarDir, strBaseName, pathHdr, pathImpl, pathSupport);
 
     m_strmHdr.open(pathHdr, std::ofstream::out);
     if (m_strmHdr.flags() & std::ofstream::badbit)
@@ -163,10 +3691,32 @@ CQEnumCppOutput::GenerateOutput( const   CQEnumInfo&    cqeiSrc
         throw std::runtime_error("Could not open the target cpp file");
     }
 
-    // Spit out the opening bits of the two files
+    // Update the shared support header if needed
+    GenSupport(pathSupport);
+
+    //
+    //  Spit out the opening bits of the two files. The header includes the support
+    //  header and makes sure it got the version it was generated against.
+    //
     m_strmHdr   << "// This file was auto-generated by CQEnum.exe, do not edit\n"
-                << "#include <string_view>\n\n";
+                << "#include <string_view>\n"
+                << "#include \"" << pszSupportName << "\"\n\n"
+                << "static_assert(CQENUM_SUPPORT_VERSION == " << c_uSupportVersion
+                << ", \"" << pathHdr.filename().string() << " was generated for a different version of "
+                << pszSupportName << "\");\n\n";
+
+    // Any user headers, e.g. for payload types
+    if (!cqeiSrc.m_vIncludes.empty())
+    {
+        for (const std::string& strInc : cqeiSrc.m_vIncludes)
+        {
+            m_strmHdr << "#include " << strInc << "\n";
+        }
+        m_strmHdr << "\n";
+    }
+
     m_strmImpl  << "// This file was auto-generated by CQEnum.exe, do not edit\n"
+                << "#include <charconv>\n"
                 << "#include <cstdint>\n"
                 << "#include <stdexcept>\n"
                 << "#include <ostream>\n"
@@ -179,7 +3729,7 @@ CQEnumCppOutput::GenerateOutput( const   CQEnumInfo&    cqeiSrc
     }
 
     // Spit out some types we use in the generated content, inside an anon NS
-    m_strmImpl  << " namespace {\n\n" << pszEnumTableTypes << "\n\n";
+    m_strmImpl  << " namespace {\n\n" << pszEnumTableTypes << pszFromCharsHelpers << "\n\n";
     m_strmHdr << "\n\n";
 
     // Generate the constants content
@@ -188,6 +3738,9 @@ CQEnumCppOutput::GenerateOutput( const   CQEnumInfo&    cqeiSrc
     // Generate the enumeration content
     GenEnums(cqeiSrc);
 
+    // And any maps between them, which need all of the enums to be declared
+    GenMaps(cqeiSrc);
+
     // Close out the namespace in the header
     m_strmHdr << "\n}};\n\n\n";
 
@@ -201,6 +3754,9 @@ CQEnumCppOutput::GenerateOutput( const   CQEnumInfo&    cqeiSrc
     // And close off the main namespaces in the impl file
     m_strmImpl << "\n}};\n\n\n";
 
+    // And the static reflection registry entry, which is outside of them
+    GenRegistry(cqeiSrc, strBaseName);
+
     // Flush both streams and close them and we are done
     m_strmHdr.flush();
     m_strmImpl.flush();
@@ -213,7 +3769,8 @@ CQEnumCppOutput::GenerateOutput( const   CQEnumInfo&    cqeiSrc
 void CQEnumCppOutput::CreatePaths(  const   std::string&    strTarDir
                                     , const std::string&    strBaseName
                                     ,       path&           pathHdr
-                                    ,       path&           pathImpl)
+                                    ,       path&           pathImpl
+                                    ,       path&           pathSupport)
 {
     // Create our header and implementation file paths
     std::filesystem::path pathBaseName = strBaseName;
@@ -222,6 +3779,14 @@ void CQEnumCppOutput::CreatePaths(  const   std::string&    strTarDir
     pathImpl = pathHdr;
     pathHdr += ".hpp";
     pathImpl += ".cpp";
+
+    // And the support header, which is shared, so it can't be one of ours
+    pathSupport = strTarDir;
+    pathSupport /= pszSupportName;
+    if (pathHdr.filename() == pathSupport.filename())
+    {
+        throw std::runtime_error("The definition file can't have the same name as the support header");
+    }
 }
 
 
@@ -256,11 +3821,33 @@ void CQEnumCppOutput::GenConstants(const CQEnumInfo& cqeiSrc)
                 m_strmHdr << cqeiSrc.m_strExportMacro << "extern const ";
                 break;
 
+            case EConstTypes::Table :
+                m_strmHdr << "constexpr ";
+                break;
+
             default :
                 throw std::runtime_error("Unknown constant type in C++ output generator");
                 break;
         };
 
+        //
+        //  Tables are a constexpr std::array of the values loaded from the data file,
+        //  a set of them per line.
+        //
+        if (constiCur.m_eType == EConstTypes::Table)
+        {
+            m_strmHdr   << "std::array<" << constiCur.m_strType << ", "
+                        << constiCur.m_vTableVals.size() << "> " << constiCur.m_strName
+                        << " =\n    {{";
+            for (size_t szIndex = 0; szIndex < constiCur.m_vTableVals.size(); szIndex++)
+            {
+                m_strmHdr   << ((szIndex % 8) ? ", " : (szIndex ? "\n        , " : "\n          "))
+                            << constiCur.m_vTableVals[szIndex];
+            }
+            m_strmHdr << "\n    }};\n";
+            continue;
+        }
+
         m_strmHdr << constiCur.m_strType << " " << constiCur.m_strName;
 
         if ((constiCur.m_eType == EConstTypes::Const)
@@ -322,6 +3909,7 @@ void CQEnumCppOutput::GenEnums(const CQEnumInfo& cqeiSrc)
 
         // Do any magic values
         if ((enumiCur.m_eType == EEnumTypes::Arbitary)
+        ||  (enumiCur.m_eType == EEnumTypes::FlagSet)
         ||  (enumiCur.m_eType == EEnumTypes::Standard))
         {
             m_strmHdr   << "        , Min = "
@@ -387,6 +3975,14 @@ void CQEnumCppOutput::GenEnums(const CQEnumInfo& cqeiSrc)
                         << "bool bEnumFromAltValue(const int32_t iAltVal, "
                         << cqeiSrc.m_strNSPrefix << enumiCur.m_strName
                         << "& eToFill);\n";
+            m_strmHdr   << "    " << cqeiSrc.m_strExportMacro
+                        << "size_t EnumsToAltValues(const " << cqeiSrc.m_strNSPrefix
+                        << enumiCur.m_strName << "* const paeSrc, const size_t szCount, "
+                        << "int32_t* const paiTar, uint64_t* const pauInvalid = nullptr);\n";
+            m_strmHdr   << "    " << cqeiSrc.m_strExportMacro
+                        << "size_t AltValuesToEnums(const int32_t* const paiSrc, const size_t szCount, "
+                        << cqeiSrc.m_strNSPrefix << enumiCur.m_strName
+                        << "* const paeTar, uint64_t* const pauInvalid = nullptr);\n";
         }
 
         // We always do the name/value translations both directions
@@ -398,6 +3994,24 @@ void CQEnumCppOutput::GenEnums(const CQEnumInfo& cqeiSrc)
                     << "bool bNameToEnum(const std::wstring_view& svText, "
                     << cqeiSrc.m_strNSPrefix << enumiCur.m_strName << "& eToFill);\n";
 
+        // If runtime aliases are enabled, the access to the registry
+        if (enumiCur.m_bAliases)
+        {
+            m_strmHdr   << "    " << cqeiSrc.m_strExportMacro
+                        << "CQSL::CQEnum::AliasRegistry<" << cqeiSrc.m_strNSPrefix << enumiCur.m_strName
+                        << ">& " << enumiCur.m_strName << "Aliases();\n";
+        }
+
+        //
+        //  And the from_chars style parser, which works on a raw UTF-8 range and can
+        //  accept a name or numeric value.
+        //
+        m_strmHdr   << "    " << cqeiSrc.m_strExportMacro
+                    << "std::from_chars_result EnumFromChars(const char* const pszFirst, "
+                    << "const char* const pszLast, "
+                    << cqeiSrc.m_strNSPrefix << enumiCur.m_strName << "& eToFill, "
+                    << "const CQSL::CQEnum::EFromChars eRules = CQSL::CQEnum::EFromChars::All);\n";
+
         //
         //  Do the validity check. If monotonic, we can do a fast inline version. Else
         //  we need the out of line version that does the lookup.
@@ -407,9 +4021,12 @@ void CQEnumCppOutput::GenEnums(const CQEnumInfo& cqeiSrc)
             m_strmHdr   << "    inline bool bIsValidEnumVal(const "
                         << cqeiSrc.m_strNSPrefix << enumiCur.m_strName << " eTest)\n"
                         << "    {\n"
-                        << "        return ((eTest >= " << cqeiSrc.m_strNSPrefix << enumiCur.m_strName
+                        << "        const bool bRet = ((eTest >= " << cqeiSrc.m_strNSPrefix << enumiCur.m_strName
                         << "::Min) && (eTest <= " << cqeiSrc.m_strNSPrefix << enumiCur.m_strName
                         << "::Max));\n"
+                        << "        CQENUM_LOOKUP(" << cqeiSrc.m_strNSPrefix << enumiCur.m_strName
+                        << ", IsValid, bRet, 0);\n"
+                        << "        return bRet;\n"
                         << "    }\n";
         }
         else
@@ -419,6 +4036,279 @@ void CQEnumCppOutput::GenEnums(const CQEnumInfo& cqeiSrc)
                         << enumiCur.m_strName << " eTest);\n";
         }
 
+        //
+        //  The dense index of a value, 0 to count-1 in defined order, which is used to
+        //  index per-value tables. If monotonic it's just an offset from the min value.
+        //  Else we generate a switch and let the compiler work out the best lookup. An
+        //  invalid value returns the count either way, so callers can range check the
+        //  index, or use it to index an extra slot for invalid values. For monotonic ones
+        //  we check the full 64 bit offset, so large values can't wrap into range.
+        //
+        m_strmHdr   << "    constexpr uint32_t uEnumToIndex(const " << cqeiSrc.m_strNSPrefix
+                    << enumiCur.m_strName << " eVal)\n    {\n";
+        if (enumiCur.m_bIsMonotonic && !enumiCur.m_vValues.front().m_iOrdinal)
+        {
+            m_strmHdr   << "        return (static_cast<uint64_t>(eVal) < " << enumiCur.m_vValues.size()
+                        << ") ? static_cast<uint32_t>(eVal) : " << enumiCur.m_vValues.size() << ";\n";
+        }
+        else if (enumiCur.m_bIsMonotonic)
+        {
+            m_strmHdr   << "        const uint64_t uIndex = static_cast<uint64_t>(static_cast<int64_t>(eVal) - "
+                        << enumiCur.m_vValues.front().m_iOrdinal << ");\n"
+                        << "        return (uIndex < " << enumiCur.m_vValues.size()
+                        << ") ? static_cast<uint32_t>(uIndex) : " << enumiCur.m_vValues.size() << ";\n";
+        }
+        else
+        {
+            m_strmHdr << "        switch(eVal)\n        {\n";
+            uint32_t uIndex = 0;
+            for (const EnumValInfo& evalCur : enumiCur.m_vValues)
+            {
+                m_strmHdr   << "            case " << cqeiSrc.m_strNSPrefix << enumiCur.m_strName
+                            << "::" << evalCur.m_strName << " : return " << uIndex++ << ";\n";
+            }
+            m_strmHdr   << "            default : break;\n        };\n"
+                        << "        return " << enumiCur.m_vValues.size() << ";\n";
+        }
+        m_strmHdr << "    }\n";
+
+        //
+        //  If there are any custom attribute columns, generate a struct with a constexpr
+        //  array for each one, indexed by dense index, and an inline accessor for each.
+        //  Like the maps, each array has one more value initialized entry (0, nullptr,
+        //  etc...) at the end, which is what invalid values get, since they have the
+        //  count as their index.
+        //
+        if (!enumiCur.m_vAttrs.empty())
+        {
+            m_strmHdr << "    struct " << enumiCur.m_strName << "Attrs\n    {\n";
+            for (size_t szAttr = 0; szAttr < enumiCur.m_vAttrs.size(); szAttr++)
+            {
+                const EnumInfo::AttrPair& pairAttr = enumiCur.m_vAttrs[szAttr];
+                m_strmHdr   << "        static constexpr " << pairAttr.second << " a"
+                            << pairAttr.first << "[" << enumiCur.m_vValues.size() + 1 << "] =\n        {\n";
+
+                bool bFirstAttr = true;
+                for (const EnumValInfo& evalCur : enumiCur.m_vValues)
+                {
+                    m_strmHdr   << (bFirstAttr ? "              " : "            , ")
+                                << evalCur.m_vAttrVals[szAttr] << "\n";
+                    bFirstAttr = false;
+                }
+                m_strmHdr << "            , {} // Invalid values\n        };\n";
+            }
+            m_strmHdr << "    };\n";
+
+            for (const EnumInfo::AttrPair& pairAttr : enumiCur.m_vAttrs)
+            {
+                m_strmHdr   << "    constexpr " << pairAttr.second << " EnumTo" << pairAttr.first
+                            << "(const " << cqeiSrc.m_strNSPrefix << enumiCur.m_strName << " eVal)\n"
+                            << "    {\n        return " << enumiCur.m_strName << "Attrs::a"
+                            << pairAttr.first << "[uEnumToIndex(eVal)];\n    }\n";
+            }
+        }
+
+        //
+        //  If there were transitions defined, generate the bit matrix, a row per value
+        //  with a bit on for each allowed target. Then an inline check and a method to
+        //  iterate the successors of a value.
+        //
+        if (enumiCur.m_bTransitions)
+        {
+            const std::string strEnum = cqeiSrc.m_strNSPrefix + enumiCur.m_strName;
+            const size_t szCount = enumiCur.m_vValues.size();
+            const size_t szWords = (szCount + 63) / 64;
+
+            std::vector<uint64_t> vMatrix(szCount * szWords, 0);
+            for (const EnumInfo::TransPair& pairCur : enumiCur.m_vTransitions)
+            {
+                vMatrix[(pairCur.first * szWords) + (pairCur.second / 64)] |= 1ULL << (pairCur.second % 64);
+            }
+
+            m_strmHdr   << "    struct " << enumiCur.m_strName << "Transitions\n    {\n"
+                        << "        static constexpr uint32_t c_uWords = " << szWords << ";\n"
+                        << "        static constexpr uint64_t s_auMatrix[" << szCount
+                        << "][" << szWords << "] =\n        {\n";
+            for (size_t szRow = 0; szRow < szCount; szRow++)
+            {
+                m_strmHdr << (szRow ? "            , {" : "              {");
+                for (size_t szWord = 0; szWord < szWords; szWord++)
+                {
+                    m_strmHdr   << (szWord ? ", " : " ") << "0x" << std::hex
+                                << vMatrix[(szRow * szWords) + szWord] << std::dec << "ULL";
+                }
+                m_strmHdr   << " } // " << enumiCur.m_vValues[szRow].m_strName << "\n";
+            }
+            m_strmHdr << "        };\n    };\n";
+
+            m_strmHdr   << "    constexpr bool bCanTransition(const " << strEnum << " eFrom, const "
+                        << strEnum << " eTo)\n    {\n"
+                        << "        const uint32_t uFrom = uEnumToIndex(eFrom);\n"
+                        << "        const uint32_t uTo = uEnumToIndex(eTo);\n"
+                        << "        if ((uFrom >= " << szCount << ") || (uTo >= " << szCount << "))\n"
+                        << "        {\n            return false;\n        }\n"
+                        << "        return ((" << enumiCur.m_strName
+                        << "Transitions::s_auMatrix[uFrom][uTo / 64] >> (uTo % 64)) & 1) != 0;\n"
+                        << "    }\n";
+
+            m_strmHdr   << "    inline CQSL::CQEnum::SuccessorRange<" << strEnum << ", " << szWords
+                        << "> EnumSuccessors(const " << strEnum << " eFrom)\n    {\n"
+                        << "        const uint32_t uFrom = uEnumToIndex(eFrom);\n"
+                        << "        return CQSL::CQEnum::SuccessorRange<" << strEnum << ", " << szWords << ">\n"
+                        << "        (\n            (uFrom < " << szCount << ") ? "
+                        << enumiCur.m_strName << "Transitions::s_auMatrix[uFrom] : nullptr\n        );\n"
+                        << "    }\n";
+        }
+
+        //
+        //  If there were any groups defined, generate a bitset per group, over the
+        //  dense indices, in a struct, along with a static method to iterate the
+        //  members. Then an inline membership check per group, which is a bit test.
+        //
+        if (!enumiCur.m_vGroups.empty())
+        {
+            const std::string strEnum = cqeiSrc.m_strNSPrefix + enumiCur.m_strName;
+            const size_t szCount = enumiCur.m_vValues.size();
+            const size_t szWords = (szCount + 63) / 64;
+
+            m_strmHdr   << "    struct " << enumiCur.m_strName << "Groups\n    {\n"
+                        << "        static constexpr uint32_t c_uWords = " << szWords << ";\n";
+            std::vector<uint64_t> vBits(szWords);
+            for (const EnumInfo::GroupPair& pairCur : enumiCur.m_vGroups)
+            {
+                std::fill(vBits.begin(), vBits.end(), 0);
+                for (const uint32_t uIndex : pairCur.second)
+                {
+                    vBits[uIndex / 64] |= 1ULL << (uIndex % 64);
+                }
+
+                m_strmHdr << "        static constexpr uint64_t s_au" << pairCur.first << "[" << szWords << "] = {";
+                for (size_t szWord = 0; szWord < szWords; szWord++)
+                {
+                    m_strmHdr << (szWord ? ", " : " ") << "0x" << std::hex << vBits[szWord] << std::dec << "ULL";
+                }
+                m_strmHdr   << " };\n"
+                            << "        static CQSL::CQEnum::SuccessorRange<" << strEnum << ", " << szWords
+                            << "> " << pairCur.first << "() noexcept\n        {\n"
+                            << "            return CQSL::CQEnum::SuccessorRange<" << strEnum << ", "
+                            << szWords << ">(s_au" << pairCur.first << ");\n        }\n";
+            }
+            m_strmHdr << "    };\n";
+
+            for (const EnumInfo::GroupPair& pairCur : enumiCur.m_vGroups)
+            {
+                m_strmHdr   << "    constexpr bool bIsIn" << pairCur.first << "(const " << strEnum
+                            << " eTest)\n    {\n"
+                            << "        const uint32_t uIndex = uEnumToIndex(eTest);\n"
+                            << "        return (uIndex < " << szCount << ") && (((" << enumiCur.m_strName
+                            << "Groups::s_au" << pairCur.first << "[uIndex / 64] >> (uIndex % 64)) & 1) != 0);\n"
+                            << "    }\n";
+            }
+        }
+
+        //
+        //  If any values have payload types, generate an alias for a tagged union
+        //  with a payload type per value. Values without one get an empty type.
+        //
+        if (enumiCur.bHasPayloads())
+        {
+            m_strmHdr   << "    using " << enumiCur.m_strName << "Union = CQSL::CQEnum::TaggedUnion\n    <\n"
+                        << "        " << cqeiSrc.m_strNSPrefix << enumiCur.m_strName << "\n";
+            for (const EnumValInfo& evalCur : enumiCur.m_vValues)
+            {
+                m_strmHdr   << "        , "
+                            << (evalCur.m_strPayload.empty() ? "CQSL::CQEnum::NoPayload" : evalCur.m_strPayload)
+                            << " // " << evalCur.m_strName << "\n";
+            }
+            m_strmHdr << "    >;\n";
+        }
+
+        //
+        //  The schema info. There's always a fingerprint, and if the values have
+        //  stable ids, the ids by index, and the values sorted by id so that we can
+        //  look them up.
+        //
+        {
+            const std::string strEnum = cqeiSrc.m_strNSPrefix + enumiCur.m_strName;
+            const size_t szCount = enumiCur.m_vValues.size();
+
+            m_strmHdr   << "    struct " << enumiCur.m_strName << "Schema\n    {\n"
+                        << "        static constexpr uint64_t c_uFingerprint = 0x" << std::hex
+                        << uSchemaFingerprint(enumiCur) << std::dec << "ULL;\n";
+
+            if (enumiCur.bHasStableIds())
+            {
+                std::vector<const EnumValInfo*> vSorted;
+                m_strmHdr << "        static constexpr uint32_t s_auStableIds[" << szCount << "] =\n        {\n";
+                for (size_t szIndex = 0; szIndex < szCount; szIndex++)
+                {
+                    const EnumValInfo& evalCur = enumiCur.m_vValues[szIndex];
+                    m_strmHdr   << (szIndex ? "            , " : "              ") << evalCur.m_uStableId
+                                << " // " << evalCur.m_strName << "\n";
+                    vSorted.push_back(&evalCur);
+                }
+                m_strmHdr << "        };\n";
+
+                std::sort
+                (
+                    vSorted.begin()
+                    , vSorted.end()
+                    , [](const EnumValInfo* pevali1, const EnumValInfo* pevali2)
+                      { return pevali1->m_uStableId < pevali2->m_uStableId; }
+                );
+                m_strmHdr << "        static constexpr uint32_t s_auSortedIds[" << szCount << "] =\n        {\n";
+                for (size_t szIndex = 0; szIndex < szCount; szIndex++)
+                {
+                    m_strmHdr << (szIndex ? "            , " : "              ") << vSorted[szIndex]->m_uStableId << "\n";
+                }
+                m_strmHdr   << "        };\n"
+                            << "        static constexpr " << strEnum << " s_aeSorted[" << szCount << "] =\n        {\n";
+                for (size_t szIndex = 0; szIndex < szCount; szIndex++)
+                {
+                    m_strmHdr   << (szIndex ? "            , " : "              ") << strEnum << "::"
+                                << vSorted[szIndex]->m_strName << "\n";
+                }
+                m_strmHdr << "        };\n";
+            }
+            m_strmHdr << "    };\n";
+
+            if (enumiCur.bHasStableIds())
+            {
+                m_strmHdr   << "    constexpr uint32_t uEnumToStableId(const " << strEnum << " eVal)\n    {\n"
+                            << "        const uint32_t uIndex = uEnumToIndex(eVal);\n"
+                            << "        return (uIndex < " << szCount << ") ? " << enumiCur.m_strName
+                            << "Schema::s_auStableIds[uIndex] : 0xFFFFFFFF;\n"
+                            << "    }\n"
+                            << "    inline bool bStableIdToEnum(const uint32_t uId, " << strEnum << "& eToFill)\n    {\n"
+                            << "        const uint32_t* const puEnd = " << enumiCur.m_strName
+                            << "Schema::s_auSortedIds + " << szCount << ";\n"
+                            << "        const uint32_t* const puFound = std::lower_bound(" << enumiCur.m_strName
+                            << "Schema::s_auSortedIds, puEnd, uId);\n"
+                            << "        if ((puFound == puEnd) || (*puFound != uId))\n"
+                            << "        {\n            return false;\n        }\n"
+                            << "        eToFill = " << enumiCur.m_strName << "Schema::s_aeSorted[puFound - "
+                            << enumiCur.m_strName << "Schema::s_auSortedIds];\n"
+                            << "        return true;\n"
+                            << "    }\n";
+            }
+
+            //
+            //  If there's a previous version of this enum, generate a remap table to
+            //  get the new ordinals for the old ones. Values are matched by stable id
+            //  if both versions have them, else by name.
+            //
+            std::vector<EnumInfo>::const_iterator itPrev = std::find_if
+            (
+                cqeiSrc.m_vPrevEnums.begin()
+                , cqeiSrc.m_vPrevEnums.end()
+                , [&enumiCur](const EnumInfo& enumiPrev) { return enumiPrev.m_strName == enumiCur.m_strName; }
+            );
+            if (itPrev != cqeiSrc.m_vPrevEnums.end())
+            {
+                GenRemap(enumiCur, *itPrev, cqeiSrc);
+            }
+        }
+
         // If bitmaped, do the bit checks
         if (enumiCur.m_eType == EEnumTypes::Bitmap)
         {
@@ -435,6 +4325,101 @@ void CQEnumCppOutput::GenEnums(const CQEnumInfo& cqeiSrc)
                         << " eBits)\n    {\n        return (static_cast<"
                         << enumiCur.m_strUnderType << ">(eTest) & "
                         << "static_cast<" << enumiCur.m_strUnderType << ">(eBits)) != 0;\n    }\n";
+
+            //
+            //  Validity checks for flag words, which can have any combination of the
+            //  bits, unlike bIsValidEnumVal() which checks for one of the values. The
+            //  list versions OR all of the values together and check that once.
+            //
+            const std::string strEnum = cqeiSrc.m_strNSPrefix + enumiCur.m_strName;
+            m_strmHdr   << "    constexpr bool bIsValidBits(const " << strEnum << " eTest)\n    {\n"
+                        << "        return (static_cast<" << enumiCur.m_strUnderType << ">(eTest) & "
+                        << "~static_cast<" << enumiCur.m_strUnderType << ">(" << strEnum
+                        << "::AllBits)) == 0;\n    }\n";
+
+            m_strmHdr   << "    constexpr bool bIsSingleBit(const " << strEnum << " eTest)\n    {\n"
+                        << "        return (static_cast<" << enumiCur.m_strUnderType << ">(eTest) != 0)\n"
+                        << "            && ((static_cast<" << enumiCur.m_strUnderType << ">(eTest) & "
+                        << "(static_cast<" << enumiCur.m_strUnderType << ">(eTest) - 1)) == 0)\n"
+                        << "            && bIsValidBits(eTest);\n    }\n";
+
+            m_strmHdr   << "    inline bool bIsValidBits(const " << strEnum
+                        << "* const peList, const size_t szCount)\n    {\n"
+                        << "        return (CQSL::CQEnum::uOrAllBits(peList, szCount) & "
+                        << "~static_cast<" << enumiCur.m_strUnderType << ">(" << strEnum
+                        << "::AllBits)) == 0;\n    }\n";
+
+            m_strmHdr   << "    inline bool bIsSingleBit(const " << strEnum
+                        << "* const peList, const size_t szCount)\n    {\n"
+                        << "        return CQSL::CQEnum::bAllSingleBits(peList, szCount) "
+                        << "&& bIsValidBits(peList, szCount);\n    }\n";
+
+            //
+            //  Compact the defined bits into a dense combination index. With BMI2 it's
+            //  a pext, else we generate a shift and mask per run of contiguous bits.
+            //
+            uint32_t uMask = 0;
+            for (const EnumValInfo& evalCur : enumiCur.m_vValues)
+            {
+                uMask |= static_cast<uint32_t>(evalCur.m_iOrdinal);
+            }
+
+            m_strmHdr   << "    inline uint32_t uCombinationIndex(const " << strEnum << " eBits) noexcept\n    {\n"
+                        << "#if defined(CQENUM_BMI2)\n"
+                        << "        return _pext_u32(static_cast<uint32_t>(eBits), 0x" << std::hex << uMask
+                        << std::dec << "U);\n"
+                        << "#else\n"
+                        << "        const uint32_t uBits = static_cast<uint32_t>(eBits);\n"
+                        << "        return ";
+            uint32_t uTarBit = 0;
+            uint32_t uSrcBit = 0;
+            bool bFirstRun = true;
+            while (uSrcBit < 32)
+            {
+                if (!(uMask & (1UL << uSrcBit)))
+                {
+                    uSrcBit++;
+                    continue;
+                }
+
+                uint32_t uRunLen = 0;
+                while ((uSrcBit + uRunLen < 32) && (uMask & (1UL << (uSrcBit + uRunLen))))
+                {
+                    uRunLen++;
+                }
+
+                const uint64_t uRunMask = ((1ULL << uRunLen) - 1) << uTarBit;
+                m_strmHdr << (bFirstRun ? "" : "\n            | ");
+                if (uSrcBit == uTarBit)
+                {
+                    m_strmHdr << "(uBits & 0x" << std::hex << uRunMask << std::dec << "U)";
+                }
+                else
+                {
+                    m_strmHdr   << "((uBits >> " << (uSrcBit - uTarBit) << ") & 0x"
+                                << std::hex << uRunMask << std::dec << "U)";
+                }
+                bFirstRun = false;
+                uTarBit += uRunLen;
+                uSrcBit += uRunLen;
+            }
+            m_strmHdr   << (bFirstRun ? "0;\n" : ";\n")
+                        << "#endif\n    }\n";
+
+            // And an alias for the atomic wrapper, for flags shared between threads
+            m_strmHdr   << "    using " << enumiCur.m_strName << "AtomicFlags = CQSL::CQEnum::AtomicFlags<"
+                        << cqeiSrc.m_strNSPrefix << enumiCur.m_strName << ">;\n";
+        }
+
+        //
+        //  If a flag set, the enum values are bit positions, and we generate an alias
+        //  for the set type, sized to the number of values.
+        //
+        if (enumiCur.m_eType == EEnumTypes::FlagSet)
+        {
+            m_strmHdr   << "    using " << enumiCur.m_strName << "Set = CQSL::CQEnum::FlagSet<"
+                        << cqeiSrc.m_strNSPrefix << enumiCur.m_strName << ", "
+                        << enumiCur.m_vValues.size() << ">;\n";
         }
     }
 
@@ -450,6 +4435,7 @@ void CQEnumCppOutput::GenEnums(const CQEnumInfo& cqeiSrc)
         {
             case EEnumTypes::Arbitary : m_strmImpl << "ETypes::Arbitrary"; break;
             case EEnumTypes::Bitmap : m_strmImpl << "ETypes::Bitmap"; break;
+            case EEnumTypes::FlagSet : m_strmImpl << "ETypes::FlagSet"; break;
             case EEnumTypes::Standard : m_strmImpl << "ETypes::Standard"; break;
 
             default :
@@ -472,6 +4458,7 @@ void CQEnumCppOutput::GenEnums(const CQEnumInfo& cqeiSrc)
             }
 
             m_strmImpl  << "L\"" << evalCur.m_strName << "\", "
+                        << "\"" << evalCur.m_strName << "\", "
                         << evalCur.m_iOrdinal << ", "
                         << evalCur.m_iAltValue << ", ";
 
@@ -482,6 +4469,21 @@ void CQEnumCppOutput::GenEnums(const CQEnumInfo& cqeiSrc)
         }
 
         m_strmImpl << "\n    }\n};\n\n";
+
+        // If it has alt values, the tables for the bulk translations each way
+        if (enumiCur.m_bDoAltVal)
+        {
+            const std::string strEnum = cqeiSrc.m_strNSPrefix + enumiCur.m_strName;
+            std::vector<std::pair<int64_t, int64_t>> vToAlt;
+            std::vector<std::pair<int64_t, int64_t>> vFromAlt;
+            for (const EnumValInfo& evalCur : enumiCur.m_vValues)
+            {
+                vToAlt.emplace_back(evalCur.m_iOrdinal, evalCur.m_iAltValue);
+                vFromAlt.emplace_back(evalCur.m_iAltValue, evalCur.m_iOrdinal);
+            }
+            GenXlatTable(m_strmImpl, "ToAltVal_" + enumiCur.m_strName, enumiCur.m_strUnderType, "int32_t", false, vToAlt);
+            GenXlatTable(m_strmImpl, "FromAltVal_" + enumiCur.m_strName, "int32_t", strEnum, true, vFromAlt);
+        }
     }
 }
 
@@ -581,11 +4583,446 @@ void CQEnumCppOutput::GenGlobals(const CQEnumInfo& cqeiSrc)
                         << "}\n";
         }
 
+        //
+        //  Specializations of the support templates go into the support namespace.
+        //  First is the list of all values, in defined order, for iteration.
+        //
+        m_strmHdr   << "namespace CQSL { namespace CQEnum {\n"
+                    << "template <> struct EnumValueList<" << cqeiSrc.m_strNSPrefix
+                    << enumiCur.m_strName << ">\n{\n"
+                    << "    static constexpr uint32_t c_uCount = " << enumiCur.m_vValues.size() << ";\n"
+                    << "    static constexpr " << cqeiSrc.m_strNSPrefix << enumiCur.m_strName
+                    << " s_aeValues[] =\n    {\n";
+        bool bFirst = true;
+        for (const EnumValInfo& evalCur : enumiCur.m_vValues)
+        {
+            m_strmHdr   << (bFirst ? "          " : "        , ")
+                        << cqeiSrc.m_strNSPrefix << enumiCur.m_strName << "::"
+                        << evalCur.m_strName << "\n";
+            bFirst = false;
+        }
+        m_strmHdr << "    };\n};\n";
+
+        // For bitmaps, the info for dense combination indices
+        if (enumiCur.m_eType == EEnumTypes::Bitmap)
+        {
+            uint32_t uMask = 0;
+            for (const EnumValInfo& evalCur : enumiCur.m_vValues)
+            {
+                uMask |= static_cast<uint32_t>(evalCur.m_iOrdinal);
+            }
+
+            uint32_t uBitCount = 0;
+            for (uint32_t uTest = uMask; uTest; uTest &= uTest - 1)
+            {
+                uBitCount++;
+            }
+
+            m_strmHdr   << "template <> struct BitmapCombos<" << cqeiSrc.m_strNSPrefix
+                        << enumiCur.m_strName << ">\n{\n"
+                        << "    static constexpr uint32_t c_uBits = " << uBitCount << ";\n"
+                        << "    static constexpr uint32_t c_uMask = 0x" << std::hex << uMask << std::dec << "U;\n"
+                        << "};\n";
+        }
+
+        // The compile time traits
+        GenEnumTraits(enumiCur, cqeiSrc);
+
+        // The name trie tables for incremental and prefix matching
+        GenNameTrie(enumiCur, cqeiSrc);
+
+        m_strmHdr << "}}\n";
+
         m_strmHdr << "\n\n";
     }
 }
 
 
+//
+//  Generate the [enum]Remap struct, to get the new values for ones persisted with
+//  the previous version of an enum. Values are matched by stable id if both versions
+//  have them, else by name.
+//
+//  For bitmaps, a persisted value is a word of bits, so each old value's bit is
+//  moved to its new position. Otherwise it's a table indexed by the old ordinal,
+//  with a marker value that isn't a valid ordinal for removed ones, so the old
+//  ordinals have to be small enough for a direct table. If the enum changed from
+//  bitmap to not, or the other way, the values don't mean the same thing, so it
+//  doesn't get one.
+//
+void CQEnumCppOutput::GenRemap(const   EnumInfo&       enumiSrc
+                                , const EnumInfo&       enumiPrev
+                                , const CQEnumInfo&     cqeiSrc)
+{
+    const std::string strEnum = cqeiSrc.m_strNSPrefix + enumiSrc.m_strName;
+    const bool bBitmap = (enumiSrc.m_eType == EEnumTypes::Bitmap);
+    if (bBitmap != (enumiPrev.m_eType == EEnumTypes::Bitmap))
+    {
+        return;
+    }
+
+    if (!bBitmap
+    &&  ((enumiPrev.m_vValues.front().m_iOrdinal < 0) || (enumiPrev.m_vValues.back().m_iOrdinal >= 65536)))
+    {
+        return;
+    }
+
+    // Find the new value for each old one, if it's still there
+    const bool bByStableId = enumiSrc.bHasStableIds() && enumiPrev.bHasStableIds();
+    std::vector<const EnumValInfo*> vNew(enumiPrev.m_vValues.size(), nullptr);
+    for (size_t szOld = 0; szOld < enumiPrev.m_vValues.size(); szOld++)
+    {
+        const EnumValInfo& evalOld = enumiPrev.m_vValues[szOld];
+        for (const EnumValInfo& evalNew : enumiSrc.m_vValues)
+        {
+            if (bByStableId ? (evalNew.m_uStableId == evalOld.m_uStableId)
+                            : (evalNew.m_strName == evalOld.m_strName))
+            {
+                vNew[szOld] = &evalNew;
+                break;
+            }
+        }
+    }
+
+    m_strmHdr   << "    struct " << enumiSrc.m_strName << "Remap\n    {\n"
+                << "        static constexpr uint64_t c_uFromFingerprint = 0x" << std::hex
+                << uSchemaFingerprint(enumiPrev) << std::dec << "ULL;\n";
+
+    if (bBitmap)
+    {
+        //
+        //  The old bits of the values that are still there, and the new bits for
+        //  them. Any other bits in an old word mean it can't be remapped.
+        //
+        const size_t szCount = enumiPrev.m_vValues.size();
+        uint64_t uKnownBits = 0;
+        for (size_t szOld = 0; szOld < szCount; szOld++)
+        {
+            if (vNew[szOld])
+            {
+                uKnownBits |= static_cast<uint64_t>(enumiPrev.m_vValues[szOld].m_iOrdinal);
+            }
+        }
+
+        m_strmHdr   << "        static constexpr uint32_t c_uBitCount = " << szCount << ";\n"
+                    << "        static constexpr " << enumiSrc.m_strUnderType << " c_tKnownBits = 0x"
+                    << std::hex << uKnownBits << std::dec << ";\n"
+                    << "        static constexpr " << enumiSrc.m_strUnderType << " s_atOldBits["
+                    << szCount << "] =\n        {\n";
+        for (size_t szOld = 0; szOld < szCount; szOld++)
+        {
+            m_strmHdr   << (szOld ? "            , 0x" : "              0x") << std::hex
+                        << static_cast<uint64_t>(enumiPrev.m_vValues[szOld].m_iOrdinal) << std::dec
+                        << " // " << enumiPrev.m_vValues[szOld].m_strName << "\n";
+        }
+        m_strmHdr   << "        };\n"
+                    << "        static constexpr " << enumiSrc.m_strUnderType << " s_atNewBits["
+                    << szCount << "] =\n        {\n";
+        for (size_t szOld = 0; szOld < szCount; szOld++)
+        {
+            m_strmHdr << (szOld ? "            , " : "              ");
+            if (vNew[szOld])
+            {
+                m_strmHdr   << "0x" << std::hex << static_cast<uint64_t>(vNew[szOld]->m_iOrdinal) << std::dec
+                            << " // " << vNew[szOld]->m_strName << "\n";
+            }
+            else
+            {
+                m_strmHdr   << "0 // Removed\n";
+            }
+        }
+        m_strmHdr   << "        };\n\n"
+                    << "        static bool bRemap(const " << enumiSrc.m_strUnderType << " tOld, "
+                    << strEnum << "& eToFill) noexcept\n        {\n"
+                    << "            if (tOld & ~c_tKnownBits)\n"
+                    << "            {\n                return false;\n            }\n\n"
+                    << "            " << enumiSrc.m_strUnderType << " tNew = 0;\n"
+                    << "            for (uint32_t uIndex = 0; uIndex < c_uBitCount; uIndex++)\n"
+                    << "            {\n"
+                    << "                if (tOld & s_atOldBits[uIndex])\n"
+                    << "                {\n"
+                    << "                    tNew |= s_atNewBits[uIndex];\n"
+                    << "                }\n"
+                    << "            }\n"
+                    << "            eToFill = static_cast<" << strEnum << ">(tNew);\n"
+                    << "            return true;\n"
+                    << "        }\n\n"
+                    << "        static size_t szRemap(const " << enumiSrc.m_strUnderType
+                    << "* const patSrc, const size_t szCount, " << enumiSrc.m_strUnderType
+                    << "* const patTar, const " << enumiSrc.m_strUnderType << " tBad) noexcept\n"
+                    << "        {\n"
+                    << "            size_t szBad = 0;\n"
+                    << "            for (size_t szIndex = 0; szIndex < szCount; szIndex++)\n"
+                    << "            {\n"
+                    << "                " << strEnum << " eNew;\n"
+                    << "                if (bRemap(patSrc[szIndex], eNew))\n"
+                    << "                {\n"
+                    << "                    patTar[szIndex] = static_cast<" << enumiSrc.m_strUnderType << ">(eNew);\n"
+                    << "                }\n"
+                    << "                else\n"
+                    << "                {\n"
+                    << "                    patTar[szIndex] = tBad;\n"
+                    << "                    szBad++;\n"
+                    << "                }\n"
+                    << "            }\n"
+                    << "            return szBad;\n"
+                    << "        }\n"
+                    << "    };\n";
+        return;
+    }
+
+    int64_t iRemoved = 0;
+    while (std::find_if
+           (
+               enumiSrc.m_vValues.begin()
+               , enumiSrc.m_vValues.end()
+               , [iRemoved](const EnumValInfo& evalCur) { return evalCur.m_iOrdinal == iRemoved; }
+           ) != enumiSrc.m_vValues.end())
+    {
+        iRemoved++;
+    }
+
+    const size_t szTableSize = static_cast<size_t>(enumiPrev.m_vValues.back().m_iOrdinal) + 1;
+    std::vector<size_t> vOldIndex(szTableSize, enumiPrev.m_vValues.size());
+    for (size_t szOld = 0; szOld < enumiPrev.m_vValues.size(); szOld++)
+    {
+        vOldIndex[static_cast<size_t>(enumiPrev.m_vValues[szOld].m_iOrdinal)] = szOld;
+    }
+
+    m_strmHdr   << "        static constexpr uint32_t c_uTableSize = " << szTableSize << ";\n"
+                << "        static constexpr " << enumiSrc.m_strUnderType << " c_tRemoved = "
+                << iRemoved << ";\n"
+                << "        static constexpr " << enumiSrc.m_strUnderType << " s_atTable["
+                << szTableSize << "] =\n        {\n";
+    for (size_t szIndex = 0; szIndex < szTableSize; szIndex++)
+    {
+        m_strmHdr << (szIndex ? "            , " : "              ");
+        const size_t szOld = vOldIndex[szIndex];
+        if ((szOld < vNew.size()) && vNew[szOld])
+        {
+            m_strmHdr   << vNew[szOld]->m_iOrdinal << " // " << enumiPrev.m_vValues[szOld].m_strName
+                        << " -> " << vNew[szOld]->m_strName << "\n";
+        }
+        else
+        {
+            m_strmHdr   << "c_tRemoved // "
+                        << ((szOld < vNew.size()) ? enumiPrev.m_vValues[szOld].m_strName.c_str() : "Unused") << "\n";
+        }
+    }
+    m_strmHdr   << "        };\n\n"
+                << "        static bool bRemap(const " << enumiSrc.m_strUnderType << " tOld, "
+                << strEnum << "& eToFill) noexcept\n        {\n"
+                << "            if ((static_cast<uint64_t>(tOld) >= c_uTableSize) "
+                << "|| (s_atTable[tOld] == c_tRemoved))\n"
+                << "            {\n                return false;\n            }\n"
+                << "            eToFill = static_cast<" << strEnum << ">(s_atTable[tOld]);\n"
+                << "            return true;\n"
+                << "        }\n\n"
+                << "        static size_t szRemap(const " << enumiSrc.m_strUnderType
+                << "* const patSrc, const size_t szCount, " << enumiSrc.m_strUnderType
+                << "* const patTar, const " << enumiSrc.m_strUnderType << " tBad) noexcept\n"
+                << "        {\n"
+                << "            return CQSL::CQEnum::szRemapValues(patSrc, szCount, patTar, s_atTable, "
+                << "c_uTableSize, c_tRemoved, tBad);\n"
+                << "        }\n"
+                << "    };\n";
+}
+
+
+//
+//  Generate this file's entry in the static reflection registry. That's a constant
+//  list of descriptors for our enums, sorted by type name, and a pointer to it in
+//  the registry linker section. The pointer has to have a unique, unmangled name
+//  so that we can force the MSVC linker to keep it, so we build it from the
+//  namespaces and the base file name.
+//
+void CQEnumCppOutput::GenRegistry(const CQEnumInfo& cqeiSrc, const std::string& strBaseName)
+{
+    std::vector<const EnumInfo*> vSorted;
+    for (const EnumInfo& enumiCur : cqeiSrc.m_listEnums.m_vEnumList)
+    {
+        vSorted.push_back(&enumiCur);
+    }
+    if (vSorted.empty())
+    {
+        return;
+    }
+
+    // They all have the same namespace prefix, so we can just sort on the names
+    std::sort
+    (
+        vSorted.begin()
+        , vSorted.end()
+        , [](const EnumInfo* penumi1, const EnumInfo* penumi2) { return penumi1->m_strName < penumi2->m_strName; }
+    );
+
+    std::string strEntry("CQEnumReg_");
+    for (const std::string& strNS : cqeiSrc.m_vNamespaces)
+    {
+        strEntry.append(strNS);
+        strEntry.push_back('_');
+    }
+    for (const char chCur : strBaseName)
+    {
+        strEntry.push_back(std::isalnum(static_cast<unsigned char>(chCur)) ? chCur : '_');
+    }
+
+    m_strmImpl  << "// The static reflection registry entry for this file\n"
+                << "namespace {\n"
+                << "constexpr CQSL::CQEnum::EnumDescriptor aedescRegistry[] =\n{\n";
+    bool bFirst = true;
+    for (const EnumInfo* penumiCur : vSorted)
+    {
+        const std::string strEnum = cqeiSrc.m_strNSPrefix + penumiCur->m_strName;
+        m_strmImpl  << (bFirst ? "      { " : "    , { ") << "\"" << strEnum << "\"\n"
+                    << "        , CQSL::CQEnum::EnumTraits<" << strEnum << ">::eKind\n"
+                    << "        , " << penumiCur->m_vValues.size() << "\n"
+                    << "        , CQSL::CQEnum::EnumTraits<" << strEnum << ">::c_uFingerprint\n"
+                    << "        , &CQSL::CQEnum::iDescValueAt<" << strEnum << ">\n"
+                    << "        , &CQSL::CQEnum::pszDescToName<" << strEnum << ">\n"
+                    << "        , &CQSL::CQEnum::bDescFromName<" << strEnum << ">\n"
+                    << "        , &CQSL::CQEnum::bDescIsValid<" << strEnum << ">\n";
+        if (penumiCur->m_bText1)
+        {
+            m_strmImpl << "        , &CQSL::CQEnum::pszDescToText1<" << strEnum << ">\n";
+        }
+        else
+        {
+            m_strmImpl << "        , nullptr\n";
+        }
+        if (penumiCur->m_bText2)
+        {
+            m_strmImpl << "        , &CQSL::CQEnum::pszDescToText2<" << strEnum << ">\n";
+        }
+        else
+        {
+            m_strmImpl << "        , nullptr\n";
+        }
+        m_strmImpl << "      }\n";
+        bFirst = false;
+    }
+    m_strmImpl  << "};\n"
+                << "constexpr CQSL::CQEnum::EnumDescriptorList edlRegistry = { aedescRegistry, "
+                << vSorted.size() << " };\n"
+                << "}\n"
+                << "#if defined(CQENUM_REGISTRY_SECTION)\n"
+                << "extern \"C\" CQENUM_REGISTRY_SECTION const CQSL::CQEnum::EnumDescriptorList* const "
+                << strEntry << " = &edlRegistry;\n"
+                << "#if defined(_MSC_VER) && defined(_M_IX86)\n"
+                << "#pragma comment(linker, \"/include:_" << strEntry << "\")\n"
+                << "#elif defined(_MSC_VER)\n"
+                << "#pragma comment(linker, \"/include:" << strEntry << "\")\n"
+                << "#endif\n"
+                << "#endif\n";
+}
+
+
+//
+//  Generate the support header that all of the generated headers include. If there's
+//  already one there with the same content, we leave it alone, so that regenerating
+//  one definition file doesn't force a rebuild of everything that includes it.
+//
+//  It's guarded by its version, and if some other version was included first it's an
+//  error, since the support code would be whatever one came first.
+//
+void CQEnumCppOutput::GenSupport(const path& pathSupport)
+{
+    std::ostringstream strmNew;
+    strmNew << "// This file was auto-generated by CQEnum.exe, do not edit\n"
+            << "#if defined(CQENUM_SUPPORT_VERSION) && (CQENUM_SUPPORT_VERSION != "
+            << c_uSupportVersion << ")\n"
+            << "#error \"" << pszSupportName << " from different versions of CQEnum were included\"\n"
+            << "#endif\n"
+            << "#if !defined(CQENUM_SUPPORT_V" << c_uSupportVersion << ")\n"
+            << "#define CQENUM_SUPPORT_V" << c_uSupportVersion << "\n"
+            << "#define CQENUM_SUPPORT_VERSION " << c_uSupportVersion << "\n"
+            << pszHdrSupportOpen
+            << pszHdrValues
+            << pszHdrTraits
+            << pszHdrFlagSet
+            << pszHdrBitmap
+            << pszHdrTransitions
+            << pszHdrCounters
+            << pszHdrLazyTable
+            << pszHdrBuckets
+            << pszHdrColumn
+            << pszHdrAtomicFlags
+            << pszHdrAliases
+            << pszHdrInstrument
+            << pszHdrVisit
+            << pszHdrUnion
+            << pszHdrFromChars
+            << pszHdrNameTrie
+            << pszHdrRemap
+            << pszHdrXlat
+            << pszHdrRegistry
+            << pszHdrSupportClose;
+
+    const std::string strNew = strmNew.str();
+    if (std::filesystem::exists(pathSupport))
+    {
+        std::ifstream strmOld(pathSupport, std::ifstream::in);
+        std::ostringstream strmOldText;
+        strmOldText << strmOld.rdbuf();
+        if (strmOldText.str() == strNew)
+        {
+            return;
+        }
+    }
+
+    std::ofstream strmTar(pathSupport, std::ofstream::out);
+    if (!strmTar.is_open())
+    {
+        throw std::runtime_error("Could not open the target support header file");
+    }
+    strmTar << strNew;
+}
+
+
+//
+//  Generate the enum to enum maps. Each one is a constexpr array of target values,
+//  indexed by the source value's dense index, plus one more for the default that
+//  invalid source values get. And an inline method to do the translation.
+//
+void CQEnumCppOutput::GenMaps(const CQEnumInfo& cqeiSrc)
+{
+    for (const MapInfo& mapiCur : cqeiSrc.m_listMaps.m_vMapList)
+    {
+        const std::string strSrc = cqeiSrc.m_strNSPrefix + mapiCur.m_strSource;
+        const std::string strTar = cqeiSrc.m_strNSPrefix + mapiCur.m_strTarget;
+        const size_t szCount = mapiCur.m_vTargets.size();
+
+        // The parser made sure the source enum exists
+        const EnumInfo& enumiSrc = *std::find_if
+        (
+            cqeiSrc.m_listEnums.m_vEnumList.begin()
+            , cqeiSrc.m_listEnums.m_vEnumList.end()
+            , [&mapiCur](const EnumInfo& enumiCur) { return enumiCur.m_strName == mapiCur.m_strSource; }
+        );
+
+        m_strmHdr   << "\n    struct " << mapiCur.m_strName << "Map\n    {\n"
+                    << "        static constexpr " << strTar << " s_aeTable[" << (szCount + 1)
+                    << "] =\n        {\n";
+        for (size_t szIndex = 0; szIndex < szCount; szIndex++)
+        {
+            m_strmHdr   << (szIndex ? "            , " : "              ") << strTar << "::"
+                        << mapiCur.m_vTargets[szIndex] << " // "
+                        << enumiSrc.m_vValues[szIndex].m_strName << "\n";
+        }
+        m_strmHdr   << "            , " << strTar << "::" << mapiCur.m_strDefault
+                    << " // Invalid source values\n"
+                    << "        };\n    };\n";
+
+        m_strmHdr   << "    constexpr " << strTar << " " << mapiCur.m_strName
+                    << "(const " << strSrc << " eSrc)\n    {\n"
+                    << "        const uint32_t uIndex = uEnumToIndex(eSrc);\n"
+                    << "        return " << mapiCur.m_strName << "Map::s_aeTable[(uIndex < "
+                    << szCount << ") ? uIndex : " << szCount << "];\n"
+                    << "    }\n";
+    }
+}
+
+
 // Generate the implementation stuff into the cpp file
 void CQEnumCppOutput::GenImpl(const CQEnumInfo& cqeiSrc)
 {
@@ -605,22 +5042,85 @@ void CQEnumCppOutput::GenImpl(const CQEnumInfo& cqeiSrc)
     m_strmImpl << "// Enumeration method implementations\n";
     for (const EnumInfo& enumiCur : cqeiSrc.m_listEnums.m_vEnumList)
     {
-        // We always do the name/value translations
+        const std::string strEnum = cqeiSrc.m_strNSPrefix + enumiCur.m_strName;
+
+        //
+        //  If runtime aliases are enabled, the registry. It's a function local static
+        //  so that it can be used during static init of other modules.
+        //
+        if (enumiCur.m_bAliases)
+        {
+            m_strmImpl  << "CQSL::CQEnum::AliasRegistry<" << cqeiSrc.m_strNSPrefix << enumiCur.m_strName
+                        << ">& " << enumiCur.m_strName << "Aliases()\n{\n"
+                        << "    static CQSL::CQEnum::AliasRegistry<" << cqeiSrc.m_strNSPrefix
+                        << enumiCur.m_strName << "> s_regAliases;\n"
+                        << "    return s_regAliases;\n}\n";
+        }
+
+        //
+        //  We always do the name/value translations. If aliases are enabled, they are
+        //  checked if it's not one of the actual names.
+        //
         m_strmImpl  << "bool bNameToEnum(const std::wstring_view& svName, "
-                    << cqeiSrc.m_strNSPrefix << enumiCur.m_strName << "& eToFill)\n"
+                    << strEnum << "& eToFill)\n"
                     << "{\n"
                     << "    const uint32_t uIndex = uNameToIndex(EnumTable_"
                     << enumiCur.m_strName << ".aevalTable, "
                     << enumiCur.m_vValues.size() << ", svName);\n"
                     << "    if (uIndex >= " << enumiCur.m_vValues.size() << ")\n"
-                    << "    {\n"
-                    << "        return false;\n"
-                    << "    }\n"
+                    << "    {\n";
+        if (enumiCur.m_bAliases)
+        {
+            m_strmImpl  << "        const bool bAlias = " << enumiCur.m_strName
+                        << "Aliases().bFind(svName, eToFill);\n"
+                        << "        CQENUM_LOOKUP(" << strEnum << ", NameToEnum, bAlias, "
+                        << enumiCur.m_vValues.size() << ");\n"
+                        << "        return bAlias;\n";
+        }
+        else
+        {
+            m_strmImpl  << "        CQENUM_LOOKUP(" << strEnum << ", NameToEnum, false, "
+                        << enumiCur.m_vValues.size() << ");\n"
+                        << "        return false;\n";
+        }
+        m_strmImpl  << "    }\n"
+                    << "    CQENUM_LOOKUP(" << strEnum << ", NameToEnum, true, uIndex + 1);\n"
                     << "    eToFill = static_cast<" << cqeiSrc.m_strNSPrefix << enumiCur.m_strName
                     << ">(EnumTable_" << enumiCur.m_strName << ".aevalTable[uIndex].iOrdinal);\n"
                     << "    return true;\n"
                     << "}\n";
 
+        //
+        //  The from_chars style parser. If this enum has no alt values, we have to mask
+        //  that rule off, else any zero would match the first value.
+        //
+        m_strmImpl  << "std::from_chars_result EnumFromChars(const char* const pszFirst, "
+                    << "const char* const pszLast, "
+                    << cqeiSrc.m_strNSPrefix << enumiCur.m_strName << "& eToFill, "
+                    << "const CQSL::CQEnum::EFromChars eRules)\n"
+                    << "{\n"
+                    << "    uint32_t uIndex = 0;\n"
+                    << "    const std::from_chars_result frRet = frIndexFromChars(EnumTable_"
+                    << enumiCur.m_strName << ".aevalTable, " << enumiCur.m_vValues.size()
+                    << ", pszFirst, pszLast, ";
+        if (enumiCur.m_bDoAltVal)
+        {
+            m_strmImpl << "eRules";
+        }
+        else
+        {
+            m_strmImpl  << "static_cast<CQSL::CQEnum::EFromChars>(static_cast<uint32_t>(eRules) & "
+                        << "~static_cast<uint32_t>(CQSL::CQEnum::EFromChars::AltVals))";
+        }
+        m_strmImpl  << ", uIndex);\n"
+                    << "    if (frRet.ec == std::errc())\n"
+                    << "    {\n"
+                    << "        eToFill = static_cast<" << cqeiSrc.m_strNSPrefix << enumiCur.m_strName
+                    << ">(EnumTable_" << enumiCur.m_strName << ".aevalTable[uIndex].iOrdinal);\n"
+                    << "    }\n"
+                    << "    return frRet;\n"
+                    << "}\n";
+
         m_strmImpl  << "const wchar_t* pszEnumToName(const " << cqeiSrc.m_strNSPrefix
                     << enumiCur.m_strName << " eVal)\n"
                     << "{\n"
@@ -629,8 +5129,12 @@ void CQEnumCppOutput::GenImpl(const CQEnumInfo& cqeiSrc)
                     << ", static_cast<int64_t>(eVal));\n"
                     << "    if (uIndex >= " << enumiCur.m_vValues.size() << ")\n"
                     << "    {\n"
+                    << "        CQENUM_LOOKUP(" << strEnum << ", EnumToName, false, "
+                    << "uOrdinalMissProbes(EnumTable_" << enumiCur.m_strName << ".aevalTable, "
+                    << enumiCur.m_vValues.size() << ", static_cast<int64_t>(eVal)));\n"
                     << "        return nullptr;\n"
                     << "    }\n"
+                    << "    CQENUM_LOOKUP(" << strEnum << ", EnumToName, true, uIndex + 1);\n"
                     << "    return EnumTable_" << enumiCur.m_strName << ".aevalTable[uIndex].pszName;\n"
                     << "}\n";
 
@@ -647,6 +5151,10 @@ void CQEnumCppOutput::GenImpl(const CQEnumInfo& cqeiSrc)
                         << "    const uint32_t uIndex = uOrdinalToIndex(EnumTable_"
                         << enumiCur.m_strName << ".aevalTable, " << enumiCur.m_vValues.size()
                         << ", static_cast<int64_t>(eTest));\n"
+                        << "    CQENUM_LOOKUP(" << strEnum << ", IsValid, uIndex < "
+                        << enumiCur.m_vValues.size() << ", (uIndex < " << enumiCur.m_vValues.size()
+                        << ") ? uIndex + 1 : uOrdinalMissProbes(EnumTable_" << enumiCur.m_strName
+                        << ".aevalTable, " << enumiCur.m_vValues.size() << ", static_cast<int64_t>(eTest)));\n"
                         << "    return (uIndex < " << enumiCur.m_vValues.size() << ");\n"
                         << "}\n";
         }
@@ -670,8 +5178,12 @@ void CQEnumCppOutput::GenImpl(const CQEnumInfo& cqeiSrc)
                         << ", " << enumiCur.m_vValues.size() << ", static_cast<int64_t>(eVal));\n"
                         << "    if (uIndex >= " << enumiCur.m_vValues.size() << ")\n"
                         << "    {\n"
-                        << "        return false;\n"                        
+                        << "        CQENUM_LOOKUP(" << strEnum << ", EnumToAltVal, false, "
+                        << "uOrdinalMissProbes(EnumTable_" << enumiCur.m_strName << ".aevalTable, "
+                        << enumiCur.m_vValues.size() << ", static_cast<int64_t>(eVal)));\n"
+                        << "        return false;\n"
                         << "    }\n"
+                        << "    CQENUM_LOOKUP(" << strEnum << ", EnumToAltVal, true, uIndex + 1);\n"
                         << "    iToFill = EnumTable_" << enumiCur.m_strName << ".aevalTable[uIndex].iAltVal;\n"
                         << "    return true;\n"
                         << "}\n";
@@ -684,14 +5196,246 @@ void CQEnumCppOutput::GenImpl(const CQEnumInfo& cqeiSrc)
                         << ", " << enumiCur.m_vValues.size() << ", iAltVal);\n"
                         << "    if (uIndex >= " << enumiCur.m_vValues.size() << ")\n"
                         << "    {\n"
+                        << "        CQENUM_LOOKUP(" << strEnum << ", AltValToEnum, false, "
+                        << enumiCur.m_vValues.size() << ");\n"
                         << "        return false;\n"
                         << "    }\n"
+                        << "    CQENUM_LOOKUP(" << strEnum << ", AltValToEnum, true, uIndex + 1);\n"
                         << "    eToFill = static_cast<" << cqeiSrc.m_strNSPrefix << enumiCur.m_strName
                         << ">(EnumTable_" << enumiCur.m_strName << ".aevalTable[uIndex].iOrdinal);\n"
                         << "    return true;\n"
                         << "}\n";
+
+            // The bulk ones go through the tables, and invalid values get zero
+            m_strmImpl  << "size_t EnumsToAltValues(const " << cqeiSrc.m_strNSPrefix
+                        << enumiCur.m_strName << "* const paeSrc, const size_t szCount, "
+                        << "int32_t* const paiTar, uint64_t* const pauInvalid)\n"
+                        << "{\n"
+                        << "    return CQSL::CQEnum::szXlatValues(paeSrc, szCount, paiTar, xtblToAltVal_"
+                        << enumiCur.m_strName << ", int32_t(0), pauInvalid);\n"
+                        << "}\n";
+
+            m_strmImpl  << "size_t AltValuesToEnums(const int32_t* const paiSrc, const size_t szCount, "
+                        << cqeiSrc.m_strNSPrefix << enumiCur.m_strName
+                        << "* const paeTar, uint64_t* const pauInvalid)\n"
+                        << "{\n"
+                        << "    return CQSL::CQEnum::szXlatValues(paiSrc, szCount, paeTar, xtblFromAltVal_"
+                        << enumiCur.m_strName << ", static_cast<" << cqeiSrc.m_strNSPrefix
+                        << enumiCur.m_strName << ">(0), pauInvalid);\n"
+                        << "}\n";
+        }
+    }
+}
+
+
+//
+//  Generate the EnumTraits specialization. The lookups are wrapped in static
+//  inline methods, so that the pointers to them are constant expressions even
+//  if the real ones are imported from a DLL.
+//
+void CQEnumCppOutput::GenEnumTraits(const EnumInfo& enumiSrc, const CQEnumInfo& cqeiSrc)
+{
+    const std::string strEnum = cqeiSrc.m_strNSPrefix + enumiSrc.m_strName;
+    const char* const pszBool[2] = { "false", "true" };
+
+    m_strmHdr   << "template <> struct EnumTraits<" << strEnum << ">\n{\n"
+                << "    using EnumType = " << strEnum << ";\n"
+                << "    using UnderType = std::underlying_type_t<" << strEnum << ">;\n\n"
+                << "    static constexpr EEnumKinds eKind = EEnumKinds::";
+    switch(enumiSrc.m_eType)
+    {
+        case EEnumTypes::Arbitary : m_strmHdr << "Arbitrary"; break;
+        case EEnumTypes::Bitmap : m_strmHdr << "Bitmap"; break;
+        case EEnumTypes::FlagSet : m_strmHdr << "FlagSet"; break;
+        case EEnumTypes::Standard : m_strmHdr << "Standard"; break;
+
+        default :
+            throw std::runtime_error("Internal: Unknown enum type in enum traits");
+            break;
+    };
+
+    m_strmHdr   << ";\n"
+                << "    static constexpr uint32_t c_uCount = " << enumiSrc.m_vValues.size() << ";\n"
+                << "    static constexpr " << strEnum << " eMin = " << strEnum << "::"
+                << enumiSrc.m_vValues.front().m_strName << ";\n"
+                << "    static constexpr " << strEnum << " eMax = " << strEnum << "::"
+                << enumiSrc.m_vValues.back().m_strName << ";\n"
+                << "    static constexpr bool bIsMonotonic = " << pszBool[enumiSrc.m_bIsMonotonic] << ";\n"
+                << "    static constexpr bool bHasText1 = " << pszBool[enumiSrc.m_bText1] << ";\n"
+                << "    static constexpr bool bHasText2 = " << pszBool[enumiSrc.m_bText2] << ";\n"
+                << "    static constexpr bool bHasAltVal = " << pszBool[enumiSrc.m_bDoAltVal] << ";\n"
+                << "    static constexpr bool bHasInc = " << pszBool[enumiSrc.m_bDoInc] << ";\n"
+                << "    static constexpr uint64_t c_uFingerprint = " << cqeiSrc.m_strNSPrefix
+                << enumiSrc.m_strName << "Schema::c_uFingerprint;\n\n";
+
+    // The wrappers for the lookups that always exist
+    m_strmHdr   << "    static const wchar_t* pszToName(const " << strEnum << " eVal) "
+                << "{ return " << cqeiSrc.m_strNSPrefix << "pszEnumToName(eVal); }\n"
+                << "    static bool bFromName(const std::wstring_view& svName, " << strEnum << "& eToFill) "
+                << "{ return " << cqeiSrc.m_strNSPrefix << "bNameToEnum(svName, eToFill); }\n"
+                << "    static std::from_chars_result FromChars(const char* const pszFirst, "
+                << "const char* const pszLast, " << strEnum << "& eToFill, const EFromChars eRules) "
+                << "{ return " << cqeiSrc.m_strNSPrefix
+                << "EnumFromChars(pszFirst, pszLast, eToFill, eRules); }\n"
+                << "    static bool bIsValid(const " << strEnum << " eTest) "
+                << "{ return " << cqeiSrc.m_strNSPrefix << "bIsValidEnumVal(eTest); }\n";
+
+    // And the optional ones
+    if (enumiSrc.m_bText1)
+    {
+        m_strmHdr   << "    static const wchar_t* pszToText1(const " << strEnum << " eVal) "
+                    << "{ return " << cqeiSrc.m_strNSPrefix << "pszEnumToAltText1(eVal); }\n";
+    }
+    if (enumiSrc.m_bText2)
+    {
+        m_strmHdr   << "    static const wchar_t* pszToText2(const " << strEnum << " eVal) "
+                    << "{ return " << cqeiSrc.m_strNSPrefix << "pszEnumToAltText2(eVal); }\n";
+    }
+    if (enumiSrc.m_bDoAltVal)
+    {
+        m_strmHdr   << "    static bool bToAltVal(const " << strEnum << " eVal, int32_t& iToFill) "
+                    << "{ return " << cqeiSrc.m_strNSPrefix << "bEnumToAltValue(eVal, iToFill); }\n"
+                    << "    static bool bFromAltVal(const int32_t iAltVal, " << strEnum << "& eToFill) "
+                    << "{ return " << cqeiSrc.m_strNSPrefix << "bEnumFromAltValue(iAltVal, eToFill); }\n"
+                    << "    static size_t szToAltVals(const " << strEnum << "* const paeSrc, const size_t szCount, "
+                    << "int32_t* const paiTar, uint64_t* const pauInvalid) "
+                    << "{ return " << cqeiSrc.m_strNSPrefix << "EnumsToAltValues(paeSrc, szCount, paiTar, pauInvalid); }\n"
+                    << "    static size_t szFromAltVals(const int32_t* const paiSrc, const size_t szCount, "
+                    << strEnum << "* const paeTar, uint64_t* const pauInvalid) "
+                    << "{ return " << cqeiSrc.m_strNSPrefix << "AltValuesToEnums(paiSrc, szCount, paeTar, pauInvalid); }\n";
+    }
+
+    m_strmHdr   << "\n"
+                << "    static constexpr const wchar_t* (*pfnToName)(" << strEnum << ") = &pszToName;\n"
+                << "    static constexpr bool (*pfnFromName)(const std::wstring_view&, " << strEnum
+                << "&) = &bFromName;\n"
+                << "    static constexpr std::from_chars_result (*pfnFromChars)(const char*, const char*, "
+                << strEnum << "&, EFromChars) = &FromChars;\n"
+                << "    static constexpr bool (*pfnIsValid)(" << strEnum << ") = &bIsValid;\n"
+                << "    static constexpr const wchar_t* (*pfnToText1)(" << strEnum << ") = "
+                << (enumiSrc.m_bText1 ? "&pszToText1" : "nullptr") << ";\n"
+                << "    static constexpr const wchar_t* (*pfnToText2)(" << strEnum << ") = "
+                << (enumiSrc.m_bText2 ? "&pszToText2" : "nullptr") << ";\n"
+                << "    static constexpr bool (*pfnToAltVal)(" << strEnum << ", int32_t&) = "
+                << (enumiSrc.m_bDoAltVal ? "&bToAltVal" : "nullptr") << ";\n"
+                << "    static constexpr bool (*pfnFromAltVal)(int32_t, " << strEnum << "&) = "
+                << (enumiSrc.m_bDoAltVal ? "&bFromAltVal" : "nullptr") << ";\n"
+                << "    static constexpr size_t (*pfnToAltVals)(const " << strEnum
+                << "*, size_t, int32_t*, uint64_t*) = "
+                << (enumiSrc.m_bDoAltVal ? "&szToAltVals" : "nullptr") << ";\n"
+                << "    static constexpr size_t (*pfnFromAltVals)(const int32_t*, size_t, " << strEnum
+                << "*, uint64_t*) = "
+                << (enumiSrc.m_bDoAltVal ? "&szFromAltVals" : "nullptr") << ";\n"
+                << "};\n";
+}
+
+
+//
+//  Compile the names of the enum's values into a trie, and generate a specialization
+//  of the NameTrie template with the node and edge tables, plus the values sorted by
+//  name. Matching is case insensitive, so we build it on the upper cased names.
+//
+//  We insert the names in sorted order, so each node's children are created in
+//  ascending character order, and the names under any node are a contiguous range
+//  of the sorted list.
+//
+void CQEnumCppOutput::GenNameTrie(const EnumInfo& enumiSrc, const CQEnumInfo& cqeiSrc)
+{
+    struct TrieNode
+    {
+        std::vector<std::pair<char, uint32_t>>  vEdges;
+        uint32_t                                uFirstName = 0;
+        uint32_t                                uEndName = 0;
+        uint32_t                                uNameIndex = 0xFFFFFFFF;
+    };
+
+    // Get the upper cased names and sort them, keeping track of the original value
+    std::vector<std::pair<std::string, const EnumValInfo*>> vSorted;
+    for (const EnumValInfo& evalCur : enumiSrc.m_vValues)
+    {
+        std::string strUpper(evalCur.m_strName);
+        for (char& chCur : strUpper)
+        {
+            chCur = static_cast<char>(std::toupper(static_cast<unsigned char>(chCur)));
+        }
+        vSorted.emplace_back(std::move(strUpper), &evalCur);
+    }
+    std::stable_sort
+    (
+        vSorted.begin()
+        , vSorted.end()
+        , [](const auto& pairLHS, const auto& pairRHS) { return pairLHS.first < pairRHS.first; }
+    );
+
+    std::vector<TrieNode> vNodes(1);
+    for (uint32_t uNameIndex = 0; uNameIndex < vSorted.size(); uNameIndex++)
+    {
+        uint32_t uNode = 0;
+        vNodes[0].uEndName = uNameIndex + 1;
+        for (const char chCur : vSorted[uNameIndex].first)
+        {
+            // Since the names are sorted, if there's a match it's the last edge
+            if (vNodes[uNode].vEdges.empty() || (vNodes[uNode].vEdges.back().first != chCur))
+            {
+                vNodes[uNode].vEdges.emplace_back(chCur, static_cast<uint32_t>(vNodes.size()));
+                vNodes.emplace_back();
+                vNodes.back().uFirstName = uNameIndex;
+            }
+            uNode = vNodes[uNode].vEdges.back().second;
+            vNodes[uNode].uEndName = uNameIndex + 1;
+        }
+
+        // If names differ only by case, the first one wins, as with bNameToEnum
+        if (vNodes[uNode].uNameIndex == 0xFFFFFFFF)
+        {
+            vNodes[uNode].uNameIndex = uNameIndex;
+        }
+    }
+
+    const std::string strEnum = cqeiSrc.m_strNSPrefix + enumiSrc.m_strName;
+    m_strmHdr   << "template <> struct NameTrie<" << strEnum << ">\n{\n"
+                << "    static constexpr NameTrieNode s_anodeTable[] =\n    {\n";
+
+    uint32_t uFirstEdge = 0;
+    for (uint32_t uIndex = 0; uIndex < vNodes.size(); uIndex++)
+    {
+        const TrieNode& nodeCur = vNodes[uIndex];
+        m_strmHdr   << ((uIndex == 0) ? "          { " : "        , { ")
+                    << uFirstEdge << ", " << nodeCur.vEdges.size() << ", "
+                    << nodeCur.uFirstName << ", " << nodeCur.uEndName << ", ";
+        if (nodeCur.uNameIndex == 0xFFFFFFFF)
+        {
+            m_strmHdr << "c_uTrieNoName";
+        }
+        else
+        {
+            m_strmHdr << nodeCur.uNameIndex;
         }
+        m_strmHdr << " }\n";
+        uFirstEdge += static_cast<uint32_t>(nodeCur.vEdges.size());
+    }
+
+    m_strmHdr << "    };\n    static constexpr NameTrieEdge s_aedgeTable[] =\n    {\n";
+    bool bFirst = true;
+    for (const TrieNode& nodeCur : vNodes)
+    {
+        for (const std::pair<char, uint32_t>& pairEdge : nodeCur.vEdges)
+        {
+            m_strmHdr   << (bFirst ? "          { '" : "        , { '")
+                        << pairEdge.first << "', " << pairEdge.second << " }\n";
+            bFirst = false;
+        }
+    }
+
+    m_strmHdr << "    };\n    static constexpr " << strEnum << " s_aeByName[] =\n    {\n";
+    bFirst = true;
+    for (const auto& pairCur : vSorted)
+    {
+        m_strmHdr   << (bFirst ? "          " : "        , ")
+                    << strEnum << "::" << pairCur.second->m_strName << "\n";
+        bFirst = false;
     }
+    m_strmHdr << "    };\n};\n";
 }
 
 
@@ -704,6 +5448,7 @@ void CQEnumCppOutput::GenTextXlatImpl(const uint32_t        uTextNum
                                     , const EnumInfo&       enumiSrc
                                     , const CQEnumInfo&     cqeiSrc)
 {
+    const std::string strEnum = cqeiSrc.m_strNSPrefix + enumiSrc.m_strName;
     m_strmImpl  << "const wchar_t* pszEnumToAltText" << uTextNum << "(const " << cqeiSrc.m_strNSPrefix
                 << enumiSrc.m_strName << " eVal)\n{    \n    uint32_t uIndex = 0;\n";
 
@@ -716,10 +5461,13 @@ void CQEnumCppOutput::GenTextXlatImpl(const uint32_t        uTextNum
         m_strmImpl  << "    if ((eVal < " << cqeiSrc.m_strNSPrefix
                     << enumiSrc.m_strName << "::Min) || (eVal > "
                     << cqeiSrc.m_strNSPrefix << enumiSrc.m_strName
-                    << "::Max))\n    {\n        throw std::runtime_error(\""
+                    << "::Max))\n    {\n"
+                    << "        CQENUM_LOOKUP(" << strEnum << ", EnumToText" << uTextNum << ", false, 0);\n"
+                    << "        throw std::runtime_error(\""
                     << "Invalid value for '" << cqeiSrc.m_strNSPrefix << enumiSrc.m_strName
                     << "' enumeration\");\n    }\n"
-                    << "    uIndex = static_cast<uint32_t>(eVal);\n";
+                    << "    uIndex = static_cast<uint32_t>(eVal);\n"
+                    << "    CQENUM_LOOKUP(" << strEnum << ", EnumToText" << uTextNum << ", true, 1);\n";
     }
     else
     {
@@ -728,8 +5476,12 @@ void CQEnumCppOutput::GenTextXlatImpl(const uint32_t        uTextNum
                     << enumiSrc.m_vValues.size() << ", static_cast<int64_t>(eVal));\n"
                     << "    if (uIndex >= " << enumiSrc.m_vValues.size() << ")\n"
                     << "    {\n"
+                    << "        CQENUM_LOOKUP(" << strEnum << ", EnumToText" << uTextNum << ", false, "
+                    << "uOrdinalMissProbes(EnumTable_" << enumiSrc.m_strName << ".aevalTable, "
+                    << enumiSrc.m_vValues.size() << ", static_cast<int64_t>(eVal)));\n"
                     << "        throw std::runtime_error(\"Invalid value for '" << cqeiSrc.m_strNSPrefix
-                    << enumiSrc.m_strName << "' enumeration\");\n    }\n";
+                    << enumiSrc.m_strName << "' enumeration\");\n    }\n"
+                    << "    CQENUM_LOOKUP(" << strEnum << ", EnumToText" << uTextNum << ", true, uIndex + 1);\n";
     }
 
     m_strmImpl << "    return EnumTable_" << enumiSrc.m_strName << ".aevalTable[uIndex].pszText"
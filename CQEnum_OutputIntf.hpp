@@ -77,6 +77,7 @@ class CQEnumCppOutput : public CQEnumOutputIntf
             , const std::string&            strBaseName
             ,       path&                   pathHdr
             ,       path&                   pathImpl
+            ,       path&                   pathSupport
         );
 
         // Helpers to generate the various types of output
@@ -90,6 +91,12 @@ class CQEnumCppOutput : public CQEnumOutputIntf
             const   CQEnumInfo&             cqeiSrc
         );
 
+        void GenEnumTraits
+        (
+            const   EnumInfo&               enumiSrc
+            , const CQEnumInfo&             cqeiSrc
+        );
+
         void GenGlobals
         (
             const   CQEnumInfo&             cqeiSrc
@@ -99,7 +106,36 @@ class CQEnumCppOutput : public CQEnumOutputIntf
         (
             const   CQEnumInfo&             cqeiSrc
         );
+
+        void GenMaps
+        (
+            const   CQEnumInfo&             cqeiSrc
+        );
       
+        void GenNameTrie
+        (
+            const   EnumInfo&               enumiSrc
+            , const CQEnumInfo&             cqeiSrc
+        );
+
+        void GenRemap
+        (
+            const   EnumInfo&               enumiSrc
+            , const EnumInfo&               enumiPrev
+            , const CQEnumInfo&             cqeiSrc
+        );
+
+        void GenRegistry
+        (
+            const   CQEnumInfo&             cqeiSrc
+            , const std::string&            strBaseName
+        );
+
+        void GenSupport
+        (
+            const   path&                   pathSupport
+        );
+
         void GenTextXlatImpl
         (
             const   uint32_t                uTextNum
@@ -5,9 +5,16 @@
 //  it won't be incompatible if they don't.
 //
 
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstring>
 #include <exception>
 #include <string>
 #include <iostream>
+#include <iterator>
+#include <limits>
+#include <sstream>
 #include <filesystem>
 #include <fstream>
 #include <vector>
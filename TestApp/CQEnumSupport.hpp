@@ -0,0 +1,3120 @@
+// This file was auto-generated by CQEnum.exe, do not edit
+#if defined(CQENUM_SUPPORT_VERSION) && (CQENUM_SUPPORT_VERSION != 3)
+#error "CQEnumSupport.hpp from different versions of CQEnum were included"
+#endif
+#if !defined(CQENUM_SUPPORT_V3)
+#define CQENUM_SUPPORT_V3
+#define CQENUM_SUPPORT_VERSION 3
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <charconv>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#if defined(__AVX2__) || defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define CQENUM_SIMD_SSE2
+#include <immintrin.h>
+#endif
+#if defined(__BMI2__) || (defined(_MSC_VER) && defined(__AVX2__))
+#define CQENUM_BMI2
+#include <immintrin.h>
+#endif
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#if defined(CQENUM_INSTRUMENT)
+#include <ostream>
+#endif
+
+namespace CQSL { namespace CQEnum {
+// A range of values, which can be used in a range based for loop
+template <typename E> struct ValueRange
+{
+    const E*    pBegin;
+    const E*    pEnd;
+
+    constexpr const E* begin() const noexcept { return pBegin; }
+    constexpr const E* end() const noexcept { return pEnd; }
+    constexpr bool bIsEmpty() const noexcept { return pBegin == pEnd; }
+    constexpr uint32_t uCount() const noexcept { return static_cast<uint32_t>(pEnd - pBegin); }
+};
+
+//
+//  The generator specializes this for each enum, with all of the values in the
+//  order defined, not including synonyms or magic values.
+//
+template <typename E> struct EnumValueList;
+
+// Iterate all of the values of an enum, e.g. for (auto eVal : AllValues<EMyEnum>())
+template <typename E>
+constexpr ValueRange<E> AllValues() noexcept
+{
+    return ValueRange<E>
+    {
+        EnumValueList<E>::s_aeValues
+        , EnumValueList<E>::s_aeValues + EnumValueList<E>::c_uCount
+    };
+}
+
+// The kinds of enums, as reported by EnumTraits
+enum class EEnumKinds { Arbitrary, Bitmap, FlagSet, Standard };
+
+//
+//  The generator specializes this for each enum, with compile time info about
+//  the enum, and pointers to its lookup functions so that generic code can get
+//  to them without knowing the type. Pointers for lookups the enum doesn't have
+//  (text or alt values not enabled) are null.
+//
+//      EnumType, UnderType
+//      eKind, c_uCount, eMin, eMax (lowest and highest values)
+//      bIsMonotonic, bHasText1, bHasText2, bHasAltVal, bHasInc
+//      c_uFingerprint (the schema fingerprint)
+//      pfnToName, pfnFromName, pfnFromChars, pfnIsValid, pfnToText1,
+//      pfnToText2, pfnToAltVal, pfnFromAltVal, pfnToAltVals,
+//      pfnFromAltVals (bulk alt value translation)
+//
+template <typename E> struct EnumTraits;
+//
+//  Support for FlagSet enums. The values are bit positions into a fixed
+//  size array of 64 bit words, so it can be larger than any underlying type.
+//  The bulk operations work a vector at a time where the target supports it.
+//
+enum class EWordOps { And, AndNot, Or, Xor };
+
+inline uint32_t uWordBitCount(const uint64_t uWord) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<uint32_t>(__builtin_popcountll(uWord));
+#elif defined(_MSC_VER) && defined(_M_X64) && defined(__AVX__)
+    return static_cast<uint32_t>(__popcnt64(uWord));
+#else
+    uint64_t uTmp = uWord - ((uWord >> 1) & 0x5555555555555555ULL);
+    uTmp = (uTmp & 0x3333333333333333ULL) + ((uTmp >> 2) & 0x3333333333333333ULL);
+    uTmp = (uTmp + (uTmp >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+    return static_cast<uint32_t>((uTmp * 0x0101010101010101ULL) >> 56);
+#endif
+}
+
+// The caller must insure that at least one bit is on
+inline uint32_t uWordLowBit(const uint64_t uWord) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<uint32_t>(__builtin_ctzll(uWord));
+#elif defined(_MSC_VER) && defined(_M_X64)
+    unsigned long ulIndex = 0;
+    _BitScanForward64(&ulIndex, uWord);
+    return static_cast<uint32_t>(ulIndex);
+#else
+    uint32_t uRet = 0;
+    while (!(uWord & (1ULL << uRet)))
+    {
+        uRet++;
+    }
+    return uRet;
+#endif
+}
+
+// Combine the source words into the target words, using the indicated operation
+template <EWordOps eOp>
+inline void CombineWords(       uint64_t* const pauTar
+                        , const uint64_t* const pauSrc
+                        , const uint32_t        uWords) noexcept
+{
+    uint32_t uIndex = 0;
+#if defined(__AVX2__)
+    for (; uIndex + 4 <= uWords; uIndex += 4)
+    {
+        const __m256i vTar = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pauTar + uIndex));
+        const __m256i vSrc = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pauSrc + uIndex));
+        __m256i vRes;
+        if constexpr (eOp == EWordOps::And) { vRes = _mm256_and_si256(vTar, vSrc); }
+        else if constexpr (eOp == EWordOps::AndNot) { vRes = _mm256_andnot_si256(vSrc, vTar); }
+        else if constexpr (eOp == EWordOps::Or) { vRes = _mm256_or_si256(vTar, vSrc); }
+        else { vRes = _mm256_xor_si256(vTar, vSrc); }
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(pauTar + uIndex), vRes);
+    }
+#endif
+#if defined(CQENUM_SIMD_SSE2)
+    for (; uIndex + 2 <= uWords; uIndex += 2)
+    {
+        const __m128i vTar = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pauTar + uIndex));
+        const __m128i vSrc = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pauSrc + uIndex));
+        __m128i vRes;
+        if constexpr (eOp == EWordOps::And) { vRes = _mm_and_si128(vTar, vSrc); }
+        else if constexpr (eOp == EWordOps::AndNot) { vRes = _mm_andnot_si128(vSrc, vTar); }
+        else if constexpr (eOp == EWordOps::Or) { vRes = _mm_or_si128(vTar, vSrc); }
+        else { vRes = _mm_xor_si128(vTar, vSrc); }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(pauTar + uIndex), vRes);
+    }
+#endif
+    for (; uIndex < uWords; uIndex++)
+    {
+        if constexpr (eOp == EWordOps::And) { pauTar[uIndex] &= pauSrc[uIndex]; }
+        else if constexpr (eOp == EWordOps::AndNot) { pauTar[uIndex] &= ~pauSrc[uIndex]; }
+        else if constexpr (eOp == EWordOps::Or) { pauTar[uIndex] |= pauSrc[uIndex]; }
+        else { pauTar[uIndex] ^= pauSrc[uIndex]; }
+    }
+}
+
+//
+//  Apply the operation to the two sets of words and return whether any bits are
+//  on in the result, without storing it. It ORs the results together and only
+//  tests once at the end, so it doesn't branch on the contents.
+//
+template <EWordOps eOp>
+inline bool bAnyWordBits(const  uint64_t* const pauLHS
+                        , const uint64_t* const pauRHS
+                        , const uint32_t        uWords) noexcept
+{
+    uint32_t uIndex = 0;
+    uint64_t uAccum = 0;
+#if defined(__AVX2__)
+    __m256i vAccum256 = _mm256_setzero_si256();
+    for (; uIndex + 4 <= uWords; uIndex += 4)
+    {
+        const __m256i vLHS = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pauLHS + uIndex));
+        const __m256i vRHS = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pauRHS + uIndex));
+        if constexpr (eOp == EWordOps::And) { vAccum256 = _mm256_or_si256(vAccum256, _mm256_and_si256(vLHS, vRHS)); }
+        else if constexpr (eOp == EWordOps::AndNot) { vAccum256 = _mm256_or_si256(vAccum256, _mm256_andnot_si256(vRHS, vLHS)); }
+        else if constexpr (eOp == EWordOps::Or) { vAccum256 = _mm256_or_si256(vAccum256, _mm256_or_si256(vLHS, vRHS)); }
+        else { vAccum256 = _mm256_or_si256(vAccum256, _mm256_xor_si256(vLHS, vRHS)); }
+    }
+    uAccum |= static_cast<uint64_t>(!_mm256_testz_si256(vAccum256, vAccum256));
+#endif
+#if defined(CQENUM_SIMD_SSE2)
+    __m128i vAccum128 = _mm_setzero_si128();
+    for (; uIndex + 2 <= uWords; uIndex += 2)
+    {
+        const __m128i vLHS = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pauLHS + uIndex));
+        const __m128i vRHS = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pauRHS + uIndex));
+        if constexpr (eOp == EWordOps::And) { vAccum128 = _mm_or_si128(vAccum128, _mm_and_si128(vLHS, vRHS)); }
+        else if constexpr (eOp == EWordOps::AndNot) { vAccum128 = _mm_or_si128(vAccum128, _mm_andnot_si128(vRHS, vLHS)); }
+        else if constexpr (eOp == EWordOps::Or) { vAccum128 = _mm_or_si128(vAccum128, _mm_or_si128(vLHS, vRHS)); }
+        else { vAccum128 = _mm_or_si128(vAccum128, _mm_xor_si128(vLHS, vRHS)); }
+    }
+    uAccum |= static_cast<uint64_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(vAccum128, _mm_setzero_si128())) != 0xFFFF);
+#endif
+    for (; uIndex < uWords; uIndex++)
+    {
+        if constexpr (eOp == EWordOps::And) { uAccum |= pauLHS[uIndex] & pauRHS[uIndex]; }
+        else if constexpr (eOp == EWordOps::AndNot) { uAccum |= pauLHS[uIndex] & ~pauRHS[uIndex]; }
+        else if constexpr (eOp == EWordOps::Or) { uAccum |= pauLHS[uIndex] | pauRHS[uIndex]; }
+        else { uAccum |= pauLHS[uIndex] ^ pauRHS[uIndex]; }
+    }
+    return uAccum != 0;
+}
+
+
+// Builds the words for a flag set with all of the defined bits on
+template <uint32_t uBits>
+constexpr std::array<uint64_t, (uBits + 63) / 64> auFlagSetMask() noexcept
+{
+    std::array<uint64_t, (uBits + 63) / 64> auRet = {};
+    for (uint32_t uIndex = 0; uIndex < auRet.size(); uIndex++)
+    {
+        auRet[uIndex] = ~0ULL;
+    }
+    if (uBits % 64)
+    {
+        auRet[auRet.size() - 1] = (1ULL << (uBits % 64)) - 1;
+    }
+    return auRet;
+}
+
+
+//
+//  The generator creates an alias of this for each FlagSet enum, with the value
+//  count as the bit count. So E's values are 0 to uBits-1.
+//
+template <typename E, uint32_t uBits> class FlagSet
+{
+    public :
+        static_assert(uBits > 0, "A flag set must have at least one bit");
+
+        static constexpr uint32_t c_uBits = uBits;
+        static constexpr uint32_t c_uWords = (uBits + 63) / 64;
+
+        // Iterates the values of the bits that are on, in ascending order
+        class Iterator
+        {
+            public :
+                Iterator(const uint64_t* const pauWords, const uint32_t uWord) noexcept :
+
+                    m_pauWords(pauWords)
+                    , m_uWord(uWord)
+                    , m_uCurBits((uWord < c_uWords) ? pauWords[uWord] : 0)
+                {
+                    SkipEmpty();
+                }
+
+                E operator*() const noexcept
+                {
+                    return static_cast<E>((m_uWord * 64) + uWordLowBit(m_uCurBits));
+                }
+
+                Iterator& operator++() noexcept
+                {
+                    m_uCurBits &= m_uCurBits - 1;
+                    SkipEmpty();
+                    return *this;
+                }
+
+                bool operator==(const Iterator& itSrc) const noexcept
+                {
+                    return (m_uWord == itSrc.m_uWord) && (m_uCurBits == itSrc.m_uCurBits);
+                }
+
+                bool operator!=(const Iterator& itSrc) const noexcept
+                {
+                    return !operator==(itSrc);
+                }
+
+            private :
+                void SkipEmpty() noexcept
+                {
+                    while (!m_uCurBits && (m_uWord < c_uWords))
+                    {
+                        if (++m_uWord < c_uWords)
+                        {
+                            m_uCurBits = m_pauWords[m_uWord];
+                        }
+                    }
+                }
+
+                const uint64_t* m_pauWords;
+                uint32_t        m_uWord;
+                uint64_t        m_uCurBits;
+        };
+
+        //
+        //  Parse a list of value names separated by | characters, as created by
+        //  strFormat(). An empty string is an empty set.
+        //
+        static bool bParse(const std::wstring_view& svText, FlagSet& fsetToFill)
+        {
+            FlagSet fsetRet;
+            std::wstring strName;
+            E eVal;
+            size_t szStart = 0;
+            while (szStart <= svText.size())
+            {
+                size_t szEnd = svText.find(L'|', szStart);
+                if (szEnd == std::wstring_view::npos)
+                {
+                    szEnd = svText.size();
+                }
+
+                // Get the name out, without any leading or trailing space
+                strName.assign(svText.substr(szStart, szEnd - szStart));
+                const size_t szFirst = strName.find_first_not_of(L" \t");
+                const size_t szLast = strName.find_last_not_of(L" \t");
+                if (szFirst == std::wstring::npos)
+                {
+                    strName.clear();
+                }
+                else
+                {
+                    strName = strName.substr(szFirst, (szLast - szFirst) + 1);
+                }
+
+                if (!strName.empty())
+                {
+                    if (!bNameToEnum(strName, eVal))
+                    {
+                        return false;
+                    }
+                    fsetRet.Set(eVal);
+                }
+                else if ((szEnd != svText.size()) || (szStart != 0))
+                {
+                    // An empty name is only valid for an empty list
+                    return false;
+                }
+                szStart = szEnd + 1;
+            }
+            fsetToFill = fsetRet;
+            return true;
+        }
+
+        constexpr FlagSet() noexcept = default;
+
+        FlagSet(const std::initializer_list<E> ilBits) noexcept
+        {
+            for (const E eBit : ilBits)
+            {
+                Set(eBit);
+            }
+        }
+
+        bool operator==(const FlagSet& fsetSrc) const noexcept
+        {
+            return !bAnyWordBits<EWordOps::Xor>(m_auWords, fsetSrc.m_auWords, c_uWords);
+        }
+
+        bool operator!=(const FlagSet& fsetSrc) const noexcept
+        {
+            return !operator==(fsetSrc);
+        }
+
+        FlagSet& operator&=(const FlagSet& fsetSrc) noexcept
+        {
+            CombineWords<EWordOps::And>(m_auWords, fsetSrc.m_auWords, c_uWords);
+            return *this;
+        }
+
+        FlagSet& operator|=(const FlagSet& fsetSrc) noexcept
+        {
+            CombineWords<EWordOps::Or>(m_auWords, fsetSrc.m_auWords, c_uWords);
+            return *this;
+        }
+
+        FlagSet& operator^=(const FlagSet& fsetSrc) noexcept
+        {
+            CombineWords<EWordOps::Xor>(m_auWords, fsetSrc.m_auWords, c_uWords);
+            return *this;
+        }
+
+        FlagSet operator&(const FlagSet& fsetSrc) const noexcept
+        {
+            FlagSet fsetRet(*this);
+            fsetRet &= fsetSrc;
+            return fsetRet;
+        }
+
+        FlagSet operator|(const FlagSet& fsetSrc) const noexcept
+        {
+            FlagSet fsetRet(*this);
+            fsetRet |= fsetSrc;
+            return fsetRet;
+        }
+
+        FlagSet operator^(const FlagSet& fsetSrc) const noexcept
+        {
+            FlagSet fsetRet(*this);
+            fsetRet ^= fsetSrc;
+            return fsetRet;
+        }
+
+        // Flips all of the defined bits, leaving any unused high bits off
+        FlagSet operator~() const noexcept
+        {
+            FlagSet fsetRet;
+            fsetRet.SetAll();
+            fsetRet.AndNot(*this);
+            return fsetRet;
+        }
+
+        // True if all of the defined bits are on
+        bool bAll() const noexcept
+        {
+            return !bAnyWordBits<EWordOps::AndNot>(s_auAllWords.data(), m_auWords, c_uWords);
+        }
+
+        // True if all of the bits on in fsetTest are on in this set
+        bool bAllOf(const FlagSet& fsetTest) const noexcept
+        {
+            return !bAnyWordBits<EWordOps::AndNot>(fsetTest.m_auWords, m_auWords, c_uWords);
+        }
+
+        bool bAny() const noexcept
+        {
+            return bAnyWordBits<EWordOps::Or>(m_auWords, m_auWords, c_uWords);
+        }
+
+        // True if any of the bits on in fsetTest are on in this set
+        bool bAnyOf(const FlagSet& fsetTest) const noexcept
+        {
+            return bAnyWordBits<EWordOps::And>(m_auWords, fsetTest.m_auWords, c_uWords);
+        }
+
+        bool bIsSet(const E eBit) const noexcept
+        {
+            const uint32_t uBit = static_cast<uint32_t>(eBit);
+            return (uBit < uBits) && ((m_auWords[uBit / 64] >> (uBit % 64)) & 1);
+        }
+
+        bool bNone() const noexcept
+        {
+            return !bAny();
+        }
+
+        Iterator begin() const noexcept
+        {
+            return Iterator(m_auWords, 0);
+        }
+
+        Iterator end() const noexcept
+        {
+            return Iterator(m_auWords, c_uWords);
+        }
+
+        // Turn off any bits that are on in the source
+        FlagSet& AndNot(const FlagSet& fsetSrc) noexcept
+        {
+            CombineWords<EWordOps::AndNot>(m_auWords, fsetSrc.m_auWords, c_uWords);
+            return *this;
+        }
+
+        void Clear(const E eBit) noexcept
+        {
+            const uint32_t uBit = static_cast<uint32_t>(eBit);
+            if (uBit < uBits)
+            {
+                m_auWords[uBit / 64] &= ~(1ULL << (uBit % 64));
+            }
+        }
+
+        void ClearAll() noexcept
+        {
+            *this = FlagSet();
+        }
+
+        const uint64_t* pauWords() const noexcept
+        {
+            return m_auWords;
+        }
+
+        void Set(const E eBit) noexcept
+        {
+            const uint32_t uBit = static_cast<uint32_t>(eBit);
+            if (uBit < uBits)
+            {
+                m_auWords[uBit / 64] |= (1ULL << (uBit % 64));
+            }
+        }
+
+        void SetAll() noexcept
+        {
+            for (uint32_t uIndex = 0; uIndex < c_uWords; uIndex++)
+            {
+                m_auWords[uIndex] = s_auAllWords[uIndex];
+            }
+        }
+
+        // Format out the names of the bits that are on, separated by | characters
+        std::wstring strFormat() const
+        {
+            std::wstring strRet;
+            for (const E eBit : *this)
+            {
+                if (!strRet.empty())
+                {
+                    strRet.push_back(L'|');
+                }
+                strRet.append(pszEnumToName(eBit));
+            }
+            return strRet;
+        }
+
+        uint32_t uCount() const noexcept
+        {
+            uint32_t uRet = 0;
+            for (uint32_t uIndex = 0; uIndex < c_uWords; uIndex++)
+            {
+                uRet += uWordBitCount(m_auWords[uIndex]);
+            }
+            return uRet;
+        }
+
+
+    private :
+        // The words with only the defined bits on
+        static constexpr std::array<uint64_t, c_uWords> s_auAllWords = auFlagSetMask<uBits>();
+
+        uint64_t    m_auWords[c_uWords] = {};
+};
+
+//
+//  Support for the list versions of the Bitmap enum validity checks. This ORs
+//  together all of the values in a list, a vector at a time where the target
+//  supports it, so that they can be checked against the valid bits all at once.
+//
+template <typename E>
+inline std::underlying_type_t<E> uOrAllBits(const E* const peList, const size_t szCount) noexcept
+{
+    using UnderType = std::underlying_type_t<E>;
+    static_assert(sizeof(E) == sizeof(UnderType), "Enum and underlying type sizes differ");
+
+    UnderType uRet = 0;
+    size_t szIndex = 0;
+#if defined(__AVX2__)
+    constexpr size_t c_szPerVec = 32 / sizeof(UnderType);
+    if (szCount >= c_szPerVec)
+    {
+        __m256i vecAccum = _mm256_setzero_si256();
+        for (; szIndex + c_szPerVec <= szCount; szIndex += c_szPerVec)
+        {
+            vecAccum = _mm256_or_si256
+            (
+                vecAccum, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(peList + szIndex))
+            );
+        }
+        UnderType auLanes[c_szPerVec];
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(auLanes), vecAccum);
+        for (const UnderType uLane : auLanes)
+        {
+            uRet |= uLane;
+        }
+    }
+#elif defined(CQENUM_SIMD_SSE2)
+    constexpr size_t c_szPerVec = 16 / sizeof(UnderType);
+    if (szCount >= c_szPerVec)
+    {
+        __m128i vecAccum = _mm_setzero_si128();
+        for (; szIndex + c_szPerVec <= szCount; szIndex += c_szPerVec)
+        {
+            vecAccum = _mm_or_si128
+            (
+                vecAccum, _mm_loadu_si128(reinterpret_cast<const __m128i*>(peList + szIndex))
+            );
+        }
+        UnderType auLanes[c_szPerVec];
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(auLanes), vecAccum);
+        for (const UnderType uLane : auLanes)
+        {
+            uRet |= uLane;
+        }
+    }
+#endif
+    for (; szIndex < szCount; szIndex++)
+    {
+        uRet |= static_cast<UnderType>(peList[szIndex]);
+    }
+    return uRet;
+}
+
+//
+//  Returns true if every value in the list has exactly one bit on. It doesn't
+//  branch per value, so that the compiler can vectorize it.
+//
+template <typename E>
+inline bool bAllSingleBits(const E* const peList, const size_t szCount) noexcept
+{
+    using UnsignedType = std::make_unsigned_t<std::underlying_type_t<E>>;
+    UnsignedType uMultiBits = 0;
+    bool bAnyZero = false;
+    for (size_t szIndex = 0; szIndex < szCount; szIndex++)
+    {
+        const UnsignedType uCur = static_cast<UnsignedType>(peList[szIndex]);
+        uMultiBits |= static_cast<UnsignedType>(uCur & (uCur - 1));
+        bAnyZero |= (uCur == 0);
+    }
+    return !uMultiBits && !bAnyZero;
+}
+
+//
+//  The generator specializes this for each Bitmap enum, with the mask of all of
+//  its bits and how many there are. The generated uCombinationIndex() compacts
+//  the defined bits of a value down into a dense index of that many bits.
+//
+template <typename E> struct BitmapCombos;
+
+//
+//  A table with an entry per combination of the bits of a Bitmap enum, indexed
+//  by the dense combination index, so a lookup is one compaction and one load.
+//  Bits that aren't defined for the enum are ignored. It's stored inline, so it
+//  is limited to 16 bits, i.e. 64K entries.
+//
+template <typename E, typename T> class EnumComboTable
+{
+    public :
+        static constexpr uint32_t c_uBits = BitmapCombos<E>::c_uBits;
+        static_assert(c_uBits <= 16, "Combination tables are limited to enums of 16 bits");
+        static constexpr uint32_t c_uSize = 1UL << c_uBits;
+
+        EnumComboTable() = default;
+
+        explicit EnumComboTable(const T& tInit)
+        {
+            m_atEntries.fill(tInit);
+        }
+
+        // Get the combination of bits for a dense combination index
+        static constexpr E eCombination(const uint32_t uIndex) noexcept
+        {
+            uint32_t uMask = BitmapCombos<E>::c_uMask;
+            uint32_t uRet = 0;
+            for (uint32_t uBit = 1; uMask; uBit <<= 1)
+            {
+                const uint32_t uLow = uMask & (0 - uMask);
+                if (uIndex & uBit)
+                {
+                    uRet |= uLow;
+                }
+                uMask ^= uLow;
+            }
+            return static_cast<E>(uRet);
+        }
+
+        T& operator[](const E eBits) noexcept
+        {
+            return m_atEntries[uCombinationIndex(eBits)];
+        }
+
+        const T& operator[](const E eBits) const noexcept
+        {
+            return m_atEntries[uCombinationIndex(eBits)];
+        }
+
+        T* begin() noexcept { return m_atEntries.data(); }
+        T* end() noexcept { return m_atEntries.data() + c_uSize; }
+        const T* begin() const noexcept { return m_atEntries.data(); }
+        const T* end() const noexcept { return m_atEntries.data() + c_uSize; }
+
+    private :
+        std::array<T, c_uSize>  m_atEntries = {};
+};
+
+//
+//  Support for enums with a Transitions= block. The generator creates a bit
+//  matrix with a row of 64 bit words per value (in defined order), with a bit
+//  on for each value that can be moved to from that one. This iterates the
+//  bits that are on in a row, i.e. the successors of a value. It is also used
+//  to iterate the members of value groups, which are a single such row.
+//
+template <typename E, uint32_t uWords> class SuccessorRange
+{
+    public :
+        class Iterator
+        {
+            public :
+                Iterator(const uint64_t* const pauRow, const uint32_t uWord) noexcept :
+
+                    m_pauRow(pauRow)
+                    , m_uWord(uWord)
+                    , m_uCurBits((uWord < uWords) ? pauRow[uWord] : 0)
+                {
+                    SkipEmpty();
+                }
+
+                E operator*() const noexcept
+                {
+                    return EnumValueList<E>::s_aeValues[(m_uWord * 64) + uWordLowBit(m_uCurBits)];
+                }
+
+                Iterator& operator++() noexcept
+                {
+                    m_uCurBits &= m_uCurBits - 1;
+                    SkipEmpty();
+                    return *this;
+                }
+
+                bool operator==(const Iterator& itSrc) const noexcept
+                {
+                    return (m_uWord == itSrc.m_uWord) && (m_uCurBits == itSrc.m_uCurBits);
+                }
+
+                bool operator!=(const Iterator& itSrc) const noexcept
+                {
+                    return !operator==(itSrc);
+                }
+
+            private :
+                void SkipEmpty() noexcept
+                {
+                    while (!m_uCurBits && (m_uWord < uWords))
+                    {
+                        if (++m_uWord < uWords)
+                        {
+                            m_uCurBits = m_pauRow[m_uWord];
+                        }
+                    }
+                }
+
+                const uint64_t* m_pauRow;
+                uint32_t        m_uWord;
+                uint64_t        m_uCurBits;
+        };
+
+        // A null row (for an invalid value) is an empty range
+        explicit SuccessorRange(const uint64_t* const pauRow) noexcept :
+
+            m_pauRow(pauRow)
+        {
+        }
+
+        Iterator begin() const noexcept
+        {
+            return Iterator(m_pauRow, m_pauRow ? 0 : uWords);
+        }
+
+        Iterator end() const noexcept
+        {
+            return Iterator(m_pauRow, uWords);
+        }
+
+        bool bIsEmpty() const noexcept
+        {
+            return begin() == end();
+        }
+
+        uint32_t uCount() const noexcept
+        {
+            uint32_t uRet = 0;
+            for (uint32_t uIndex = 0; m_pauRow && (uIndex < uWords); uIndex++)
+            {
+                uRet += uWordBitCount(m_pauRow[uIndex]);
+            }
+            return uRet;
+        }
+
+    private :
+        const uint64_t* m_pauRow;
+};
+
+//
+//  Per-value counters that can be bumped from many threads. The counts are
+//  spread over a set of shards, each on its own cache lines, and each thread
+//  is assigned a shard round robin the first time it counts. So threads don't
+//  bounce the same lines around (unless there are more threads than shards.)
+//  Increment() is the hot path, Snapshot() sums the shards and is meant to be
+//  called occasionally.
+//
+constexpr uint32_t c_uCacheLineSize = 64;
+
+inline uint32_t uCounterShard() noexcept
+{
+    static std::atomic<uint32_t> s_uNextShard(0);
+    thread_local const uint32_t t_uShard = s_uNextShard.fetch_add(1, std::memory_order_relaxed);
+    return t_uShard;
+}
+
+template <typename E, uint32_t uShards = 16> class EnumCounters
+{
+    public :
+        static_assert(uShards > 0, "Enum counters must have at least one shard");
+
+        static constexpr uint32_t c_uCount = EnumValueList<E>::c_uCount;
+        static constexpr uint32_t c_uShards = uShards;
+
+        using CountList = std::array<uint64_t, c_uCount>;
+
+        EnumCounters() noexcept = default;
+
+        EnumCounters(const EnumCounters&) = delete;
+        EnumCounters& operator=(const EnumCounters&) = delete;
+
+        // Invalid values are ignored
+        void Increment(const E eVal, const uint64_t uBy = 1) noexcept
+        {
+            const uint32_t uIndex = uEnumToIndex(eVal);
+            if (uIndex < c_uCount)
+            {
+                m_ashardList[uCounterShard() % uShards].auCounts[uIndex].fetch_add
+                (
+                    uBy, std::memory_order_relaxed
+                );
+            }
+        }
+
+        // The counts of all values, by dense index
+        CountList Snapshot() const noexcept
+        {
+            CountList auRet = {};
+            for (const Shard& shardCur : m_ashardList)
+            {
+                for (uint32_t uIndex = 0; uIndex < c_uCount; uIndex++)
+                {
+                    auRet[uIndex] += shardCur.auCounts[uIndex].load(std::memory_order_relaxed);
+                }
+            }
+            return auRet;
+        }
+
+        uint64_t uValue(const E eVal) const noexcept
+        {
+            uint64_t uRet = 0;
+            const uint32_t uIndex = uEnumToIndex(eVal);
+            if (uIndex < c_uCount)
+            {
+                for (const Shard& shardCur : m_ashardList)
+                {
+                    uRet += shardCur.auCounts[uIndex].load(std::memory_order_relaxed);
+                }
+            }
+            return uRet;
+        }
+
+        // Not atomic wrt to concurrent increments, which may or may not be kept
+        void Reset() noexcept
+        {
+            for (Shard& shardCur : m_ashardList)
+            {
+                for (std::atomic<uint64_t>& uCur : shardCur.auCounts)
+                {
+                    uCur.store(0, std::memory_order_relaxed);
+                }
+            }
+        }
+
+    private :
+        struct alignas(c_uCacheLineSize) Shard
+        {
+            std::atomic<uint64_t>   auCounts[c_uCount] = {};
+        };
+
+        Shard   m_ashardList[uShards];
+};
+
+//
+//  A table with a lazily created entry per value, for caching something that is
+//  expensive to create, by dense index. Each slot is created once, on first use,
+//  by the init function passed to Get(). Each slot has its own state, so first
+//  uses of different values don't hold each other up, and once a slot is ready
+//  reading it is just an acquire load, with no locks.
+//
+//  If two threads ask for the same new slot, one creates it and the other waits
+//  for it. If the init function throws, the slot is left empty, and the next
+//  access will try again.
+//
+template <typename E, typename T> class LazyEnumTable
+{
+    public :
+        static constexpr uint32_t c_uCount = EnumValueList<E>::c_uCount;
+
+        LazyEnumTable() noexcept = default;
+
+        LazyEnumTable(const LazyEnumTable&) = delete;
+        LazyEnumTable& operator=(const LazyEnumTable&) = delete;
+
+        ~LazyEnumTable()
+        {
+            for (Slot& slotCur : m_aslotList)
+            {
+                if (slotCur.uState.load(std::memory_order_relaxed) == c_uReady)
+                {
+                    slotCur.pValue()->~T();
+                }
+            }
+        }
+
+        // The init function is called with the value if it accepts it, else no parameters
+        template <typename F> const T& Get(const E eVal, F&& fnInit)
+        {
+            Slot& slotTar = slotFor(eVal);
+            if (slotTar.uState.load(std::memory_order_acquire) != c_uReady)
+            {
+                Create(slotTar, eVal, std::forward<F>(fnInit));
+            }
+            return *slotTar.pValue();
+        }
+
+        // Returns null if the slot for the value has not been created yet
+        const T* pFind(const E eVal) const noexcept
+        {
+            const uint32_t uIndex = uEnumToIndex(eVal);
+            if ((uIndex >= c_uCount)
+            ||  (m_aslotList[uIndex].uState.load(std::memory_order_acquire) != c_uReady))
+            {
+                return nullptr;
+            }
+            return m_aslotList[uIndex].pValue();
+        }
+
+        bool bIsReady(const E eVal) const noexcept
+        {
+            return pFind(eVal) != nullptr;
+        }
+
+    private :
+        static constexpr uint8_t c_uEmpty = 0;
+        static constexpr uint8_t c_uBusy = 1;
+        static constexpr uint8_t c_uReady = 2;
+
+        struct Slot
+        {
+            T* pValue() noexcept { return std::launder(reinterpret_cast<T*>(abStorage)); }
+            const T* pValue() const noexcept { return std::launder(reinterpret_cast<const T*>(abStorage)); }
+
+            std::atomic<uint8_t>            uState{ c_uEmpty };
+            alignas(T) unsigned char        abStorage[sizeof(T)];
+        };
+
+        Slot& slotFor(const E eVal)
+        {
+            const uint32_t uIndex = uEnumToIndex(eVal);
+            if (uIndex >= c_uCount)
+            {
+                throw std::runtime_error("An invalid enum value was passed to a lazy enum table");
+            }
+            return m_aslotList[uIndex];
+        }
+
+        template <typename F> static void Create(Slot& slotTar, const E eVal, F&& fnInit)
+        {
+            while (true)
+            {
+                uint8_t uState = c_uEmpty;
+                if (slotTar.uState.compare_exchange_strong(uState, c_uBusy, std::memory_order_acquire))
+                {
+                    try
+                    {
+                        if constexpr (std::is_invocable_v<F&, E>)
+                        {
+                            new (slotTar.abStorage) T(fnInit(eVal));
+                        }
+                        else
+                        {
+                            new (slotTar.abStorage) T(fnInit());
+                        }
+                    }
+
+                    catch(...)
+                    {
+                        slotTar.uState.store(c_uEmpty, std::memory_order_release);
+                        NotifyAll(slotTar);
+                        throw;
+                    }
+                    slotTar.uState.store(c_uReady, std::memory_order_release);
+                    NotifyAll(slotTar);
+                    return;
+                }
+
+                // If it's ready, we are done, else someone else is creating it, so wait
+                if (uState == c_uReady)
+                {
+                    return;
+                }
+#if defined(__cpp_lib_atomic_wait)
+                slotTar.uState.wait(c_uBusy, std::memory_order_acquire);
+#else
+                while (slotTar.uState.load(std::memory_order_acquire) == c_uBusy)
+                {
+                    std::this_thread::yield();
+                }
+#endif
+                if (slotTar.uState.load(std::memory_order_acquire) == c_uReady)
+                {
+                    return;
+                }
+            }
+        }
+
+        static void NotifyAll(Slot& slotTar) noexcept
+        {
+#if defined(__cpp_lib_atomic_wait)
+            slotTar.uState.notify_all();
+#else
+            (void)slotTar;
+#endif
+        }
+
+        Slot    m_aslotList[c_uCount];
+};
+
+//
+//  Helpers for bucketing lists of things by an enum key, e.g. records with an
+//  enum field. The key function gets the enum value from an item, and the item
+//  type can just be the enum itself, in which case the key function can be left
+//  out. Since the dense index and value count are known, these are linear, a
+//  counting pass and a placement pass, instead of comparison sorts.
+//
+//  If asked for more than one thread, each pass is split into chunks done on
+//  separate threads, each with its own counts, so the results are the same, i.e.
+//  stable. Lists too small to be worth it are done on the calling thread. The key
+//  function, and copying or moving the items, must not throw on the other threads
+//  in that case. On the calling thread, or if a thread can't be created, it just
+//  passes on the exception.
+//
+//  Items with invalid values go into an extra bucket at the end.
+//
+struct EnumIdentity
+{
+    template <typename E> constexpr E operator()(const E eVal) const noexcept
+    {
+        return eVal;
+    }
+};
+
+template <typename E> using EnumCountList = std::array<size_t, EnumValueList<E>::c_uCount + 1>;
+
+//
+//  The bucket of a value, by dense index, with invalid values in the extra one at
+//  the end. The generated uEnumToIndex() returns the count for those, but we clip
+//  it here too, since an out of range index would write past the counts.
+//
+template <typename E> constexpr uint32_t uBucketIndex(const E eVal) noexcept
+{
+    return std::min(uEnumToIndex(eVal), EnumValueList<E>::c_uCount);
+}
+
+// The start of each value's run of items in a bucketed list, by dense index
+template <typename E> struct EnumBuckets
+{
+    static constexpr uint32_t c_uCount = EnumValueList<E>::c_uCount;
+
+    // Invalid values get the bucket of invalid values
+    size_t szStart(const E eVal) const noexcept
+    {
+        return aszStarts[uBucketIndex(eVal)];
+    }
+
+    size_t szCount(const E eVal) const noexcept
+    {
+        const uint32_t uIndex = uBucketIndex(eVal);
+        return aszStarts[uIndex + 1] - aszStarts[uIndex];
+    }
+
+    size_t szInvalidCount() const noexcept
+    {
+        return aszStarts[c_uCount + 1] - aszStarts[c_uCount];
+    }
+
+    // Then the start of the invalid values, then the end
+    std::array<size_t, c_uCount + 2> aszStarts;
+};
+
+// The minimum items per thread when bucketing on multiple threads
+constexpr size_t c_szMinBucketChunk = 16384;
+
+inline uint32_t uBucketChunks(const size_t szCount, const uint32_t uThreads) noexcept
+{
+    const size_t szMaxChunks = std::max(szCount / c_szMinBucketChunk, size_t(1));
+    return static_cast<uint32_t>(std::min(static_cast<size_t>(std::max(uThreads, 1U)), szMaxChunks));
+}
+
+//
+//  Call the chunk function for each chunk of the list, with the extra ones on other
+//  threads. If a thread can't be created, or our own chunk throws, we join the ones
+//  already started before passing the exception on, since destroying a joinable
+//  thread would terminate the program.
+//
+template <typename F> void RunBucketChunks(const size_t szCount, const uint32_t uChunks, F&& fnChunk)
+{
+    if (uChunks == 1)
+    {
+        fnChunk(0, size_t(0), szCount);
+        return;
+    }
+
+    std::vector<std::thread> vThreads;
+    try
+    {
+        vThreads.reserve(uChunks - 1);
+        for (uint32_t uChunk = 1; uChunk < uChunks; uChunk++)
+        {
+            vThreads.emplace_back
+            (
+                [&fnChunk, uChunk, szCount, uChunks]()
+                {
+                    fnChunk(uChunk, (szCount * uChunk) / uChunks, (szCount * (uChunk + 1)) / uChunks);
+                }
+            );
+        }
+        fnChunk(0, size_t(0), szCount / uChunks);
+    }
+
+    catch(...)
+    {
+        for (std::thread& thrCur : vThreads)
+        {
+            thrCur.join();
+        }
+        throw;
+    }
+
+    for (std::thread& thrCur : vThreads)
+    {
+        thrCur.join();
+    }
+}
+
+//
+//  The core of the bucketing. It counts each chunk's items per value, then turns
+//  those into where each chunk's items of each value go, and calls the place
+//  function with the target and source indices of each item.
+//
+template <typename E, typename It, typename KF, typename PF>
+EnumBuckets<E> BucketItems(const It itBegin, const size_t szCount, KF& fnKey, PF&& fnPlace, const uint32_t uThreads)
+{
+    constexpr uint32_t c_uCount = EnumValueList<E>::c_uCount;
+    const uint32_t uChunks = uBucketChunks(szCount, uThreads);
+    std::vector<EnumCountList<E>> vCounts(uChunks);
+    RunBucketChunks
+    (
+        szCount
+        , uChunks
+        , [&](const uint32_t uChunk, const size_t szFrom, const size_t szTo)
+          {
+              EnumCountList<E>& aszCounts = vCounts[uChunk];
+              for (size_t szIndex = szFrom; szIndex < szTo; szIndex++)
+              {
+                  aszCounts[uBucketIndex(fnKey(itBegin[szIndex]))]++;
+              }
+          }
+    );
+
+    EnumBuckets<E> bktsRet;
+    size_t szAt = 0;
+    for (uint32_t uIndex = 0; uIndex <= c_uCount; uIndex++)
+    {
+        bktsRet.aszStarts[uIndex] = szAt;
+        for (EnumCountList<E>& aszCounts : vCounts)
+        {
+            const size_t szCur = aszCounts[uIndex];
+            aszCounts[uIndex] = szAt;
+            szAt += szCur;
+        }
+    }
+    bktsRet.aszStarts[c_uCount + 1] = szAt;
+
+    RunBucketChunks
+    (
+        szCount
+        , uChunks
+        , [&](const uint32_t uChunk, const size_t szFrom, const size_t szTo)
+          {
+              EnumCountList<E>& aszAts = vCounts[uChunk];
+              for (size_t szIndex = szFrom; szIndex < szTo; szIndex++)
+              {
+                  fnPlace(aszAts[uBucketIndex(fnKey(itBegin[szIndex]))]++, szIndex);
+              }
+          }
+    );
+    return bktsRet;
+}
+
+template <typename It, typename KF> using BucketKeyType = std::decay_t
+<
+    std::invoke_result_t<KF&, typename std::iterator_traits<It>::reference>
+>;
+
+// Count the items per value, by dense index, with invalid values in the extra last slot
+template <typename It, typename KF = EnumIdentity, typename E = BucketKeyType<It, KF>>
+EnumCountList<E> EnumHistogram(const It itBegin, const It itEnd, KF fnKey = KF(), const uint32_t uThreads = 1)
+{
+    const size_t szCount = static_cast<size_t>(itEnd - itBegin);
+    const uint32_t uChunks = uBucketChunks(szCount, uThreads);
+    std::vector<EnumCountList<E>> vCounts(uChunks);
+    RunBucketChunks
+    (
+        szCount
+        , uChunks
+        , [&](const uint32_t uChunk, const size_t szFrom, const size_t szTo)
+          {
+              EnumCountList<E>& aszCounts = vCounts[uChunk];
+              for (size_t szIndex = szFrom; szIndex < szTo; szIndex++)
+              {
+                  aszCounts[uBucketIndex(fnKey(itBegin[szIndex]))]++;
+              }
+          }
+    );
+
+    EnumCountList<E> aszRet = {};
+    for (const EnumCountList<E>& aszCounts : vCounts)
+    {
+        for (size_t szIndex = 0; szIndex < aszRet.size(); szIndex++)
+        {
+            aszRet[szIndex] += aszCounts[szIndex];
+        }
+    }
+    return aszRet;
+}
+
+//
+//  Copy the items to the output list, which must be as big, in the order of their
+//  values, keeping the items of each value in their original order.
+//
+template <typename It, typename ItOut, typename KF = EnumIdentity, typename E = BucketKeyType<It, KF>>
+EnumBuckets<E> EnumCountingSort(const It itBegin
+                                , const It itEnd
+                                , const ItOut itOut
+                                , KF fnKey = KF()
+                                , const uint32_t uThreads = 1)
+{
+    return BucketItems<E>
+    (
+        itBegin
+        , static_cast<size_t>(itEnd - itBegin)
+        , fnKey
+        , [itBegin, itOut](const size_t szTar, const size_t szSrc) { itOut[szTar] = itBegin[szSrc]; }
+        , uThreads
+    );
+}
+
+//
+//  The indices of the items, grouped by their values, in the original order within
+//  each group. The items themselves are not moved.
+//
+template <typename E> struct EnumGroups
+{
+    ValueRange<size_t> Group(const E eVal) const noexcept
+    {
+        const size_t* const pszFirst = vIndices.data() + bktsGroups.szStart(eVal);
+        return ValueRange<size_t>{ pszFirst, pszFirst + bktsGroups.szCount(eVal) };
+    }
+
+    EnumBuckets<E>      bktsGroups;
+    std::vector<size_t> vIndices;
+};
+
+template <typename It, typename KF = EnumIdentity, typename E = BucketKeyType<It, KF>>
+EnumGroups<E> EnumGroupBy(const It itBegin, const It itEnd, KF fnKey = KF(), const uint32_t uThreads = 1)
+{
+    EnumGroups<E> grpsRet;
+    grpsRet.vIndices.resize(static_cast<size_t>(itEnd - itBegin));
+    size_t* const pszIndices = grpsRet.vIndices.data();
+    grpsRet.bktsGroups = BucketItems<E>
+    (
+        itBegin
+        , grpsRet.vIndices.size()
+        , fnKey
+        , [pszIndices](const size_t szTar, const size_t szSrc) { pszIndices[szTar] = szSrc; }
+        , uThreads
+    );
+    return grpsRet;
+}
+
+// Reorder the items in place by value, keeping the items of each value in order
+template <typename It, typename KF = EnumIdentity, typename E = BucketKeyType<It, KF>>
+EnumBuckets<E> EnumPartition(const It itBegin, const It itEnd, KF fnKey = KF(), const uint32_t uThreads = 1)
+{
+    using ItemType = typename std::iterator_traits<It>::value_type;
+
+    EnumGroups<E> grpsOrder = EnumGroupBy(itBegin, itEnd, fnKey, uThreads);
+    std::vector<ItemType> vTmp;
+    vTmp.reserve(grpsOrder.vIndices.size());
+    for (const size_t szIndex : grpsOrder.vIndices)
+    {
+        vTmp.push_back(std::move(itBegin[szIndex]));
+    }
+    std::move(vTmp.begin(), vTmp.end(), itBegin);
+    return grpsOrder.bktsGroups;
+}
+
+//
+//  Columnar storage of enum values, e.g. a field of millions of rows. The values
+//  are stored as their dense indices, in the smallest unsigned type that holds
+//  them, so usually one byte per row. Filters return a bitmap with a bit per row
+//  (64 rows per word), and histograms are counts by dense index.
+//
+//  For byte sized columns, equality filters, group filters (for enums of up to 16
+//  values) and histograms (for up to 16 values) work a vector at a time where the
+//  target supports it. Otherwise they are simple loops over the indices.
+//
+template <typename E> class EnumColumn
+{
+    public :
+        static constexpr uint32_t c_uCount = EnumValueList<E>::c_uCount;
+
+        using IndexType = std::conditional_t
+        <
+            (c_uCount <= 0x100)
+            , uint8_t
+            , std::conditional_t<(c_uCount <= 0x10000), uint16_t, uint32_t>
+        >;
+        using CountList = std::array<size_t, c_uCount>;
+        using RowBitmap = std::vector<uint64_t>;
+
+        EnumColumn() = default;
+
+        // Count the rows on in a row bitmap
+        static size_t szRowCount(const RowBitmap& bmpRows) noexcept
+        {
+            size_t szRet = 0;
+            for (const uint64_t uCur : bmpRows)
+            {
+                szRet += uWordBitCount(uCur);
+            }
+            return szRet;
+        }
+
+        // Invalid values are rejected, since they can't be stored as an index
+        void Append(const E eVal)
+        {
+            m_vIndices.push_back(uToIndex(eVal));
+        }
+
+        void Set(const size_t szRow, const E eVal)
+        {
+            m_vIndices.at(szRow) = uToIndex(eVal);
+        }
+
+        E operator[](const size_t szRow) const noexcept
+        {
+            return EnumValueList<E>::s_aeValues[m_vIndices[szRow]];
+        }
+
+        void Clear() noexcept
+        {
+            m_vIndices.clear();
+        }
+
+        void Reserve(const size_t szRows)
+        {
+            m_vIndices.reserve(szRows);
+        }
+
+        size_t szRows() const noexcept
+        {
+            return m_vIndices.size();
+        }
+
+        // The raw dense indices
+        const IndexType* pIndices() const noexcept
+        {
+            return m_vIndices.data();
+        }
+
+        // The rows that have the value. An invalid value matches no rows
+        RowBitmap FilterEq(const E eVal) const
+        {
+            RowBitmap bmpRet((m_vIndices.size() + 63) / 64, 0);
+            const uint32_t uTarget = uEnumToIndex(eVal);
+            if (uTarget >= c_uCount)
+            {
+                return bmpRet;
+            }
+
+            size_t szRow = 0;
+            if constexpr (sizeof(IndexType) == 1)
+            {
+                szRow = szFilterEqBytes(static_cast<uint8_t>(uTarget), bmpRet.data());
+            }
+            for (; szRow < m_vIndices.size(); szRow++)
+            {
+                bmpRet[szRow / 64] |= uint64_t(m_vIndices[szRow] == uTarget) << (szRow % 64);
+            }
+            return bmpRet;
+        }
+
+        //
+        //  The rows whose values are in a group, as a bitmap over dense indices, such
+        //  as the ones generated for Group= definitions.
+        //
+        RowBitmap FilterIn(const uint64_t* const pauGroup) const
+        {
+            RowBitmap bmpRet((m_vIndices.size() + 63) / 64, 0);
+            size_t szRow = 0;
+            if constexpr ((sizeof(IndexType) == 1) && (c_uCount <= 16))
+            {
+                szRow = szFilterInBytes(pauGroup[0], bmpRet.data());
+            }
+
+            std::array<uint8_t, c_uCount> auInGroup;
+            for (uint32_t uIndex = 0; uIndex < c_uCount; uIndex++)
+            {
+                auInGroup[uIndex] = static_cast<uint8_t>((pauGroup[uIndex / 64] >> (uIndex % 64)) & 1);
+            }
+            for (; szRow < m_vIndices.size(); szRow++)
+            {
+                bmpRet[szRow / 64] |= uint64_t(auInGroup[m_vIndices[szRow]]) << (szRow % 64);
+            }
+            return bmpRet;
+        }
+
+        RowBitmap FilterIn(const std::initializer_list<E> listVals) const
+        {
+            std::array<uint64_t, (c_uCount + 63) / 64> auGroup = {};
+            for (const E eCur : listVals)
+            {
+                const uint32_t uIndex = uEnumToIndex(eCur);
+                if (uIndex < c_uCount)
+                {
+                    auGroup[uIndex / 64] |= 1ULL << (uIndex % 64);
+                }
+            }
+            return FilterIn(auGroup.data());
+        }
+
+        // The count of rows per value, by dense index
+        CountList Histogram() const noexcept
+        {
+            CountList aszRet = {};
+            size_t szRow = 0;
+            if constexpr ((sizeof(IndexType) == 1) && (c_uCount <= 16))
+            {
+                szRow = szHistogramBytes(aszRet);
+            }
+
+            // Spread over a few sets of counts, so that runs of a value don't stall
+            std::array<CountList, 4> aaszParts = {};
+            for (; szRow + 4 <= m_vIndices.size(); szRow += 4)
+            {
+                aaszParts[0][m_vIndices[szRow]]++;
+                aaszParts[1][m_vIndices[szRow + 1]]++;
+                aaszParts[2][m_vIndices[szRow + 2]]++;
+                aaszParts[3][m_vIndices[szRow + 3]]++;
+            }
+            for (; szRow < m_vIndices.size(); szRow++)
+            {
+                aaszParts[0][m_vIndices[szRow]]++;
+            }
+            for (uint32_t uIndex = 0; uIndex < c_uCount; uIndex++)
+            {
+                aszRet[uIndex] += aaszParts[0][uIndex] + aaszParts[1][uIndex]
+                                  + aaszParts[2][uIndex] + aaszParts[3][uIndex];
+            }
+            return aszRet;
+        }
+
+        // A row bitmap per value, by dense index, built in one pass
+        std::array<RowBitmap, c_uCount> Postings() const
+        {
+            std::array<RowBitmap, c_uCount> abmpRet;
+            for (RowBitmap& bmpCur : abmpRet)
+            {
+                bmpCur.resize((m_vIndices.size() + 63) / 64, 0);
+            }
+            for (size_t szRow = 0; szRow < m_vIndices.size(); szRow++)
+            {
+                abmpRet[m_vIndices[szRow]][szRow / 64] |= 1ULL << (szRow % 64);
+            }
+            return abmpRet;
+        }
+
+    private :
+        static IndexType uToIndex(const E eVal)
+        {
+            const uint32_t uIndex = uEnumToIndex(eVal);
+            if (uIndex >= c_uCount)
+            {
+                throw std::runtime_error("An invalid enum value cannot be stored in an enum column");
+            }
+            return static_cast<IndexType>(uIndex);
+        }
+
+        // These do as many whole words of rows as they can, and return the next row
+        size_t szFilterEqBytes(const uint8_t uTarget, uint64_t* const pauOut) const noexcept
+        {
+            size_t szRow = 0;
+            const uint8_t* const pabData = reinterpret_cast<const uint8_t*>(m_vIndices.data());
+#if defined(__AVX2__)
+            const __m256i vecTarget = _mm256_set1_epi8(static_cast<char>(uTarget));
+            for (; szRow + 64 <= m_vIndices.size(); szRow += 64)
+            {
+                const __m256i vecLow = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pabData + szRow));
+                const __m256i vecHigh = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pabData + szRow + 32));
+                pauOut[szRow / 64] = uint64_t(uint32_t(_mm256_movemask_epi8(_mm256_cmpeq_epi8(vecLow, vecTarget))))
+                                     | (uint64_t(uint32_t(_mm256_movemask_epi8(_mm256_cmpeq_epi8(vecHigh, vecTarget)))) << 32);
+            }
+#elif defined(CQENUM_SIMD_SSE2)
+            const __m128i vecTarget = _mm_set1_epi8(static_cast<char>(uTarget));
+            for (; szRow + 64 <= m_vIndices.size(); szRow += 64)
+            {
+                uint64_t uWord = 0;
+                for (uint32_t uPart = 0; uPart < 4; uPart++)
+                {
+                    const __m128i vecCur = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pabData + szRow + (uPart * 16)));
+                    uWord |= uint64_t(uint16_t(_mm_movemask_epi8(_mm_cmpeq_epi8(vecCur, vecTarget)))) << (uPart * 16);
+                }
+                pauOut[szRow / 64] = uWord;
+            }
+#else
+            (void)uTarget;
+            (void)pabData;
+            (void)pauOut;
+#endif
+            return szRow;
+        }
+
+        //
+        //  With up to 16 values, the indices can be used to shuffle a vector with
+        //  0xFF in the bytes for the group members, to look them all up at once.
+        //
+        size_t szFilterInBytes(const uint64_t uGroup, uint64_t* const pauOut) const noexcept
+        {
+            size_t szRow = 0;
+#if defined(__AVX2__) || defined(__SSSE3__)
+            const uint8_t* const pabData = reinterpret_cast<const uint8_t*>(m_vIndices.data());
+            alignas(16) uint8_t abLookup[16] = {};
+            for (uint32_t uIndex = 0; uIndex < c_uCount; uIndex++)
+            {
+                abLookup[uIndex] = ((uGroup >> uIndex) & 1) ? 0xFF : 0;
+            }
+            const __m128i vecLookup = _mm_load_si128(reinterpret_cast<const __m128i*>(abLookup));
+            for (; szRow + 64 <= m_vIndices.size(); szRow += 64)
+            {
+                uint64_t uWord = 0;
+                for (uint32_t uPart = 0; uPart < 4; uPart++)
+                {
+                    const __m128i vecCur = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pabData + szRow + (uPart * 16)));
+                    uWord |= uint64_t(uint16_t(_mm_movemask_epi8(_mm_shuffle_epi8(vecLookup, vecCur)))) << (uPart * 16);
+                }
+                pauOut[szRow / 64] = uWord;
+            }
+#else
+            (void)uGroup;
+            (void)pauOut;
+#endif
+            return szRow;
+        }
+
+        //
+        //  With up to 16 values, compare each vector of indices against each value,
+        //  subtracting the all ones matches from byte counters, which are added up
+        //  before they can overflow.
+        //
+        size_t szHistogramBytes(CountList& aszCounts) const noexcept
+        {
+            size_t szRow = 0;
+#if defined(CQENUM_SIMD_SSE2)
+            const uint8_t* const pabData = reinterpret_cast<const uint8_t*>(m_vIndices.data());
+            const __m128i vecZero = _mm_setzero_si128();
+            __m128i avecValues[c_uCount];
+            __m128i avecSums[c_uCount];
+            for (uint32_t uIndex = 0; uIndex < c_uCount; uIndex++)
+            {
+                avecValues[uIndex] = _mm_set1_epi8(static_cast<char>(uIndex));
+                avecSums[uIndex] = vecZero;
+            }
+
+            while (szRow + 16 <= m_vIndices.size())
+            {
+                __m128i avecBytes[c_uCount];
+                for (uint32_t uIndex = 0; uIndex < c_uCount; uIndex++)
+                {
+                    avecBytes[uIndex] = vecZero;
+                }
+
+                for (uint32_t uBlock = 0; (uBlock < 255) && (szRow + 16 <= m_vIndices.size()); uBlock++, szRow += 16)
+                {
+                    const __m128i vecCur = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pabData + szRow));
+                    for (uint32_t uIndex = 0; uIndex < c_uCount; uIndex++)
+                    {
+                        avecBytes[uIndex] = _mm_sub_epi8(avecBytes[uIndex], _mm_cmpeq_epi8(vecCur, avecValues[uIndex]));
+                    }
+                }
+
+                for (uint32_t uIndex = 0; uIndex < c_uCount; uIndex++)
+                {
+                    avecSums[uIndex] = _mm_add_epi64(avecSums[uIndex], _mm_sad_epu8(avecBytes[uIndex], vecZero));
+                }
+            }
+
+            for (uint32_t uIndex = 0; uIndex < c_uCount; uIndex++)
+            {
+                alignas(16) uint64_t auHalves[2];
+                _mm_store_si128(reinterpret_cast<__m128i*>(auHalves), avecSums[uIndex]);
+                aszCounts[uIndex] += static_cast<size_t>(auHalves[0] + auHalves[1]);
+            }
+#else
+            (void)aszCounts;
+#endif
+            return szRow;
+        }
+
+        std::vector<IndexType>  m_vIndices;
+};
+
+//
+//  A lock free atomic wrapper for Bitmap enums, so that flags shared between
+//  threads can be updated with single RMW operations and still be typed. The
+//  generator creates an [enumname]AtomicFlags alias for each Bitmap enum. The
+//  wait/notify methods use the C++20 atomic waits if available, else wait just
+//  polls and yields and the notifies do nothing.
+//
+template <typename E> class AtomicFlags
+{
+    public :
+        using UnderType = std::underlying_type_t<E>;
+        static_assert(std::atomic<UnderType>::is_always_lock_free, "The underlying type must be lock free");
+
+        constexpr AtomicFlags() noexcept : m_uBits(0) {}
+        constexpr explicit AtomicFlags(const E eInit) noexcept : m_uBits(static_cast<UnderType>(eInit)) {}
+
+        AtomicFlags(const AtomicFlags&) = delete;
+        AtomicFlags& operator=(const AtomicFlags&) = delete;
+
+        E load(const std::memory_order eOrder = std::memory_order_seq_cst) const noexcept
+        {
+            return static_cast<E>(m_uBits.load(eOrder));
+        }
+
+        void store(const E eBits, const std::memory_order eOrder = std::memory_order_seq_cst) noexcept
+        {
+            m_uBits.store(static_cast<UnderType>(eBits), eOrder);
+        }
+
+        E exchange(const E eBits, const std::memory_order eOrder = std::memory_order_seq_cst) noexcept
+        {
+            return static_cast<E>(m_uBits.exchange(static_cast<UnderType>(eBits), eOrder));
+        }
+
+        bool compare_exchange_strong(       E&                  eExpected
+                                    , const E                   eNew
+                                    , const std::memory_order   eOrder = std::memory_order_seq_cst) noexcept
+        {
+            UnderType uExpected = static_cast<UnderType>(eExpected);
+            const bool bRet = m_uBits.compare_exchange_strong(uExpected, static_cast<UnderType>(eNew), eOrder);
+            eExpected = static_cast<E>(uExpected);
+            return bRet;
+        }
+
+        // Turn on/off the indicated bits, returning the previous value
+        E fetch_set(const E eBits, const std::memory_order eOrder = std::memory_order_seq_cst) noexcept
+        {
+            return static_cast<E>(m_uBits.fetch_or(static_cast<UnderType>(eBits), eOrder));
+        }
+
+        E fetch_clear(const E eBits, const std::memory_order eOrder = std::memory_order_seq_cst) noexcept
+        {
+            return static_cast<E>(m_uBits.fetch_and(static_cast<UnderType>(~static_cast<UnderType>(eBits)), eOrder));
+        }
+
+        E fetch_toggle(const E eBits, const std::memory_order eOrder = std::memory_order_seq_cst) noexcept
+        {
+            return static_cast<E>(m_uBits.fetch_xor(static_cast<UnderType>(eBits), eOrder));
+        }
+
+        //
+        //  Turn on the indicated bits, and return true if any of them were already
+        //  on. So, for a single bit, false means this caller is the one that set it.
+        //
+        bool test_and_set(const E eBits, const std::memory_order eOrder = std::memory_order_seq_cst) noexcept
+        {
+            const UnderType uBits = static_cast<UnderType>(eBits);
+            return (m_uBits.fetch_or(uBits, eOrder) & uBits) != 0;
+        }
+
+        bool bAllOn(const E eBits, const std::memory_order eOrder = std::memory_order_seq_cst) const noexcept
+        {
+            const UnderType uBits = static_cast<UnderType>(eBits);
+            return (m_uBits.load(eOrder) & uBits) == uBits;
+        }
+
+        bool bAnyOn(const E eBits, const std::memory_order eOrder = std::memory_order_seq_cst) const noexcept
+        {
+            return (m_uBits.load(eOrder) & static_cast<UnderType>(eBits)) != 0;
+        }
+
+        // Block until the value is no longer eOld
+        void wait(const E eOld, const std::memory_order eOrder = std::memory_order_seq_cst) const noexcept
+        {
+#if defined(__cpp_lib_atomic_wait)
+            m_uBits.wait(static_cast<UnderType>(eOld), eOrder);
+#else
+            while (m_uBits.load(eOrder) == static_cast<UnderType>(eOld))
+            {
+                std::this_thread::yield();
+            }
+#endif
+        }
+
+        void notify_one() noexcept
+        {
+#if defined(__cpp_lib_atomic_wait)
+            m_uBits.notify_one();
+#endif
+        }
+
+        void notify_all() noexcept
+        {
+#if defined(__cpp_lib_atomic_wait)
+            m_uBits.notify_all();
+#endif
+        }
+
+    private :
+        std::atomic<UnderType>  m_uBits;
+};
+
+//
+//  Enums with the Aliases flag get one of these, which holds extra names that
+//  bNameToEnum() will accept, and which can be set at runtime (e.g. loaded from
+//  config.) The static names are always checked first, so this is only hit on
+//  a miss. Aliases are case insensitive, like the names.
+//
+//  Lookups are wait free. The aliases are in an immutable, sorted snapshot,
+//  and updates build a new one and swap it in. Readers bump a counter for the
+//  current epoch around their use of the snapshot, and the updater flips the
+//  epoch and waits for the previous epoch's readers to drain, twice, before it
+//  frees the old snapshot. Updates are serialized, and only they ever wait.
+//
+template <typename E> class AliasRegistry
+{
+    public :
+        using AliasList = std::vector<std::pair<std::wstring, E>>;
+
+        constexpr AliasRegistry() noexcept = default;
+
+        AliasRegistry(const AliasRegistry&) = delete;
+        AliasRegistry& operator=(const AliasRegistry&) = delete;
+
+        ~AliasRegistry()
+        {
+            delete m_psnapCur.load();
+        }
+
+        bool bFind(const std::wstring_view& svName, E& eToFill) const noexcept
+        {
+            // Don't bother if there are no aliases, the usual case
+            if (!m_psnapCur.load(std::memory_order_acquire))
+            {
+                return false;
+            }
+
+            Readers& rdrsCur = m_ardrsEpochs[m_uEpoch.load() & 1];
+            rdrsCur.uCount.fetch_add(1);
+
+            bool bRet = false;
+            const Snapshot* const psnapCur = m_psnapCur.load();
+            if (psnapCur)
+            {
+                typename AliasList::const_iterator itFind = std::lower_bound
+                (
+                    psnapCur->listAliases.begin()
+                    , psnapCur->listAliases.end()
+                    , svName
+                    , [](const std::pair<std::wstring, E>& pairCur, const std::wstring_view& svFind)
+                      { return iCompareAlias(pairCur.first, svFind) < 0; }
+                );
+                if ((itFind != psnapCur->listAliases.end()) && !iCompareAlias(itFind->first, svName))
+                {
+                    eToFill = itFind->second;
+                    bRet = true;
+                }
+            }
+
+            rdrsCur.uCount.fetch_sub(1, std::memory_order_release);
+            return bRet;
+        }
+
+        uint32_t uCount() const noexcept
+        {
+            std::lock_guard<std::mutex> lockUpdate(m_mtxUpdate);
+            const Snapshot* const psnapCur = m_psnapCur.load();
+            return psnapCur ? static_cast<uint32_t>(psnapCur->listAliases.size()) : 0;
+        }
+
+        // Add or update one alias
+        void AddAlias(const std::wstring_view& svName, const E eVal)
+        {
+            std::lock_guard<std::mutex> lockUpdate(m_mtxUpdate);
+            const Snapshot* const psnapCur = m_psnapCur.load();
+            AliasList listNew;
+            if (psnapCur)
+            {
+                listNew = psnapCur->listAliases;
+            }
+            listNew.emplace_back(std::wstring(svName), eVal);
+            Replace(psnapMake(std::move(listNew)));
+        }
+
+        void Clear()
+        {
+            std::lock_guard<std::mutex> lockUpdate(m_mtxUpdate);
+            Replace(nullptr);
+        }
+
+        // Replace all of the aliases. If a name is in the list more than once, the last one wins
+        void SetAliases(AliasList listNew)
+        {
+            Snapshot* const psnapNew = listNew.empty() ? nullptr : psnapMake(std::move(listNew));
+            std::lock_guard<std::mutex> lockUpdate(m_mtxUpdate);
+            Replace(psnapNew);
+        }
+
+    private :
+        struct Snapshot
+        {
+            AliasList   listAliases;
+        };
+
+        struct alignas(c_uCacheLineSize) Readers
+        {
+            std::atomic<uint32_t>   uCount{0};
+        };
+
+        // Case insensitive compare, names are ASCII identifiers so we just fold a-z
+        static int iCompareAlias(const std::wstring_view& svLHS, const std::wstring_view& svRHS) noexcept
+        {
+            const size_t szCount = (svLHS.size() < svRHS.size()) ? svLHS.size() : svRHS.size();
+            for (size_t szIndex = 0; szIndex < szCount; szIndex++)
+            {
+                const wchar_t chLHS = ((svLHS[szIndex] >= L'a') && (svLHS[szIndex] <= L'z'))
+                                      ? static_cast<wchar_t>(svLHS[szIndex] - 0x20) : svLHS[szIndex];
+                const wchar_t chRHS = ((svRHS[szIndex] >= L'a') && (svRHS[szIndex] <= L'z'))
+                                      ? static_cast<wchar_t>(svRHS[szIndex] - 0x20) : svRHS[szIndex];
+                if (chLHS != chRHS)
+                {
+                    return (chLHS < chRHS) ? -1 : 1;
+                }
+            }
+            if (svLHS.size() == svRHS.size())
+            {
+                return 0;
+            }
+            return (svLHS.size() < svRHS.size()) ? -1 : 1;
+        }
+
+        // Sort the list, keeping only the last of any duplicates
+        static Snapshot* psnapMake(AliasList&& listNew)
+        {
+            std::stable_sort
+            (
+                listNew.begin()
+                , listNew.end()
+                , [](const std::pair<std::wstring, E>& pairLHS, const std::pair<std::wstring, E>& pairRHS)
+                  { return iCompareAlias(pairLHS.first, pairRHS.first) < 0; }
+            );
+
+            Snapshot* psnapRet = new Snapshot;
+            for (std::pair<std::wstring, E>& pairCur : listNew)
+            {
+                if (!psnapRet->listAliases.empty()
+                &&  !iCompareAlias(psnapRet->listAliases.back().first, pairCur.first))
+                {
+                    psnapRet->listAliases.back() = std::move(pairCur);
+                }
+                else
+                {
+                    psnapRet->listAliases.push_back(std::move(pairCur));
+                }
+            }
+            return psnapRet;
+        }
+
+        // The caller must have the update lock
+        void Replace(Snapshot* const psnapNew)
+        {
+            Snapshot* const psnapOld = m_psnapCur.exchange(psnapNew);
+            if (!psnapOld)
+            {
+                return;
+            }
+
+            //
+            //  A reader can have read the epoch just before a flip and then count
+            //  itself in the old one, so we have to drain both of them.
+            //
+            for (uint32_t uPass = 0; uPass < 2; uPass++)
+            {
+                const uint32_t uOldEpoch = m_uEpoch.fetch_add(1) & 1;
+                while (m_ardrsEpochs[uOldEpoch].uCount.load() != 0)
+                {
+                    std::this_thread::yield();
+                }
+            }
+            delete psnapOld;
+        }
+
+        mutable Readers             m_ardrsEpochs[2];
+        mutable std::mutex          m_mtxUpdate;
+        std::atomic<Snapshot*>      m_psnapCur{nullptr};
+        std::atomic<uint32_t>       m_uEpoch{0};
+};
+
+//
+//  Optional instrumentation of the generated lookups. If CQENUM_INSTRUMENT is
+//  defined when building, each lookup counts its calls, misses, and probes (the
+//  number of table entries looked at) in thread local counters, so there is no
+//  contention on the hot path. The counters of running threads and of threads
+//  that have exited are summed by lcntsLookupTotals() and DumpLookupStats().
+//  If not defined, the CQENUM_LOOKUP() calls in the lookups compile to nothing.
+//
+#if defined(CQENUM_INSTRUMENT)
+
+enum class ELookups : uint32_t
+{
+    AltValToEnum, EnumToAltVal, EnumToName, EnumToText1, EnumToText2, IsValid, NameToEnum
+
+    , Count
+};
+
+inline const char* pszLookupName(const ELookups eLookup) noexcept
+{
+    constexpr const char* const apszNames[] =
+    {
+        "AltValToEnum", "EnumToAltVal", "EnumToName", "EnumToText1", "EnumToText2", "IsValid", "NameToEnum"
+    };
+    return (eLookup < ELookups::Count) ? apszNames[static_cast<uint32_t>(eLookup)] : "???";
+}
+
+struct LookupCounts
+{
+    uint64_t    uCalls = 0;
+    uint64_t    uMisses = 0;
+    uint64_t    uProbes = 0;
+};
+
+constexpr uint32_t c_uLookupCount = static_cast<uint32_t>(ELookups::Count);
+
+//
+//  A thread's counters for one enum. Only the owning thread writes them, so the
+//  bumps are relaxed load/store, not RMW. They register themselves with the
+//  registry below on creation, and fold their counts into it on thread exit.
+//
+class LookupCounters
+{
+    public :
+        explicit LookupCounters(const char* const pszEnum);
+        ~LookupCounters();
+
+        LookupCounters(const LookupCounters&) = delete;
+        LookupCounters& operator=(const LookupCounters&) = delete;
+
+        void Bump(const uint32_t uLookup, const bool bHit, const uint32_t uProbes) noexcept
+        {
+            m_auCalls[uLookup].store(m_auCalls[uLookup].load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            if (!bHit)
+            {
+                m_auMisses[uLookup].store(m_auMisses[uLookup].load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            }
+            m_auProbes[uLookup].store(m_auProbes[uLookup].load(std::memory_order_relaxed) + uProbes, std::memory_order_relaxed);
+        }
+
+        void AddTo(const uint32_t uLookup, LookupCounts& lcntsToFill) const noexcept
+        {
+            lcntsToFill.uCalls += m_auCalls[uLookup].load(std::memory_order_relaxed);
+            lcntsToFill.uMisses += m_auMisses[uLookup].load(std::memory_order_relaxed);
+            lcntsToFill.uProbes += m_auProbes[uLookup].load(std::memory_order_relaxed);
+        }
+
+        const char*             m_pszEnum;
+        LookupCounters*         m_plcntrsNext = nullptr;
+
+    private :
+        std::atomic<uint64_t>   m_auCalls[c_uLookupCount] = {};
+        std::atomic<uint64_t>   m_auMisses[c_uLookupCount] = {};
+        std::atomic<uint64_t>   m_auProbes[c_uLookupCount] = {};
+};
+
+class LookupRegistry
+{
+    public :
+        using CountList = std::array<LookupCounts, c_uLookupCount>;
+
+        static LookupRegistry& lregInstance()
+        {
+            static LookupRegistry s_lregInstance;
+            return s_lregInstance;
+        }
+
+        void Add(LookupCounters* const plcntrsAdd)
+        {
+            std::lock_guard<std::mutex> lockList(m_mtxList);
+            plcntrsAdd->m_plcntrsNext = m_plcntrsHead;
+            m_plcntrsHead = plcntrsAdd;
+        }
+
+        void Remove(LookupCounters* const plcntrsRem)
+        {
+            std::lock_guard<std::mutex> lockList(m_mtxList);
+            LookupCounters** pplcntrsCur = &m_plcntrsHead;
+            while (*pplcntrsCur && (*pplcntrsCur != plcntrsRem))
+            {
+                pplcntrsCur = &(*pplcntrsCur)->m_plcntrsNext;
+            }
+            if (*pplcntrsCur)
+            {
+                *pplcntrsCur = plcntrsRem->m_plcntrsNext;
+            }
+
+            CountList& alcntsRetired = alcntsFindRetired(plcntrsRem->m_pszEnum);
+            for (uint32_t uIndex = 0; uIndex < c_uLookupCount; uIndex++)
+            {
+                plcntrsRem->AddTo(uIndex, alcntsRetired[uIndex]);
+            }
+        }
+
+        // Get the counts for all enums, by enum name
+        std::vector<std::pair<std::string, CountList>> vTotals()
+        {
+            std::lock_guard<std::mutex> lockList(m_mtxList);
+            std::vector<std::pair<std::string, CountList>> vRet = m_vRetired;
+            for (const LookupCounters* plcntrsCur = m_plcntrsHead; plcntrsCur; plcntrsCur = plcntrsCur->m_plcntrsNext)
+            {
+                std::vector<std::pair<std::string, CountList>>::iterator itEnum = std::find_if
+                (
+                    vRet.begin()
+                    , vRet.end()
+                    , [plcntrsCur](const std::pair<std::string, CountList>& pairCur)
+                      { return pairCur.first == plcntrsCur->m_pszEnum; }
+                );
+                if (itEnum == vRet.end())
+                {
+                    itEnum = vRet.insert(vRet.end(), std::make_pair(std::string(plcntrsCur->m_pszEnum), CountList()));
+                }
+                for (uint32_t uIndex = 0; uIndex < c_uLookupCount; uIndex++)
+                {
+                    plcntrsCur->AddTo(uIndex, itEnum->second[uIndex]);
+                }
+            }
+            return vRet;
+        }
+
+    private :
+        CountList& alcntsFindRetired(const char* const pszEnum)
+        {
+            for (std::pair<std::string, CountList>& pairCur : m_vRetired)
+            {
+                if (pairCur.first == pszEnum)
+                {
+                    return pairCur.second;
+                }
+            }
+            m_vRetired.emplace_back(std::string(pszEnum), CountList());
+            return m_vRetired.back().second;
+        }
+
+        std::mutex                                      m_mtxList;
+        LookupCounters*                                 m_plcntrsHead = nullptr;
+        std::vector<std::pair<std::string, CountList>>  m_vRetired;
+};
+
+inline LookupCounters::LookupCounters(const char* const pszEnum) :
+
+    m_pszEnum(pszEnum)
+{
+    LookupRegistry::lregInstance().Add(this);
+}
+
+inline LookupCounters::~LookupCounters()
+{
+    LookupRegistry::lregInstance().Remove(this);
+}
+
+// Called by the generated lookups, each enum gets its own thread local counters
+template <typename E>
+inline void RecordLookup(   const   char* const pszEnum
+                            , const ELookups    eLookup
+                            , const bool        bHit
+                            , const uint32_t    uProbes)
+{
+    thread_local LookupCounters t_lcntrsEnum(pszEnum);
+    t_lcntrsEnum.Bump(static_cast<uint32_t>(eLookup), bHit, uProbes);
+}
+
+// The totals for one lookup of an enum, by its namespace qualified name
+inline LookupCounts lcntsLookupTotals(const char* const pszEnum, const ELookups eLookup)
+{
+    for (const std::pair<std::string, LookupRegistry::CountList>& pairCur : LookupRegistry::lregInstance().vTotals())
+    {
+        if (pairCur.first == pszEnum)
+        {
+            return pairCur.second[static_cast<uint32_t>(eLookup)];
+        }
+    }
+    return LookupCounts();
+}
+
+// Format out the lookups that have been called, one per line
+inline void DumpLookupStats(std::ostream& strmTar)
+{
+    for (const std::pair<std::string, LookupRegistry::CountList>& pairCur : LookupRegistry::lregInstance().vTotals())
+    {
+        for (uint32_t uIndex = 0; uIndex < c_uLookupCount; uIndex++)
+        {
+            const LookupCounts& lcntsCur = pairCur.second[uIndex];
+            if (lcntsCur.uCalls)
+            {
+                strmTar << pairCur.first << "::" << pszLookupName(static_cast<ELookups>(uIndex))
+                        << " Calls=" << lcntsCur.uCalls << " Misses=" << lcntsCur.uMisses
+                        << " AvgProbes=" << (static_cast<double>(lcntsCur.uProbes) / lcntsCur.uCalls)
+                        << "\n";
+            }
+        }
+    }
+}
+
+#define CQENUM_LOOKUP(E, Lookup, bHit, uProbes) \
+    CQSL::CQEnum::RecordLookup<E>(#E, CQSL::CQEnum::ELookups::Lookup, bHit, uProbes)
+
+#else
+
+#define CQENUM_LOOKUP(E, Lookup, bHit, uProbes)
+
+#endif
+
+//
+//  Jump table dispatch on enum values. EnumVisit() takes a handler per value,
+//  in the order defined, and passing the wrong number of them is a compile
+//  error, so adding a value breaks any visits that don't handle it. A handler
+//  is called with a std::integral_constant of its value if it accepts one, else
+//  with no parameters. They should all return the type the first one does.
+//
+//  The dispatch is one indexed indirect call, through the dense index for
+//  sparse enums. An invalid value goes to a last slot that throws.
+//
+template <typename E, size_t uIndex> using EnumConst = std::integral_constant
+<
+    E, EnumValueList<E>::s_aeValues[uIndex]
+>;
+
+template <typename E, size_t uIndex, typename H> struct VisitResult
+{
+    using Type = typename std::conditional_t
+    <
+        std::is_invocable_v<H&, EnumConst<E, uIndex>>
+        , std::invoke_result<H&, EnumConst<E, uIndex>>
+        , std::invoke_result<H&>
+    >::type;
+};
+
+template <typename E, typename R, size_t uIndex, typename HT> R VisitOne(HT& tupHandlers)
+{
+    auto& hndlrCur = std::get<uIndex>(tupHandlers);
+    if constexpr (std::is_invocable_v<decltype(hndlrCur), EnumConst<E, uIndex>>)
+    {
+        return hndlrCur(EnumConst<E, uIndex>());
+    }
+    else
+    {
+        return hndlrCur();
+    }
+}
+
+template <typename E, typename R, typename HT> [[noreturn]] R VisitBadValue(HT&)
+{
+    throw std::runtime_error("An invalid enum value was passed to EnumVisit");
+}
+
+template <typename E, typename R, typename HT, size_t... auIndices>
+R VisitIndex(const uint32_t uIndex, HT& tupHandlers, std::index_sequence<auIndices...>)
+{
+    using PFnHandler = R (*)(HT&);
+    static constexpr PFnHandler apfnTable[] =
+    {
+        &VisitOne<E, R, auIndices, HT>..., &VisitBadValue<E, R, HT>
+    };
+    constexpr uint32_t c_uCount = static_cast<uint32_t>(sizeof...(auIndices));
+    return apfnTable[(uIndex < c_uCount) ? uIndex : c_uCount](tupHandlers);
+}
+
+template <typename E, typename... Handlers>
+decltype(auto) EnumVisit(const E eVal, Handlers&&... handlers)
+{
+    static_assert
+    (
+        sizeof...(Handlers) == EnumValueList<E>::c_uCount
+        , "EnumVisit requires a handler for every value of the enum"
+    );
+
+    using HT = std::tuple<Handlers&...>;
+    using R = typename VisitResult<E, 0, std::tuple_element_t<0, std::tuple<Handlers...>>>::Type;
+    HT tupHandlers(handlers...);
+    return VisitIndex<E, R, HT>
+    (
+        uEnumToIndex(eVal), tupHandlers, std::make_index_sequence<sizeof...(Handlers)>()
+    );
+}
+
+//
+//  Support for enums whose values have payload types. The generator creates an
+//  alias of this for each such enum, with a payload type per value, in the order
+//  defined, using NoPayload for values that don't have one. The payload is stored
+//  inline, and the enum value is the discriminant. Copy, move, destruction and
+//  Visit() go through tables indexed by the dense index of the current value, so
+//  there are no virtual calls or heap allocations.
+//
+//  A default constructed one holds the first value, with a default constructed
+//  payload. Payload types have to be no throw movable.
+//
+struct NoPayload {};
+
+template <typename E, typename... Payloads> class TaggedUnion
+{
+    public :
+        static constexpr uint32_t c_uCount = EnumValueList<E>::c_uCount;
+        static_assert
+        (
+            sizeof...(Payloads) == c_uCount
+            , "A tagged union needs a payload type for every value of the enum"
+        );
+        static_assert
+        (
+            (std::is_nothrow_move_constructible_v<Payloads> && ...)
+            , "Tagged union payload types must be no throw movable"
+        );
+
+        template <E eVal> using PayloadType = std::tuple_element_t
+        <
+            uEnumToIndex(eVal), std::tuple<Payloads...>
+        >;
+
+        // Create one with the indicated value, constructing its payload in place
+        template <E eVal, typename... Args> static TaggedUnion Make(Args&&... args)
+        {
+            return TaggedUnion(std::integral_constant<E, eVal>(), std::forward<Args>(args)...);
+        }
+
+        TaggedUnion() :
+
+            m_eTag(EnumValueList<E>::s_aeValues[0])
+        {
+            new (m_abStorage) PayloadAt<0>();
+        }
+
+        TaggedUnion(const TaggedUnion& tuSrc) :
+
+            m_eTag(tuSrc.m_eTag)
+        {
+            CopyFrom(tuSrc, std::make_index_sequence<c_uCount>());
+        }
+
+        TaggedUnion(TaggedUnion&& tuSrc) noexcept :
+
+            m_eTag(tuSrc.m_eTag)
+        {
+            MoveFrom(tuSrc, std::make_index_sequence<c_uCount>());
+        }
+
+        ~TaggedUnion()
+        {
+            Destroy(std::make_index_sequence<c_uCount>());
+        }
+
+        // Copy first, so that we are unchanged if the payload's copy throws
+        TaggedUnion& operator=(const TaggedUnion& tuSrc)
+        {
+            if (&tuSrc != this)
+            {
+                TaggedUnion tuTmp(tuSrc);
+                *this = std::move(tuTmp);
+            }
+            return *this;
+        }
+
+        TaggedUnion& operator=(TaggedUnion&& tuSrc) noexcept
+        {
+            if (&tuSrc != this)
+            {
+                Destroy(std::make_index_sequence<c_uCount>());
+                m_eTag = tuSrc.m_eTag;
+                MoveFrom(tuSrc, std::make_index_sequence<c_uCount>());
+            }
+            return *this;
+        }
+
+        E eTag() const noexcept
+        {
+            return m_eTag;
+        }
+
+        template <E eVal> bool bIs() const noexcept
+        {
+            return m_eTag == eVal;
+        }
+
+        // Get the payload if it is the current value, else throws
+        template <E eVal> PayloadType<eVal>& Get()
+        {
+            CheckTag(eVal);
+            return *std::launder(reinterpret_cast<PayloadType<eVal>*>(m_abStorage));
+        }
+
+        template <E eVal> const PayloadType<eVal>& Get() const
+        {
+            CheckTag(eVal);
+            return *std::launder(reinterpret_cast<const PayloadType<eVal>*>(m_abStorage));
+        }
+
+        // Get the payload if it is the current value, else null
+        template <E eVal> PayloadType<eVal>* pGet() noexcept
+        {
+            return (m_eTag == eVal) ? std::launder(reinterpret_cast<PayloadType<eVal>*>(m_abStorage)) : nullptr;
+        }
+
+        template <E eVal> const PayloadType<eVal>* pGet() const noexcept
+        {
+            return (m_eTag == eVal)
+                   ? std::launder(reinterpret_cast<const PayloadType<eVal>*>(m_abStorage)) : nullptr;
+        }
+
+        //
+        //  Change to the indicated value, constructing its payload in place. If the
+        //  payload's constructor can throw, we build it first and move it in, so
+        //  that we are unchanged if it does.
+        //
+        template <E eVal, typename... Args> PayloadType<eVal>& Set(Args&&... args)
+        {
+            using NewType = PayloadType<eVal>;
+            if constexpr (std::is_nothrow_constructible_v<NewType, Args...>)
+            {
+                Destroy(std::make_index_sequence<c_uCount>());
+                m_eTag = eVal;
+                new (m_abStorage) NewType(std::forward<Args>(args)...);
+            }
+            else
+            {
+                NewType ptNew(std::forward<Args>(args)...);
+                Destroy(std::make_index_sequence<c_uCount>());
+                m_eTag = eVal;
+                new (m_abStorage) NewType(std::move(ptNew));
+            }
+            return *std::launder(reinterpret_cast<NewType*>(m_abStorage));
+        }
+
+        //
+        //  Like EnumVisit(), it takes a handler per value, in the order defined. A
+        //  handler is called with the payload if it accepts it, else with no
+        //  parameters.
+        //
+        template <typename... Handlers> decltype(auto) Visit(Handlers&&... handlers)
+        {
+            return VisitImpl<unsigned char>(m_abStorage, std::forward<Handlers>(handlers)...);
+        }
+
+        template <typename... Handlers> decltype(auto) Visit(Handlers&&... handlers) const
+        {
+            return VisitImpl<const unsigned char>(m_abStorage, std::forward<Handlers>(handlers)...);
+        }
+
+    private :
+        template <size_t uIndex> using PayloadAt = std::tuple_element_t<uIndex, std::tuple<Payloads...>>;
+
+        using PFnCopy = void (*)(unsigned char*, const unsigned char*);
+        using PFnMove = void (*)(unsigned char*, unsigned char*);
+        using PFnDestroy = void (*)(unsigned char*);
+
+        template <E eVal, typename... Args>
+        explicit TaggedUnion(std::integral_constant<E, eVal>, Args&&... args) :
+
+            m_eTag(eVal)
+        {
+            new (m_abStorage) PayloadType<eVal>(std::forward<Args>(args)...);
+        }
+
+        void CheckTag(const E eVal) const
+        {
+            if (m_eTag != eVal)
+            {
+                throw std::runtime_error("The tagged union does not hold the requested value");
+            }
+        }
+
+        template <size_t uIndex> static void CopyOne(unsigned char* const pabTar, const unsigned char* const pabSrc)
+        {
+            new (pabTar) PayloadAt<uIndex>(*std::launder(reinterpret_cast<const PayloadAt<uIndex>*>(pabSrc)));
+        }
+
+        template <size_t uIndex> static void MoveOne(unsigned char* const pabTar, unsigned char* const pabSrc)
+        {
+            new (pabTar) PayloadAt<uIndex>(std::move(*std::launder(reinterpret_cast<PayloadAt<uIndex>*>(pabSrc))));
+        }
+
+        template <size_t uIndex> static void DestroyOne(unsigned char* const pabTar)
+        {
+            std::launder(reinterpret_cast<PayloadAt<uIndex>*>(pabTar))->~PayloadAt<uIndex>();
+        }
+
+        template <size_t... auIndices>
+        void CopyFrom(const TaggedUnion& tuSrc, std::index_sequence<auIndices...>)
+        {
+            static constexpr PFnCopy apfnTable[] = { &CopyOne<auIndices>... };
+            apfnTable[uEnumToIndex(m_eTag)](m_abStorage, tuSrc.m_abStorage);
+        }
+
+        template <size_t... auIndices>
+        void MoveFrom(TaggedUnion& tuSrc, std::index_sequence<auIndices...>) noexcept
+        {
+            static constexpr PFnMove apfnTable[] = { &MoveOne<auIndices>... };
+            apfnTable[uEnumToIndex(m_eTag)](m_abStorage, tuSrc.m_abStorage);
+        }
+
+        template <size_t... auIndices> void Destroy(std::index_sequence<auIndices...>) noexcept
+        {
+            static constexpr PFnDestroy apfnTable[] = { &DestroyOne<auIndices>... };
+            apfnTable[uEnumToIndex(m_eTag)](m_abStorage);
+        }
+
+        template <typename R, size_t uIndex, typename S, typename HT>
+        static R VisitOne(S* const pabStorage, HT& tupHandlers)
+        {
+            using ParamType = std::conditional_t<std::is_const_v<S>, const PayloadAt<uIndex>, PayloadAt<uIndex>>;
+            auto& hndlrCur = std::get<uIndex>(tupHandlers);
+            if constexpr (std::is_invocable_v<decltype(hndlrCur), ParamType&>)
+            {
+                return hndlrCur(*std::launder(reinterpret_cast<ParamType*>(pabStorage)));
+            }
+            else
+            {
+                return hndlrCur();
+            }
+        }
+
+        template <typename R, typename S, typename HT, size_t... auIndices>
+        R VisitIndex(S* const pabStorage, HT& tupHandlers, std::index_sequence<auIndices...>) const
+        {
+            using PFnHandler = R (*)(S*, HT&);
+            static constexpr PFnHandler apfnTable[] = { &VisitOne<R, auIndices, S, HT>... };
+            return apfnTable[uEnumToIndex(m_eTag)](pabStorage, tupHandlers);
+        }
+
+        template <typename S, typename... Handlers>
+        decltype(auto) VisitImpl(S* const pabStorage, Handlers&&... handlers) const
+        {
+            static_assert
+            (
+                sizeof...(Handlers) == c_uCount
+                , "Visit requires a handler for every value of the enum"
+            );
+
+            using HT = std::tuple<Handlers&...>;
+            using FirstType = std::tuple_element_t<0, std::tuple<Handlers...>>;
+            using ParamType = std::conditional_t<std::is_const_v<S>, const PayloadAt<0>, PayloadAt<0>>;
+            using R = typename std::conditional_t
+            <
+                std::is_invocable_v<FirstType&, ParamType&>
+                , std::invoke_result<FirstType&, ParamType&>
+                , std::invoke_result<FirstType&>
+            >::type;
+
+            HT tupHandlers(handlers...);
+            return VisitIndex<R>(pabStorage, tupHandlers, std::make_index_sequence<c_uCount>());
+        }
+
+        E   m_eTag;
+        alignas(Payloads...) unsigned char m_abStorage[std::max({ sizeof(Payloads)... })];
+};
+
+//
+//  The forms of input that the generated EnumFromChars() methods will accept.
+//  If both ordinals and alt values are enabled, a number is checked as an
+//  ordinal first. Alt values are ignored for enums that don't define them.
+//
+enum class EFromChars : uint32_t
+{
+    Names           = 0x0001
+    , Ordinals      = 0x0002
+    , AltVals       = 0x0004
+
+    , NamesAndOrdinals = 0x0003
+    , All           = 0x0007
+};
+
+constexpr EFromChars operator|(const EFromChars eLHS, const EFromChars eRHS) noexcept
+{
+    return static_cast<EFromChars>(static_cast<uint32_t>(eLHS) | static_cast<uint32_t>(eRHS));
+}
+
+constexpr bool bFromCharsRule(const EFromChars eRules, const EFromChars eTest) noexcept
+{
+    return (static_cast<uint32_t>(eRules) & static_cast<uint32_t>(eTest)) != 0;
+}
+
+//
+//  Support for incremental and prefix matching of value names. The generator
+//  builds a trie of each enum's names (case insensitive, ASCII upper cased) and
+//  specializes NameTrie for it. The names are sorted, so the names below any
+//  node are a contiguous range of the sorted name list.
+//
+enum class ENameMatch { Match, NoMatch, NeedMore };
+
+struct NameTrieEdge
+{
+    char        chUpper;
+    uint32_t    uTarget;
+};
+
+struct NameTrieNode
+{
+    uint32_t    uFirstEdge;
+    uint32_t    uEdgeCount;
+
+    // The range of sorted names that start with the text that leads to this node
+    uint32_t    uFirstName;
+    uint32_t    uEndName;
+
+    // If a name ends at this node, its sorted name index, else uNoName
+    uint32_t    uNameIndex;
+};
+
+constexpr uint32_t c_uTrieNoName = 0xFFFFFFFF;
+
+template <typename E> struct NameTrie;
+
+constexpr char chTrieUpper(const char chSrc) noexcept
+{
+    return ((chSrc >= 'a') && (chSrc <= 'z')) ? static_cast<char>(chSrc - 0x20) : chSrc;
+}
+
+// Returns the node reached from uNode on the character, or c_uTrieNoName
+template <typename E>
+constexpr uint32_t uTrieStep(const uint32_t uNode, const char chNext) noexcept
+{
+    const char chUpper = chTrieUpper(chNext);
+    const NameTrieNode& nodeCur = NameTrie<E>::s_anodeTable[uNode];
+    for (uint32_t uIndex = 0; uIndex < nodeCur.uEdgeCount; uIndex++)
+    {
+        const NameTrieEdge& edgeCur = NameTrie<E>::s_aedgeTable[nodeCur.uFirstEdge + uIndex];
+        if (edgeCur.chUpper == chUpper)
+        {
+            return edgeCur.uTarget;
+        }
+        if (edgeCur.chUpper > chUpper)
+        {
+            break;
+        }
+    }
+    return c_uTrieNoName;
+}
+
+// A range of values, in name order
+template <typename E> using NameRange = ValueRange<E>;
+
+// Get the values (in name order) whose names start with the prefix
+template <typename E>
+constexpr NameRange<E> PrefixRange(const std::string_view& svPrefix) noexcept
+{
+    uint32_t uNode = 0;
+    for (const char chCur : svPrefix)
+    {
+        uNode = uTrieStep<E>(uNode, chCur);
+        if (uNode == c_uTrieNoName)
+        {
+            return NameRange<E>{ NameTrie<E>::s_aeByName, NameTrie<E>::s_aeByName };
+        }
+    }
+    const NameTrieNode& nodeEnd = NameTrie<E>::s_anodeTable[uNode];
+    return NameRange<E>
+    {
+        NameTrie<E>::s_aeByName + nodeEnd.uFirstName, NameTrie<E>::s_aeByName + nodeEnd.uEndName
+    };
+}
+
+//
+//  Matches a name that arrives in chunks. Each chunk is fed in and it reports
+//  a match, no match, or that it needs more input. A match is reported as soon
+//  as a name is complete and no other, longer, name starts with it. Otherwise the
+//  first character that can't continue a name ends it, or call eEnd() if the input
+//  is done. In either case, szUsed indicates how much of the chunk was consumed,
+//  so the caller can continue from there.
+//
+template <typename E> class NameMatcher
+{
+    public :
+        constexpr NameMatcher() noexcept = default;
+
+        ENameMatch eEnd() noexcept
+        {
+            if (m_eState == ENameMatch::NeedMore)
+            {
+                m_eState = (NameTrie<E>::s_anodeTable[m_uNode].uNameIndex == c_uTrieNoName)
+                           ? ENameMatch::NoMatch : ENameMatch::Match;
+            }
+            return m_eState;
+        }
+
+        ENameMatch eFeed(const char* const pchChunk, const size_t szLen, size_t& szUsed) noexcept
+        {
+            szUsed = 0;
+            while ((m_eState == ENameMatch::NeedMore) && (szUsed < szLen))
+            {
+                const uint32_t uNext = uTrieStep<E>(m_uNode, pchChunk[szUsed]);
+                if (uNext == c_uTrieNoName)
+                {
+                    // This char ends it, and isn't consumed
+                    return eEnd();
+                }
+
+                m_uNode = uNext;
+                szUsed++;
+
+                const NameTrieNode& nodeCur = NameTrie<E>::s_anodeTable[m_uNode];
+                if ((nodeCur.uNameIndex != c_uTrieNoName) && !nodeCur.uEdgeCount)
+                {
+                    m_eState = ENameMatch::Match;
+                }
+            }
+            return m_eState;
+        }
+
+        // Only valid once a match has been reported
+        E eMatch() const noexcept
+        {
+            return NameTrie<E>::s_aeByName[NameTrie<E>::s_anodeTable[m_uNode].uNameIndex];
+        }
+
+        // The values whose names start with what has been fed so far
+        NameRange<E> rangeCandidates() const noexcept
+        {
+            if (m_eState == ENameMatch::NoMatch)
+            {
+                return NameRange<E>{ NameTrie<E>::s_aeByName, NameTrie<E>::s_aeByName };
+            }
+            const NameTrieNode& nodeCur = NameTrie<E>::s_anodeTable[m_uNode];
+            return NameRange<E>
+            {
+                NameTrie<E>::s_aeByName + nodeCur.uFirstName
+                , NameTrie<E>::s_aeByName + nodeCur.uEndName
+            };
+        }
+
+        void Reset() noexcept
+        {
+            m_uNode = 0;
+            m_eState = ENameMatch::NeedMore;
+        }
+
+    private :
+        uint32_t    m_uNode = 0;
+        ENameMatch  m_eState = ENameMatch::NeedMore;
+};
+//
+//  Bulk remapping of persisted ordinals through a generated [enum]Remap table,
+//  which is indexed by the old ordinal and has the new one. Old values outside
+//  of the table, or whose entry is the removed marker, get the bad value, and we
+//  return how many did. The source and target can be the same. 4 byte values are
+//  done 8 at a time with AVX2 gathers, and 1 byte values 16 at a time with a
+//  byte shuffle if the table has 16 or fewer entries.
+//
+template <typename T>
+size_t szRemapValues(const  T* const    patSrc
+                    , const size_t      szCount
+                    ,       T* const    patTar
+                    , const T* const    patTable
+                    , const uint32_t    uTableSize
+                    , const T           tRemoved
+                    , const T           tBad) noexcept
+{
+    static_assert(std::is_integral_v<T>, "Remapping is only for integral ordinals");
+
+    size_t szBad = 0;
+    size_t szIndex = 0;
+#if defined(__AVX2__)
+    if constexpr (sizeof(T) == 4)
+    {
+        if (uTableSize)
+        {
+            // Unsigned min against the last index tells us if it's in range
+            const __m256i vecLast = _mm256_set1_epi32(static_cast<int32_t>(uTableSize - 1));
+            const __m256i vecRemoved = _mm256_set1_epi32(static_cast<int32_t>(tRemoved));
+            const __m256i vecBad = _mm256_set1_epi32(static_cast<int32_t>(tBad));
+            for (; szIndex + 8 <= szCount; szIndex += 8)
+            {
+                const __m256i vecOld = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(patSrc + szIndex));
+                const __m256i vecIn = _mm256_cmpeq_epi32(_mm256_min_epu32(vecOld, vecLast), vecOld);
+                const __m256i vecNew = _mm256_mask_i32gather_epi32
+                (
+                    vecBad, reinterpret_cast<const int*>(patTable), vecOld, vecIn, 4
+                );
+                const __m256i vecGone = _mm256_or_si256
+                (
+                    _mm256_andnot_si256(vecIn, _mm256_set1_epi32(-1))
+                    , _mm256_cmpeq_epi32(vecNew, vecRemoved)
+                );
+                _mm256_storeu_si256
+                (
+                    reinterpret_cast<__m256i*>(patTar + szIndex), _mm256_blendv_epi8(vecNew, vecBad, vecGone)
+                );
+                szBad += uWordBitCount(uint32_t(_mm256_movemask_ps(_mm256_castsi256_ps(vecGone))));
+            }
+        }
+    }
+#endif
+#if defined(__AVX2__) || defined(__SSSE3__)
+    if constexpr (sizeof(T) == 1)
+    {
+        if (uTableSize && (uTableSize <= 16))
+        {
+            alignas(16) T atLookup[16];
+            for (uint32_t uAt = 0; uAt < 16; uAt++)
+            {
+                atLookup[uAt] = (uAt < uTableSize) ? patTable[uAt] : tRemoved;
+            }
+
+            const __m128i vecLookup = _mm_load_si128(reinterpret_cast<const __m128i*>(atLookup));
+            const __m128i vecLast = _mm_set1_epi8(static_cast<char>(uTableSize - 1));
+            const __m128i vecRemoved = _mm_set1_epi8(static_cast<char>(tRemoved));
+            const __m128i vecBad = _mm_set1_epi8(static_cast<char>(tBad));
+            for (; szIndex + 16 <= szCount; szIndex += 16)
+            {
+                const __m128i vecOld = _mm_loadu_si128(reinterpret_cast<const __m128i*>(patSrc + szIndex));
+                const __m128i vecIn = _mm_cmpeq_epi8(_mm_min_epu8(vecOld, vecLast), vecOld);
+                const __m128i vecNew = _mm_shuffle_epi8(vecLookup, vecOld);
+                const __m128i vecGone = _mm_or_si128
+                (
+                    _mm_andnot_si128(vecIn, _mm_set1_epi8(-1)), _mm_cmpeq_epi8(vecNew, vecRemoved)
+                );
+                _mm_storeu_si128
+                (
+                    reinterpret_cast<__m128i*>(patTar + szIndex)
+                    , _mm_or_si128(_mm_and_si128(vecGone, vecBad), _mm_andnot_si128(vecGone, vecNew))
+                );
+                szBad += uWordBitCount(uint32_t(_mm_movemask_epi8(vecGone)));
+            }
+        }
+    }
+#endif
+    for (; szIndex < szCount; szIndex++)
+    {
+        const T tOld = patSrc[szIndex];
+        T tNew = tRemoved;
+        if (static_cast<uint64_t>(tOld) < uTableSize)
+        {
+            tNew = patTable[static_cast<size_t>(tOld)];
+        }
+
+        if (tNew == tRemoved)
+        {
+            tNew = tBad;
+            szBad++;
+        }
+        patTar[szIndex] = tNew;
+    }
+    return szBad;
+}
+//
+//  Bulk translation of values through a generated table, used for the alt value
+//  conversions. If the keys are close enough together, the table is dense, indexed
+//  by the key minus the lowest one, and unused entries have a marker value that is
+//  not a valid result. Else it has the keys in sorted order, and the results that
+//  go with them, which we binary search.
+//
+template <typename TK, typename TR> struct XlatTable
+{
+    TK          tDenseMin;
+    uint32_t    uDenseSize;
+    const TR*   patDense;
+    TR          tUnused;
+    uint32_t    uSortedCount;
+    const TK*   patSortedKeys;
+    const TR*   patSortedRes;
+};
+
+//
+//  Translate a buffer of keys. Invalid ones get the bad value, and we return how
+//  many there were. If an invalid mask is passed, it must have a bit per key, in
+//  64 bit words, and the bits for the invalid ones are set. When the keys and the
+//  results are both 4 bytes, they are done 8 at a time with AVX2. For a dense table
+//  that's a gather. For a small sorted one we compare against each key, else it is
+//  a branchless binary search of all 8 at once, with gathers.
+//
+template <typename TS, typename TK, typename TR>
+size_t szXlatValues(const   TS* const               patSrc
+                    , const size_t                  szCount
+                    ,       TR* const               patTar
+                    , const XlatTable<TK, TR>&      xtblSrc
+                    , const TR                      tBad
+                    ,       uint64_t* const         pauInvalid) noexcept
+{
+    static_assert(std::is_integral_v<TK>, "Translation keys must be integral");
+
+    if (pauInvalid)
+    {
+        std::fill(pauInvalid, pauInvalid + ((szCount + 63) / 64), uint64_t(0));
+    }
+
+    size_t szBad = 0;
+    size_t szIndex = 0;
+#if defined(__AVX2__)
+    if constexpr ((sizeof(TS) == 4) && (sizeof(TK) == 4) && (sizeof(TR) == 4))
+    {
+        const __m256i vecBad = _mm256_set1_epi32(static_cast<int32_t>(tBad));
+        auto fnStore = [&](const __m256i vecNew, const __m256i vecGone)
+        {
+            _mm256_storeu_si256
+            (
+                reinterpret_cast<__m256i*>(patTar + szIndex), _mm256_blendv_epi8(vecNew, vecBad, vecGone)
+            );
+            const uint32_t uGone = uint32_t(_mm256_movemask_ps(_mm256_castsi256_ps(vecGone)));
+            szBad += uWordBitCount(uGone);
+            if (pauInvalid)
+            {
+                pauInvalid[szIndex / 64] |= uint64_t(uGone) << (szIndex % 64);
+            }
+        };
+
+        if (xtblSrc.uDenseSize)
+        {
+            // Unsigned min against the last index tells us if it's in range
+            const __m256i vecMin = _mm256_set1_epi32(static_cast<int32_t>(xtblSrc.tDenseMin));
+            const __m256i vecLast = _mm256_set1_epi32(static_cast<int32_t>(xtblSrc.uDenseSize - 1));
+            const __m256i vecUnused = _mm256_set1_epi32(static_cast<int32_t>(xtblSrc.tUnused));
+            for (; szIndex + 8 <= szCount; szIndex += 8)
+            {
+                const __m256i vecAt = _mm256_sub_epi32
+                (
+                    _mm256_loadu_si256(reinterpret_cast<const __m256i*>(patSrc + szIndex)), vecMin
+                );
+                const __m256i vecIn = _mm256_cmpeq_epi32(_mm256_min_epu32(vecAt, vecLast), vecAt);
+                const __m256i vecNew = _mm256_mask_i32gather_epi32
+                (
+                    vecBad, reinterpret_cast<const int*>(xtblSrc.patDense), vecAt, vecIn, 4
+                );
+                fnStore
+                (
+                    vecNew
+                    , _mm256_or_si256
+                      (
+                          _mm256_andnot_si256(vecIn, _mm256_set1_epi32(-1))
+                          , _mm256_cmpeq_epi32(vecNew, vecUnused)
+                      )
+                );
+            }
+        }
+        else if (xtblSrc.uSortedCount <= 32)
+        {
+            for (; szIndex + 8 <= szCount; szIndex += 8)
+            {
+                const __m256i vecKey = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(patSrc + szIndex));
+                __m256i vecNew = vecBad;
+                __m256i vecFound = _mm256_setzero_si256();
+                for (uint32_t uAt = 0; uAt < xtblSrc.uSortedCount; uAt++)
+                {
+                    const __m256i vecMatch = _mm256_cmpeq_epi32
+                    (
+                        vecKey, _mm256_set1_epi32(static_cast<int32_t>(xtblSrc.patSortedKeys[uAt]))
+                    );
+                    vecNew = _mm256_blendv_epi8
+                    (
+                        vecNew, _mm256_set1_epi32(static_cast<int32_t>(xtblSrc.patSortedRes[uAt])), vecMatch
+                    );
+                    vecFound = _mm256_or_si256(vecFound, vecMatch);
+                }
+                fnStore(vecNew, _mm256_andnot_si256(vecFound, _mm256_set1_epi32(-1)));
+            }
+        }
+        else
+        {
+            //
+            //  Find the last key that is <= each one, which is the one we want if it
+            //  is there at all. Unsigned keys are flipped to use the signed compare.
+            //
+            const __m256i vecFlip = _mm256_set1_epi32(std::is_signed_v<TK> ? 0 : INT32_MIN);
+            const int* const piKeys = reinterpret_cast<const int*>(xtblSrc.patSortedKeys);
+            for (; szIndex + 8 <= szCount; szIndex += 8)
+            {
+                const __m256i vecKey = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(patSrc + szIndex));
+                const __m256i vecCmpKey = _mm256_xor_si256(vecKey, vecFlip);
+                __m256i vecBase = _mm256_setzero_si256();
+                for (uint32_t uLeft = xtblSrc.uSortedCount; uLeft > 1; )
+                {
+                    const uint32_t uHalf = uLeft / 2;
+                    const __m256i vecHalf = _mm256_set1_epi32(static_cast<int32_t>(uHalf));
+                    const __m256i vecProbe = _mm256_xor_si256
+                    (
+                        _mm256_i32gather_epi32(piKeys, _mm256_add_epi32(vecBase, vecHalf), 4), vecFlip
+                    );
+                    vecBase = _mm256_add_epi32
+                    (
+                        vecBase, _mm256_andnot_si256(_mm256_cmpgt_epi32(vecProbe, vecCmpKey), vecHalf)
+                    );
+                    uLeft -= uHalf;
+                }
+                const __m256i vecFound = _mm256_cmpeq_epi32(_mm256_i32gather_epi32(piKeys, vecBase, 4), vecKey);
+                const __m256i vecNew = _mm256_mask_i32gather_epi32
+                (
+                    vecBad, reinterpret_cast<const int*>(xtblSrc.patSortedRes), vecBase, vecFound, 4
+                );
+                fnStore(vecNew, _mm256_andnot_si256(vecFound, _mm256_set1_epi32(-1)));
+            }
+        }
+    }
+#endif
+    for (; szIndex < szCount; szIndex++)
+    {
+        const TK tKey = static_cast<TK>(patSrc[szIndex]);
+        TR tNew = tBad;
+        bool bFound = false;
+        if (xtblSrc.uDenseSize)
+        {
+            // Wrapping makes keys below the min out of range as well
+            const uint64_t uAt = static_cast<uint64_t>(tKey) - static_cast<uint64_t>(xtblSrc.tDenseMin);
+            if (uAt < xtblSrc.uDenseSize)
+            {
+                tNew = xtblSrc.patDense[uAt];
+                bFound = (tNew != xtblSrc.tUnused);
+            }
+        }
+        else
+        {
+            // Branchless, since invalid and random keys make the branches unpredictable
+            uint32_t uBase = 0;
+            for (uint32_t uLeft = xtblSrc.uSortedCount; uLeft > 1; )
+            {
+                const uint32_t uHalf = uLeft / 2;
+                uBase += (xtblSrc.patSortedKeys[uBase + uHalf] <= tKey) ? uHalf : 0;
+                uLeft -= uHalf;
+            }
+            if (xtblSrc.patSortedKeys[uBase] == tKey)
+            {
+                tNew = xtblSrc.patSortedRes[uBase];
+                bFound = true;
+            }
+        }
+
+        if (!bFound)
+        {
+            tNew = tBad;
+            szBad++;
+            if (pauInvalid)
+            {
+                pauInvalid[szIndex / 64] |= uint64_t(1) << (szIndex % 64);
+            }
+        }
+        patTar[szIndex] = tNew;
+    }
+    return szBad;
+}
+//
+//  The static reflection registry. Each generated cpp file has a constant, type
+//  name sorted list of descriptors for its enums, and puts a pointer to it into
+//  a linker section. The linker gathers those up, so there's nothing done at
+//  startup, and finding an enum by name is a binary search of each file's list.
+//  Values are passed as int64_t so that generic code doesn't need the type. The
+//  text lookups are null if the enum doesn't have them, and they throw for an
+//  invalid value, as the typed ones do.
+//
+//  The registry is per module, so a DLL or shared library only sees its own
+//  enums. If the linker section isn't supported, CQENUM_REGISTRY_SECTION isn't
+//  defined and the registry is just empty.
+//
+struct EnumDescriptor
+{
+    const char*         pszTypeName;
+    EEnumKinds          eKind;
+    uint32_t            uCount;
+    uint64_t            uFingerprint;
+    int64_t             (*pfnValueAt)(uint32_t);
+    const wchar_t*      (*pfnToName)(int64_t);
+    bool                (*pfnFromName)(const std::wstring_view&, int64_t&);
+    bool                (*pfnIsValid)(int64_t);
+    const wchar_t*      (*pfnToText1)(int64_t);
+    const wchar_t*      (*pfnToText2)(int64_t);
+};
+
+struct EnumDescriptorList
+{
+    const EnumDescriptor*   paDescs;
+    uint32_t                uCount;
+};
+
+// The type erased wrappers the descriptors point to
+template <typename E> int64_t iDescValueAt(const uint32_t uIndex)
+{
+    return static_cast<int64_t>(EnumValueList<E>::s_aeValues[uIndex]);
+}
+template <typename E> const wchar_t* pszDescToName(const int64_t iVal)
+{
+    return EnumTraits<E>::pfnToName(static_cast<E>(iVal));
+}
+template <typename E> bool bDescFromName(const std::wstring_view& svName, int64_t& iToFill)
+{
+    E eVal;
+    if (!EnumTraits<E>::pfnFromName(svName, eVal))
+    {
+        return false;
+    }
+    iToFill = static_cast<int64_t>(eVal);
+    return true;
+}
+template <typename E> bool bDescIsValid(const int64_t iVal)
+{
+    return EnumTraits<E>::pfnIsValid(static_cast<E>(iVal));
+}
+template <typename E> const wchar_t* pszDescToText1(const int64_t iVal)
+{
+    return EnumTraits<E>::pfnToText1(static_cast<E>(iVal));
+}
+template <typename E> const wchar_t* pszDescToText2(const int64_t iVal)
+{
+    return EnumTraits<E>::pfnToText2(static_cast<E>(iVal));
+}
+
+#if defined(_MSC_VER)
+#pragma section("cqenum$a", read)
+#pragma section("cqenum$m", read)
+#pragma section("cqenum$z", read)
+#define CQENUM_REGISTRY_SECTION __declspec(allocate("cqenum$m"))
+__declspec(allocate("cqenum$a")) __declspec(selectany) extern const EnumDescriptorList* const pedlRegStart = nullptr;
+__declspec(allocate("cqenum$z")) __declspec(selectany) extern const EnumDescriptorList* const pedlRegEnd = nullptr;
+#elif defined(__APPLE__)
+#define CQENUM_REGISTRY_SECTION __attribute__((used, section("__DATA,cqenum_reg")))
+extern "C" const EnumDescriptorList* const pedlRegStart __asm("section$start$__DATA$cqenum_reg");
+extern "C" const EnumDescriptorList* const pedlRegEnd __asm("section$end$__DATA$cqenum_reg");
+#elif defined(__ELF__)
+#if defined(__has_attribute)
+#if __has_attribute(retain)
+#define CQENUM_REGISTRY_SECTION __attribute__((used, retain, section("cqenum_reg")))
+#endif
+#endif
+#if !defined(CQENUM_REGISTRY_SECTION)
+#define CQENUM_REGISTRY_SECTION __attribute__((used, section("cqenum_reg")))
+#endif
+extern "C" const EnumDescriptorList* const __start_cqenum_reg[] __attribute__((weak));
+extern "C" const EnumDescriptorList* const __stop_cqenum_reg[] __attribute__((weak));
+#endif
+
+//
+//  Call back for each file's list. The MSVC linker can pad the section with zeros,
+//  so we skip nulls.
+//
+template <typename T> void ForEachEnumDescriptorList(T&& fnCallback)
+{
+#if defined(_MSC_VER)
+    const EnumDescriptorList* const* ppedlCur = &pedlRegStart + 1;
+    const EnumDescriptorList* const* const ppedlEnd = &pedlRegEnd;
+#elif defined(__APPLE__)
+    const EnumDescriptorList* const* ppedlCur = &pedlRegStart;
+    const EnumDescriptorList* const* const ppedlEnd = &pedlRegEnd;
+#elif defined(__ELF__)
+    const EnumDescriptorList* const* ppedlCur = __start_cqenum_reg;
+    const EnumDescriptorList* const* const ppedlEnd = __stop_cqenum_reg;
+#else
+    const EnumDescriptorList* const* ppedlCur = nullptr;
+    const EnumDescriptorList* const* const ppedlEnd = nullptr;
+#endif
+    for (; ppedlCur < ppedlEnd; ppedlCur++)
+    {
+        if (*ppedlCur)
+        {
+            fnCallback(**ppedlCur);
+        }
+    }
+}
+
+// Call back for every registered enum
+template <typename T> void ForEachEnumDescriptor(T&& fnCallback)
+{
+    ForEachEnumDescriptorList
+    (
+        [&fnCallback](const EnumDescriptorList& edlCur)
+        {
+            for (uint32_t uIndex = 0; uIndex < edlCur.uCount; uIndex++)
+            {
+                fnCallback(edlCur.paDescs[uIndex]);
+            }
+        }
+    );
+}
+
+// Find an enum by its namespace qualified type name, e.g. "MyNS::EColors"
+inline const EnumDescriptor* pFindEnumDescriptor(const std::string_view& svTypeName)
+{
+    const EnumDescriptor* pedescRet = nullptr;
+    ForEachEnumDescriptorList
+    (
+        [&](const EnumDescriptorList& edlCur)
+        {
+            if (pedescRet)
+            {
+                return;
+            }
+
+            const EnumDescriptor* const pedescEnd = edlCur.paDescs + edlCur.uCount;
+            const EnumDescriptor* const pedescFound = std::lower_bound
+            (
+                edlCur.paDescs
+                , pedescEnd
+                , svTypeName
+                , [](const EnumDescriptor& edescCur, const std::string_view& svFind)
+                  {
+                      return std::string_view(edescCur.pszTypeName) < svFind;
+                  }
+            );
+            if ((pedescFound != pedescEnd) && (svTypeName == pedescFound->pszTypeName))
+            {
+                pedescRet = pedescFound;
+            }
+        }
+    );
+    return pedescRet;
+}
+
+}};
+#endif
+
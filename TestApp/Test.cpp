@@ -1,4 +1,5 @@
 // This file was auto-generated by CQEnum.exe, do not edit
+#include <charconv>
 #include <cstdint>
 #include <stdexcept>
 #include <ostream>
@@ -6,11 +7,12 @@
 
 namespace CQSL { namespace Test {  namespace {
 
-enum class ETypes { Arbitrary, Bitmap, Standard };
+enum class ETypes { Arbitrary, Bitmap, FlagSet, Standard };
 
 struct EnumTableVal
 {
     const wchar_t* const   pszName;
+    const char* const      pszNameU8;
     int64_t                iOrdinal;
     int32_t                iAltVal;
     const wchar_t* const   pszText1;
@@ -54,6 +56,24 @@ uint32_t uOrdinalToIndex(  const   EnumTableVal* const paTable
     return std::numeric_limits<uint32_t>::max();
 }
 
+#if defined(CQENUM_INSTRUMENT)
+//
+//  The number of entries a failed ordinal search looked at, for the lookup
+//  instrumentation. It stops at the first one past the value it wants.
+//
+uint32_t uOrdinalMissProbes(const  EnumTableVal* const paTable
+                           , const uint32_t            uCount
+                           , const int64_t             iFind)
+{
+    uint32_t uIndex = 0;
+    while ((uIndex < uCount) && (paTable[uIndex].iOrdinal < iFind))
+    {
+        uIndex++;
+    }
+    return (uIndex < uCount) ? uIndex + 1 : uCount;
+}
+#endif
+
 uint32_t uAltValToIndex(const  EnumTableVal* const paTable
                        , const uint32_t            uCount
                        , const int32_t             iFind)
@@ -82,6 +102,140 @@ uint32_t uNameToIndex( const   EnumTableVal* const paTable
     return std::numeric_limits<uint32_t>::max();
 }
 
+//
+//  Support for the EnumFromChars() methods, which work on raw UTF-8 ranges. Names
+//  are ASCII identifiers, so there's no need to widen anything.
+//
+bool bIsNameCharU8(const char chTest)
+{
+    return ((chTest >= 'A') && (chTest <= 'Z'))
+           || ((chTest >= 'a') && (chTest <= 'z'))
+           || ((chTest >= '0') && (chTest <= '9'))
+           || (chTest == '_');
+}
+
+bool bSameNameU8(const char* const pszName, const char* const pchTest, const size_t szLen)
+{
+    for (size_t szIndex = 0; szIndex < szLen; szIndex++)
+    {
+        char chName = pszName[szIndex];
+        char chTest = pchTest[szIndex];
+        if (!chName)
+        {
+            return false;
+        }
+        if ((chName >= 'a') && (chName <= 'z'))
+        {
+            chName -= 0x20;
+        }
+        if ((chTest >= 'a') && (chTest <= 'z'))
+        {
+            chTest -= 0x20;
+        }
+        if (chName != chTest)
+        {
+            return false;
+        }
+    }
+    return pszName[szLen] == 0;
+}
+
+std::from_chars_result frIndexFromChars(const   EnumTableVal* const     paTable
+                                        , const uint32_t                uCount
+                                        , const char* const             pszFirst
+                                        , const char* const             pszLast
+                                        , const CQSL::CQEnum::EFromChars eRules
+                                        ,       uint32_t&               uIndex)
+{
+    std::from_chars_result frRet{ pszFirst, std::errc::invalid_argument };
+    uIndex = std::numeric_limits<uint32_t>::max();
+    if (pszFirst >= pszLast)
+    {
+        return frRet;
+    }
+
+    // If it starts with a letter, it has to be a name
+    const char chFirst = *pszFirst;
+    if (((chFirst >= 'A') && (chFirst <= 'Z')) || ((chFirst >= 'a') && (chFirst <= 'z')))
+    {
+        const char* pszEnd = pszFirst + 1;
+        while ((pszEnd < pszLast) && bIsNameCharU8(*pszEnd))
+        {
+            pszEnd++;
+        }
+
+        if (CQSL::CQEnum::bFromCharsRule(eRules, CQSL::CQEnum::EFromChars::Names))
+        {
+            const size_t szLen = static_cast<size_t>(pszEnd - pszFirst);
+            for (uint32_t uCur = 0; uCur < uCount; uCur++)
+            {
+                if (bSameNameU8(paTable[uCur].pszNameU8, pszFirst, szLen))
+                {
+                    uIndex = uCur;
+                    frRet.ptr = pszEnd;
+                    frRet.ec = std::errc();
+                    break;
+                }
+            }
+        }
+        return frRet;
+    }
+
+    // Else it has to be a decimal or 0x prefixed hex number, optionally negative
+    const char* pszNum = pszFirst;
+    const bool bNegative = (*pszNum == '-');
+    if (bNegative)
+    {
+        pszNum++;
+    }
+
+    int iRadix = 10;
+    if (((pszLast - pszNum) > 2) && (pszNum[0] == '0') && ((pszNum[1] == 'x') || (pszNum[1] == 'X')))
+    {
+        iRadix = 16;
+        pszNum += 2;
+    }
+
+    uint64_t uValue = 0;
+    const std::from_chars_result frNum = std::from_chars(pszNum, pszLast, uValue, iRadix);
+    if (frNum.ec == std::errc::result_out_of_range)
+    {
+        frRet = frNum;
+        return frRet;
+    }
+    else if (frNum.ec != std::errc())
+    {
+        return frRet;
+    }
+
+    // Ordinals and alt values are both within the int32_t range
+    if (uValue > (bNegative ? 0x80000000ULL : 0x7FFFFFFFULL))
+    {
+        frRet.ptr = frNum.ptr;
+        frRet.ec = std::errc::result_out_of_range;
+        return frRet;
+    }
+    const int64_t iValue = bNegative ? -static_cast<int64_t>(uValue) : static_cast<int64_t>(uValue);
+
+    if (CQSL::CQEnum::bFromCharsRule(eRules, CQSL::CQEnum::EFromChars::Ordinals))
+    {
+        uIndex = uOrdinalToIndex(paTable, uCount, iValue);
+    }
+
+    if ((uIndex >= uCount)
+    &&  CQSL::CQEnum::bFromCharsRule(eRules, CQSL::CQEnum::EFromChars::AltVals))
+    {
+        uIndex = uAltValToIndex(paTable, uCount, static_cast<int32_t>(iValue));
+    }
+
+    if (uIndex < uCount)
+    {
+        frRet.ptr = frNum.ptr;
+        frRet.ec = std::errc();
+    }
+    return frRet;
+}
+
 
 
 struct
@@ -92,9 +246,9 @@ struct
 {
     ETypes::Standard,
     {
-        { L"Value1", 0, 0, L"The text for value 1", L"The text2 for value 1" }
-      , { L"Value2", 1, 0, L"The text for value 2", L"The text2 for value 2" }
-      , { L"Value3", 2, 0, L"The text for value 3", L"The text2 for value 3" }
+        { L"Value1", "Value1", 0, 0, L"The text for value 1", L"The text2 for value 1" }
+      , { L"Value2", "Value2", 1, 0, L"The text for value 2", L"The text2 for value 2" }
+      , { L"Value3", "Value3", 2, 0, L"The text for value 3", L"The text2 for value 3" }
 
     }
 };
@@ -107,13 +261,209 @@ struct
 {
     ETypes::Bitmap,
     {
-        { L"Value1", 1, 101, L"The text for value 1", L"The text2 for value 1" }
-      , { L"Value2", 2, 102, L"The text for value 2", L"The text2 for value 2" }
-      , { L"Value3", 4, 103, L"The text for value 3", L"The text2 for value 3" }
+        { L"Value1", "Value1", 1, 101, L"The text for value 1", L"The text2 for value 1" }
+      , { L"Value2", "Value2", 2, 102, L"The text for value 2", L"The text2 for value 2" }
+      , { L"Value3", "Value3", 4, 103, L"The text for value 3", L"The text2 for value 3" }
 
     }
 };
 
+const int32_t atToAltVal_TestBmpRes[4] =
+{
+    101
+  , 102
+  , 0 // Unused
+  , 103
+};
+const CQSL::CQEnum::XlatTable<unsigned short, int32_t> xtblToAltVal_TestBmp =
+{
+    1, 4, atToAltVal_TestBmpRes, 0, 0, nullptr, nullptr
+};
+
+const CQSL::Test::TestBmp atFromAltVal_TestBmpRes[3] =
+{
+    static_cast<CQSL::Test::TestBmp>(1)
+  , static_cast<CQSL::Test::TestBmp>(2)
+  , static_cast<CQSL::Test::TestBmp>(4)
+};
+const CQSL::CQEnum::XlatTable<int32_t, CQSL::Test::TestBmp> xtblFromAltVal_TestBmp =
+{
+    101, 3, atFromAltVal_TestBmpRes, static_cast<CQSL::Test::TestBmp>(0), 0, nullptr, nullptr
+};
+
+struct
+{
+    ETypes         eType;
+    EnumTableVal   aevalTable[5];
+} EnumTable_TestPerms =
+{
+    ETypes::Bitmap,
+    {
+        { L"Read", "Read", 2, 0, L"", L"" }
+      , { L"Write", "Write", 4, 0, L"", L"" }
+      , { L"Exec", "Exec", 64, 0, L"", L"" }
+      , { L"Hidden", "Hidden", 4096, 0, L"", L"" }
+      , { L"Locked", "Locked", 1073741824, 0, L"", L"" }
+
+    }
+};
+
+struct
+{
+    ETypes         eType;
+    EnumTableVal   aevalTable[70];
+} EnumTable_TestFlags =
+{
+    ETypes::FlagSet,
+    {
+        { L"Perm00", "Perm00", 0, 0, L"", L"" }
+      , { L"Perm01", "Perm01", 1, 0, L"", L"" }
+      , { L"Perm02", "Perm02", 2, 0, L"", L"" }
+      , { L"Perm03", "Perm03", 3, 0, L"", L"" }
+      , { L"Perm04", "Perm04", 4, 0, L"", L"" }
+      , { L"Perm05", "Perm05", 5, 0, L"", L"" }
+      , { L"Perm06", "Perm06", 6, 0, L"", L"" }
+      , { L"Perm07", "Perm07", 7, 0, L"", L"" }
+      , { L"Perm08", "Perm08", 8, 0, L"", L"" }
+      , { L"Perm09", "Perm09", 9, 0, L"", L"" }
+      , { L"Perm10", "Perm10", 10, 0, L"", L"" }
+      , { L"Perm11", "Perm11", 11, 0, L"", L"" }
+      , { L"Perm12", "Perm12", 12, 0, L"", L"" }
+      , { L"Perm13", "Perm13", 13, 0, L"", L"" }
+      , { L"Perm14", "Perm14", 14, 0, L"", L"" }
+      , { L"Perm15", "Perm15", 15, 0, L"", L"" }
+      , { L"Perm16", "Perm16", 16, 0, L"", L"" }
+      , { L"Perm17", "Perm17", 17, 0, L"", L"" }
+      , { L"Perm18", "Perm18", 18, 0, L"", L"" }
+      , { L"Perm19", "Perm19", 19, 0, L"", L"" }
+      , { L"Perm20", "Perm20", 20, 0, L"", L"" }
+      , { L"Perm21", "Perm21", 21, 0, L"", L"" }
+      , { L"Perm22", "Perm22", 22, 0, L"", L"" }
+      , { L"Perm23", "Perm23", 23, 0, L"", L"" }
+      , { L"Perm24", "Perm24", 24, 0, L"", L"" }
+      , { L"Perm25", "Perm25", 25, 0, L"", L"" }
+      , { L"Perm26", "Perm26", 26, 0, L"", L"" }
+      , { L"Perm27", "Perm27", 27, 0, L"", L"" }
+      , { L"Perm28", "Perm28", 28, 0, L"", L"" }
+      , { L"Perm29", "Perm29", 29, 0, L"", L"" }
+      , { L"Perm30", "Perm30", 30, 0, L"", L"" }
+      , { L"Perm31", "Perm31", 31, 0, L"", L"" }
+      , { L"Perm32", "Perm32", 32, 0, L"", L"" }
+      , { L"Perm33", "Perm33", 33, 0, L"", L"" }
+      , { L"Perm34", "Perm34", 34, 0, L"", L"" }
+      , { L"Perm35", "Perm35", 35, 0, L"", L"" }
+      , { L"Perm36", "Perm36", 36, 0, L"", L"" }
+      , { L"Perm37", "Perm37", 37, 0, L"", L"" }
+      , { L"Perm38", "Perm38", 38, 0, L"", L"" }
+      , { L"Perm39", "Perm39", 39, 0, L"", L"" }
+      , { L"Perm40", "Perm40", 40, 0, L"", L"" }
+      , { L"Perm41", "Perm41", 41, 0, L"", L"" }
+      , { L"Perm42", "Perm42", 42, 0, L"", L"" }
+      , { L"Perm43", "Perm43", 43, 0, L"", L"" }
+      , { L"Perm44", "Perm44", 44, 0, L"", L"" }
+      , { L"Perm45", "Perm45", 45, 0, L"", L"" }
+      , { L"Perm46", "Perm46", 46, 0, L"", L"" }
+      , { L"Perm47", "Perm47", 47, 0, L"", L"" }
+      , { L"Perm48", "Perm48", 48, 0, L"", L"" }
+      , { L"Perm49", "Perm49", 49, 0, L"", L"" }
+      , { L"Perm50", "Perm50", 50, 0, L"", L"" }
+      , { L"Perm51", "Perm51", 51, 0, L"", L"" }
+      , { L"Perm52", "Perm52", 52, 0, L"", L"" }
+      , { L"Perm53", "Perm53", 53, 0, L"", L"" }
+      , { L"Perm54", "Perm54", 54, 0, L"", L"" }
+      , { L"Perm55", "Perm55", 55, 0, L"", L"" }
+      , { L"Perm56", "Perm56", 56, 0, L"", L"" }
+      , { L"Perm57", "Perm57", 57, 0, L"", L"" }
+      , { L"Perm58", "Perm58", 58, 0, L"", L"" }
+      , { L"Perm59", "Perm59", 59, 0, L"", L"" }
+      , { L"Perm60", "Perm60", 60, 0, L"", L"" }
+      , { L"Perm61", "Perm61", 61, 0, L"", L"" }
+      , { L"Perm62", "Perm62", 62, 0, L"", L"" }
+      , { L"Perm63", "Perm63", 63, 0, L"", L"" }
+      , { L"Perm64", "Perm64", 64, 0, L"", L"" }
+      , { L"Perm65", "Perm65", 65, 0, L"", L"" }
+      , { L"Perm66", "Perm66", 66, 0, L"", L"" }
+      , { L"Perm67", "Perm67", 67, 0, L"", L"" }
+      , { L"Perm68", "Perm68", 68, 0, L"", L"" }
+      , { L"Perm69", "Perm69", 69, 0, L"", L"" }
+
+    }
+};
+
+struct
+{
+    ETypes         eType;
+    EnumTableVal   aevalTable[4];
+} EnumTable_TestState =
+{
+    ETypes::Arbitrary,
+    {
+        { L"Idle", "Idle", 10, 5000, L"", L"" }
+      , { L"Connecting", "Connecting", 20, -7, L"", L"" }
+      , { L"Connected", "Connected", 30, 123456, L"", L"" }
+      , { L"Failed", "Failed", 40, 3, L"", L"" }
+
+    }
+};
+
+const int32_t atToAltVal_TestStateRes[31] =
+{
+    5000
+  , 0 // Unused
+  , 0 // Unused
+  , 0 // Unused
+  , 0 // Unused
+  , 0 // Unused
+  , 0 // Unused
+  , 0 // Unused
+  , 0 // Unused
+  , 0 // Unused
+  , -7
+  , 0 // Unused
+  , 0 // Unused
+  , 0 // Unused
+  , 0 // Unused
+  , 0 // Unused
+  , 0 // Unused
+  , 0 // Unused
+  , 0 // Unused
+  , 0 // Unused
+  , 123456
+  , 0 // Unused
+  , 0 // Unused
+  , 0 // Unused
+  , 0 // Unused
+  , 0 // Unused
+  , 0 // Unused
+  , 0 // Unused
+  , 0 // Unused
+  , 0 // Unused
+  , 3
+};
+const CQSL::CQEnum::XlatTable<int, int32_t> xtblToAltVal_TestState =
+{
+    10, 31, atToAltVal_TestStateRes, 0, 0, nullptr, nullptr
+};
+
+const CQSL::Test::TestState atFromAltVal_TestStateRes[4] =
+{
+    static_cast<CQSL::Test::TestState>(20)
+  , static_cast<CQSL::Test::TestState>(40)
+  , static_cast<CQSL::Test::TestState>(10)
+  , static_cast<CQSL::Test::TestState>(30)
+};
+const int32_t atFromAltVal_TestStateKeys[4] =
+{
+    -7
+  , 3
+  , 5000
+  , 123456
+};
+const CQSL::CQEnum::XlatTable<int32_t, CQSL::Test::TestState> xtblFromAltVal_TestState =
+{
+    0, 0, nullptr, static_cast<CQSL::Test::TestState>(0), 4, atFromAltVal_TestStateKeys, atFromAltVal_TestStateRes
+};
+
 
 } // Anonymous namespace
 
@@ -123,23 +473,43 @@ const std::wstring strTest = L"The value of the string object";
 
 
 // Enumeration method implementations
+CQSL::CQEnum::AliasRegistry<CQSL::Test::TestEnum>& TestEnumAliases()
+{
+    static CQSL::CQEnum::AliasRegistry<CQSL::Test::TestEnum> s_regAliases;
+    return s_regAliases;
+}
 bool bNameToEnum(const std::wstring_view& svName, CQSL::Test::TestEnum& eToFill)
 {
     const uint32_t uIndex = uNameToIndex(EnumTable_TestEnum.aevalTable, 3, svName);
     if (uIndex >= 3)
     {
-        return false;
+        const bool bAlias = TestEnumAliases().bFind(svName, eToFill);
+        CQENUM_LOOKUP(CQSL::Test::TestEnum, NameToEnum, bAlias, 3);
+        return bAlias;
     }
+    CQENUM_LOOKUP(CQSL::Test::TestEnum, NameToEnum, true, uIndex + 1);
     eToFill = static_cast<CQSL::Test::TestEnum>(EnumTable_TestEnum.aevalTable[uIndex].iOrdinal);
     return true;
 }
+std::from_chars_result EnumFromChars(const char* const pszFirst, const char* const pszLast, CQSL::Test::TestEnum& eToFill, const CQSL::CQEnum::EFromChars eRules)
+{
+    uint32_t uIndex = 0;
+    const std::from_chars_result frRet = frIndexFromChars(EnumTable_TestEnum.aevalTable, 3, pszFirst, pszLast, static_cast<CQSL::CQEnum::EFromChars>(static_cast<uint32_t>(eRules) & ~static_cast<uint32_t>(CQSL::CQEnum::EFromChars::AltVals)), uIndex);
+    if (frRet.ec == std::errc())
+    {
+        eToFill = static_cast<CQSL::Test::TestEnum>(EnumTable_TestEnum.aevalTable[uIndex].iOrdinal);
+    }
+    return frRet;
+}
 const wchar_t* pszEnumToName(const CQSL::Test::TestEnum eVal)
 {
     const uint32_t uIndex = uOrdinalToIndex(EnumTable_TestEnum.aevalTable, 3, static_cast<int64_t>(eVal));
     if (uIndex >= 3)
     {
+        CQENUM_LOOKUP(CQSL::Test::TestEnum, EnumToName, false, uOrdinalMissProbes(EnumTable_TestEnum.aevalTable, 3, static_cast<int64_t>(eVal)));
         return nullptr;
     }
+    CQENUM_LOOKUP(CQSL::Test::TestEnum, EnumToName, true, uIndex + 1);
     return EnumTable_TestEnum.aevalTable[uIndex].pszName;
 }
 const wchar_t* pszEnumToAltText1(const CQSL::Test::TestEnum eVal)
@@ -147,9 +517,11 @@ const wchar_t* pszEnumToAltText1(const CQSL::Test::TestEnum eVal)
     uint32_t uIndex = 0;
     if ((eVal < CQSL::Test::TestEnum::Min) || (eVal > CQSL::Test::TestEnum::Max))
     {
+        CQENUM_LOOKUP(CQSL::Test::TestEnum, EnumToText1, false, 0);
         throw std::runtime_error("Invalid value for 'CQSL::Test::TestEnum' enumeration");
     }
     uIndex = static_cast<uint32_t>(eVal);
+    CQENUM_LOOKUP(CQSL::Test::TestEnum, EnumToText1, true, 1);
     return EnumTable_TestEnum.aevalTable[uIndex].pszText1;
 }
 
@@ -158,9 +530,11 @@ const wchar_t* pszEnumToAltText2(const CQSL::Test::TestEnum eVal)
     uint32_t uIndex = 0;
     if ((eVal < CQSL::Test::TestEnum::Min) || (eVal > CQSL::Test::TestEnum::Max))
     {
+        CQENUM_LOOKUP(CQSL::Test::TestEnum, EnumToText2, false, 0);
         throw std::runtime_error("Invalid value for 'CQSL::Test::TestEnum' enumeration");
     }
     uIndex = static_cast<uint32_t>(eVal);
+    CQENUM_LOOKUP(CQSL::Test::TestEnum, EnumToText2, true, 1);
     return EnumTable_TestEnum.aevalTable[uIndex].pszText2;
 }
 
@@ -169,23 +543,38 @@ bool bNameToEnum(const std::wstring_view& svName, CQSL::Test::TestBmp& eToFill)
     const uint32_t uIndex = uNameToIndex(EnumTable_TestBmp.aevalTable, 3, svName);
     if (uIndex >= 3)
     {
+        CQENUM_LOOKUP(CQSL::Test::TestBmp, NameToEnum, false, 3);
         return false;
     }
+    CQENUM_LOOKUP(CQSL::Test::TestBmp, NameToEnum, true, uIndex + 1);
     eToFill = static_cast<CQSL::Test::TestBmp>(EnumTable_TestBmp.aevalTable[uIndex].iOrdinal);
     return true;
 }
+std::from_chars_result EnumFromChars(const char* const pszFirst, const char* const pszLast, CQSL::Test::TestBmp& eToFill, const CQSL::CQEnum::EFromChars eRules)
+{
+    uint32_t uIndex = 0;
+    const std::from_chars_result frRet = frIndexFromChars(EnumTable_TestBmp.aevalTable, 3, pszFirst, pszLast, eRules, uIndex);
+    if (frRet.ec == std::errc())
+    {
+        eToFill = static_cast<CQSL::Test::TestBmp>(EnumTable_TestBmp.aevalTable[uIndex].iOrdinal);
+    }
+    return frRet;
+}
 const wchar_t* pszEnumToName(const CQSL::Test::TestBmp eVal)
 {
     const uint32_t uIndex = uOrdinalToIndex(EnumTable_TestBmp.aevalTable, 3, static_cast<int64_t>(eVal));
     if (uIndex >= 3)
     {
+        CQENUM_LOOKUP(CQSL::Test::TestBmp, EnumToName, false, uOrdinalMissProbes(EnumTable_TestBmp.aevalTable, 3, static_cast<int64_t>(eVal)));
         return nullptr;
     }
+    CQENUM_LOOKUP(CQSL::Test::TestBmp, EnumToName, true, uIndex + 1);
     return EnumTable_TestBmp.aevalTable[uIndex].pszName;
 }
 bool bIsValidEnumVal(const CQSL::Test::TestBmp eTest)
 {
     const uint32_t uIndex = uOrdinalToIndex(EnumTable_TestBmp.aevalTable, 3, static_cast<int64_t>(eTest));
+    CQENUM_LOOKUP(CQSL::Test::TestBmp, IsValid, uIndex < 3, (uIndex < 3) ? uIndex + 1 : uOrdinalMissProbes(EnumTable_TestBmp.aevalTable, 3, static_cast<int64_t>(eTest)));
     return (uIndex < 3);
 }
 const wchar_t* pszEnumToAltText1(const CQSL::Test::TestBmp eVal)
@@ -194,8 +583,10 @@ const wchar_t* pszEnumToAltText1(const CQSL::Test::TestBmp eVal)
     uIndex = uOrdinalToIndex(EnumTable_TestBmp.aevalTable, 3, static_cast<int64_t>(eVal));
     if (uIndex >= 3)
     {
+        CQENUM_LOOKUP(CQSL::Test::TestBmp, EnumToText1, false, uOrdinalMissProbes(EnumTable_TestBmp.aevalTable, 3, static_cast<int64_t>(eVal)));
         throw std::runtime_error("Invalid value for 'CQSL::Test::TestBmp' enumeration");
     }
+    CQENUM_LOOKUP(CQSL::Test::TestBmp, EnumToText1, true, uIndex + 1);
     return EnumTable_TestBmp.aevalTable[uIndex].pszText1;
 }
 
@@ -205,8 +596,10 @@ const wchar_t* pszEnumToAltText2(const CQSL::Test::TestBmp eVal)
     uIndex = uOrdinalToIndex(EnumTable_TestBmp.aevalTable, 3, static_cast<int64_t>(eVal));
     if (uIndex >= 3)
     {
+        CQENUM_LOOKUP(CQSL::Test::TestBmp, EnumToText2, false, uOrdinalMissProbes(EnumTable_TestBmp.aevalTable, 3, static_cast<int64_t>(eVal)));
         throw std::runtime_error("Invalid value for 'CQSL::Test::TestBmp' enumeration");
     }
+    CQENUM_LOOKUP(CQSL::Test::TestBmp, EnumToText2, true, uIndex + 1);
     return EnumTable_TestBmp.aevalTable[uIndex].pszText2;
 }
 
@@ -215,8 +608,10 @@ bool bEnumToAltValue(const CQSL::Test::TestBmp eVal, int32_t& iToFill)
     const uint32_t uIndex = uOrdinalToIndex(EnumTable_TestBmp.aevalTable, 3, static_cast<int64_t>(eVal));
     if (uIndex >= 3)
     {
+        CQENUM_LOOKUP(CQSL::Test::TestBmp, EnumToAltVal, false, uOrdinalMissProbes(EnumTable_TestBmp.aevalTable, 3, static_cast<int64_t>(eVal)));
         return false;
     }
+    CQENUM_LOOKUP(CQSL::Test::TestBmp, EnumToAltVal, true, uIndex + 1);
     iToFill = EnumTable_TestBmp.aevalTable[uIndex].iAltVal;
     return true;
 }
@@ -225,12 +620,235 @@ bool bEnumFromAltValue(const int32_t iAltVal, CQSL::Test::TestBmp& eToFill)
     const uint32_t uIndex = uAltValToIndex(EnumTable_TestBmp.aevalTable, 3, iAltVal);
     if (uIndex >= 3)
     {
+        CQENUM_LOOKUP(CQSL::Test::TestBmp, AltValToEnum, false, 3);
         return false;
     }
+    CQENUM_LOOKUP(CQSL::Test::TestBmp, AltValToEnum, true, uIndex + 1);
     eToFill = static_cast<CQSL::Test::TestBmp>(EnumTable_TestBmp.aevalTable[uIndex].iOrdinal);
     return true;
 }
+size_t EnumsToAltValues(const CQSL::Test::TestBmp* const paeSrc, const size_t szCount, int32_t* const paiTar, uint64_t* const pauInvalid)
+{
+    return CQSL::CQEnum::szXlatValues(paeSrc, szCount, paiTar, xtblToAltVal_TestBmp, int32_t(0), pauInvalid);
+}
+size_t AltValuesToEnums(const int32_t* const paiSrc, const size_t szCount, CQSL::Test::TestBmp* const paeTar, uint64_t* const pauInvalid)
+{
+    return CQSL::CQEnum::szXlatValues(paiSrc, szCount, paeTar, xtblFromAltVal_TestBmp, static_cast<CQSL::Test::TestBmp>(0), pauInvalid);
+}
+bool bNameToEnum(const std::wstring_view& svName, CQSL::Test::TestPerms& eToFill)
+{
+    const uint32_t uIndex = uNameToIndex(EnumTable_TestPerms.aevalTable, 5, svName);
+    if (uIndex >= 5)
+    {
+        CQENUM_LOOKUP(CQSL::Test::TestPerms, NameToEnum, false, 5);
+        return false;
+    }
+    CQENUM_LOOKUP(CQSL::Test::TestPerms, NameToEnum, true, uIndex + 1);
+    eToFill = static_cast<CQSL::Test::TestPerms>(EnumTable_TestPerms.aevalTable[uIndex].iOrdinal);
+    return true;
+}
+std::from_chars_result EnumFromChars(const char* const pszFirst, const char* const pszLast, CQSL::Test::TestPerms& eToFill, const CQSL::CQEnum::EFromChars eRules)
+{
+    uint32_t uIndex = 0;
+    const std::from_chars_result frRet = frIndexFromChars(EnumTable_TestPerms.aevalTable, 5, pszFirst, pszLast, static_cast<CQSL::CQEnum::EFromChars>(static_cast<uint32_t>(eRules) & ~static_cast<uint32_t>(CQSL::CQEnum::EFromChars::AltVals)), uIndex);
+    if (frRet.ec == std::errc())
+    {
+        eToFill = static_cast<CQSL::Test::TestPerms>(EnumTable_TestPerms.aevalTable[uIndex].iOrdinal);
+    }
+    return frRet;
+}
+const wchar_t* pszEnumToName(const CQSL::Test::TestPerms eVal)
+{
+    const uint32_t uIndex = uOrdinalToIndex(EnumTable_TestPerms.aevalTable, 5, static_cast<int64_t>(eVal));
+    if (uIndex >= 5)
+    {
+        CQENUM_LOOKUP(CQSL::Test::TestPerms, EnumToName, false, uOrdinalMissProbes(EnumTable_TestPerms.aevalTable, 5, static_cast<int64_t>(eVal)));
+        return nullptr;
+    }
+    CQENUM_LOOKUP(CQSL::Test::TestPerms, EnumToName, true, uIndex + 1);
+    return EnumTable_TestPerms.aevalTable[uIndex].pszName;
+}
+bool bIsValidEnumVal(const CQSL::Test::TestPerms eTest)
+{
+    const uint32_t uIndex = uOrdinalToIndex(EnumTable_TestPerms.aevalTable, 5, static_cast<int64_t>(eTest));
+    CQENUM_LOOKUP(CQSL::Test::TestPerms, IsValid, uIndex < 5, (uIndex < 5) ? uIndex + 1 : uOrdinalMissProbes(EnumTable_TestPerms.aevalTable, 5, static_cast<int64_t>(eTest)));
+    return (uIndex < 5);
+}
+bool bNameToEnum(const std::wstring_view& svName, CQSL::Test::TestFlags& eToFill)
+{
+    const uint32_t uIndex = uNameToIndex(EnumTable_TestFlags.aevalTable, 70, svName);
+    if (uIndex >= 70)
+    {
+        CQENUM_LOOKUP(CQSL::Test::TestFlags, NameToEnum, false, 70);
+        return false;
+    }
+    CQENUM_LOOKUP(CQSL::Test::TestFlags, NameToEnum, true, uIndex + 1);
+    eToFill = static_cast<CQSL::Test::TestFlags>(EnumTable_TestFlags.aevalTable[uIndex].iOrdinal);
+    return true;
+}
+std::from_chars_result EnumFromChars(const char* const pszFirst, const char* const pszLast, CQSL::Test::TestFlags& eToFill, const CQSL::CQEnum::EFromChars eRules)
+{
+    uint32_t uIndex = 0;
+    const std::from_chars_result frRet = frIndexFromChars(EnumTable_TestFlags.aevalTable, 70, pszFirst, pszLast, static_cast<CQSL::CQEnum::EFromChars>(static_cast<uint32_t>(eRules) & ~static_cast<uint32_t>(CQSL::CQEnum::EFromChars::AltVals)), uIndex);
+    if (frRet.ec == std::errc())
+    {
+        eToFill = static_cast<CQSL::Test::TestFlags>(EnumTable_TestFlags.aevalTable[uIndex].iOrdinal);
+    }
+    return frRet;
+}
+const wchar_t* pszEnumToName(const CQSL::Test::TestFlags eVal)
+{
+    const uint32_t uIndex = uOrdinalToIndex(EnumTable_TestFlags.aevalTable, 70, static_cast<int64_t>(eVal));
+    if (uIndex >= 70)
+    {
+        CQENUM_LOOKUP(CQSL::Test::TestFlags, EnumToName, false, uOrdinalMissProbes(EnumTable_TestFlags.aevalTable, 70, static_cast<int64_t>(eVal)));
+        return nullptr;
+    }
+    CQENUM_LOOKUP(CQSL::Test::TestFlags, EnumToName, true, uIndex + 1);
+    return EnumTable_TestFlags.aevalTable[uIndex].pszName;
+}
+bool bNameToEnum(const std::wstring_view& svName, CQSL::Test::TestState& eToFill)
+{
+    const uint32_t uIndex = uNameToIndex(EnumTable_TestState.aevalTable, 4, svName);
+    if (uIndex >= 4)
+    {
+        CQENUM_LOOKUP(CQSL::Test::TestState, NameToEnum, false, 4);
+        return false;
+    }
+    CQENUM_LOOKUP(CQSL::Test::TestState, NameToEnum, true, uIndex + 1);
+    eToFill = static_cast<CQSL::Test::TestState>(EnumTable_TestState.aevalTable[uIndex].iOrdinal);
+    return true;
+}
+std::from_chars_result EnumFromChars(const char* const pszFirst, const char* const pszLast, CQSL::Test::TestState& eToFill, const CQSL::CQEnum::EFromChars eRules)
+{
+    uint32_t uIndex = 0;
+    const std::from_chars_result frRet = frIndexFromChars(EnumTable_TestState.aevalTable, 4, pszFirst, pszLast, eRules, uIndex);
+    if (frRet.ec == std::errc())
+    {
+        eToFill = static_cast<CQSL::Test::TestState>(EnumTable_TestState.aevalTable[uIndex].iOrdinal);
+    }
+    return frRet;
+}
+const wchar_t* pszEnumToName(const CQSL::Test::TestState eVal)
+{
+    const uint32_t uIndex = uOrdinalToIndex(EnumTable_TestState.aevalTable, 4, static_cast<int64_t>(eVal));
+    if (uIndex >= 4)
+    {
+        CQENUM_LOOKUP(CQSL::Test::TestState, EnumToName, false, uOrdinalMissProbes(EnumTable_TestState.aevalTable, 4, static_cast<int64_t>(eVal)));
+        return nullptr;
+    }
+    CQENUM_LOOKUP(CQSL::Test::TestState, EnumToName, true, uIndex + 1);
+    return EnumTable_TestState.aevalTable[uIndex].pszName;
+}
+bool bIsValidEnumVal(const CQSL::Test::TestState eTest)
+{
+    const uint32_t uIndex = uOrdinalToIndex(EnumTable_TestState.aevalTable, 4, static_cast<int64_t>(eTest));
+    CQENUM_LOOKUP(CQSL::Test::TestState, IsValid, uIndex < 4, (uIndex < 4) ? uIndex + 1 : uOrdinalMissProbes(EnumTable_TestState.aevalTable, 4, static_cast<int64_t>(eTest)));
+    return (uIndex < 4);
+}
+bool bEnumToAltValue(const CQSL::Test::TestState eVal, int32_t& iToFill)
+{
+    const uint32_t uIndex = uOrdinalToIndex(EnumTable_TestState.aevalTable, 4, static_cast<int64_t>(eVal));
+    if (uIndex >= 4)
+    {
+        CQENUM_LOOKUP(CQSL::Test::TestState, EnumToAltVal, false, uOrdinalMissProbes(EnumTable_TestState.aevalTable, 4, static_cast<int64_t>(eVal)));
+        return false;
+    }
+    CQENUM_LOOKUP(CQSL::Test::TestState, EnumToAltVal, true, uIndex + 1);
+    iToFill = EnumTable_TestState.aevalTable[uIndex].iAltVal;
+    return true;
+}
+bool bEnumFromAltValue(const int32_t iAltVal, CQSL::Test::TestState& eToFill)
+{
+    const uint32_t uIndex = uAltValToIndex(EnumTable_TestState.aevalTable, 4, iAltVal);
+    if (uIndex >= 4)
+    {
+        CQENUM_LOOKUP(CQSL::Test::TestState, AltValToEnum, false, 4);
+        return false;
+    }
+    CQENUM_LOOKUP(CQSL::Test::TestState, AltValToEnum, true, uIndex + 1);
+    eToFill = static_cast<CQSL::Test::TestState>(EnumTable_TestState.aevalTable[uIndex].iOrdinal);
+    return true;
+}
+size_t EnumsToAltValues(const CQSL::Test::TestState* const paeSrc, const size_t szCount, int32_t* const paiTar, uint64_t* const pauInvalid)
+{
+    return CQSL::CQEnum::szXlatValues(paeSrc, szCount, paiTar, xtblToAltVal_TestState, int32_t(0), pauInvalid);
+}
+size_t AltValuesToEnums(const int32_t* const paiSrc, const size_t szCount, CQSL::Test::TestState* const paeTar, uint64_t* const pauInvalid)
+{
+    return CQSL::CQEnum::szXlatValues(paiSrc, szCount, paeTar, xtblFromAltVal_TestState, static_cast<CQSL::Test::TestState>(0), pauInvalid);
+}
 
 }};
 
 
+// The static reflection registry entry for this file
+namespace {
+constexpr CQSL::CQEnum::EnumDescriptor aedescRegistry[] =
+{
+      { "CQSL::Test::TestBmp"
+        , CQSL::CQEnum::EnumTraits<CQSL::Test::TestBmp>::eKind
+        , 3
+        , CQSL::CQEnum::EnumTraits<CQSL::Test::TestBmp>::c_uFingerprint
+        , &CQSL::CQEnum::iDescValueAt<CQSL::Test::TestBmp>
+        , &CQSL::CQEnum::pszDescToName<CQSL::Test::TestBmp>
+        , &CQSL::CQEnum::bDescFromName<CQSL::Test::TestBmp>
+        , &CQSL::CQEnum::bDescIsValid<CQSL::Test::TestBmp>
+        , &CQSL::CQEnum::pszDescToText1<CQSL::Test::TestBmp>
+        , &CQSL::CQEnum::pszDescToText2<CQSL::Test::TestBmp>
+      }
+    , { "CQSL::Test::TestEnum"
+        , CQSL::CQEnum::EnumTraits<CQSL::Test::TestEnum>::eKind
+        , 3
+        , CQSL::CQEnum::EnumTraits<CQSL::Test::TestEnum>::c_uFingerprint
+        , &CQSL::CQEnum::iDescValueAt<CQSL::Test::TestEnum>
+        , &CQSL::CQEnum::pszDescToName<CQSL::Test::TestEnum>
+        , &CQSL::CQEnum::bDescFromName<CQSL::Test::TestEnum>
+        , &CQSL::CQEnum::bDescIsValid<CQSL::Test::TestEnum>
+        , &CQSL::CQEnum::pszDescToText1<CQSL::Test::TestEnum>
+        , &CQSL::CQEnum::pszDescToText2<CQSL::Test::TestEnum>
+      }
+    , { "CQSL::Test::TestFlags"
+        , CQSL::CQEnum::EnumTraits<CQSL::Test::TestFlags>::eKind
+        , 70
+        , CQSL::CQEnum::EnumTraits<CQSL::Test::TestFlags>::c_uFingerprint
+        , &CQSL::CQEnum::iDescValueAt<CQSL::Test::TestFlags>
+        , &CQSL::CQEnum::pszDescToName<CQSL::Test::TestFlags>
+        , &CQSL::CQEnum::bDescFromName<CQSL::Test::TestFlags>
+        , &CQSL::CQEnum::bDescIsValid<CQSL::Test::TestFlags>
+        , nullptr
+        , nullptr
+      }
+    , { "CQSL::Test::TestPerms"
+        , CQSL::CQEnum::EnumTraits<CQSL::Test::TestPerms>::eKind
+        , 5
+        , CQSL::CQEnum::EnumTraits<CQSL::Test::TestPerms>::c_uFingerprint
+        , &CQSL::CQEnum::iDescValueAt<CQSL::Test::TestPerms>
+        , &CQSL::CQEnum::pszDescToName<CQSL::Test::TestPerms>
+        , &CQSL::CQEnum::bDescFromName<CQSL::Test::TestPerms>
+        , &CQSL::CQEnum::bDescIsValid<CQSL::Test::TestPerms>
+        , nullptr
+        , nullptr
+      }
+    , { "CQSL::Test::TestState"
+        , CQSL::CQEnum::EnumTraits<CQSL::Test::TestState>::eKind
+        , 4
+        , CQSL::CQEnum::EnumTraits<CQSL::Test::TestState>::c_uFingerprint
+        , &CQSL::CQEnum::iDescValueAt<CQSL::Test::TestState>
+        , &CQSL::CQEnum::pszDescToName<CQSL::Test::TestState>
+        , &CQSL::CQEnum::bDescFromName<CQSL::Test::TestState>
+        , &CQSL::CQEnum::bDescIsValid<CQSL::Test::TestState>
+        , nullptr
+        , nullptr
+      }
+};
+constexpr CQSL::CQEnum::EnumDescriptorList edlRegistry = { aedescRegistry, 5 };
+}
+#if defined(CQENUM_REGISTRY_SECTION)
+extern "C" CQENUM_REGISTRY_SECTION const CQSL::CQEnum::EnumDescriptorList* const CQEnumReg_CQSL_Test_Test = &edlRegistry;
+#if defined(_MSC_VER) && defined(_M_IX86)
+#pragma comment(linker, "/include:_CQEnumReg_CQSL_Test_Test")
+#elif defined(_MSC_VER)
+#pragma comment(linker, "/include:CQEnumReg_CQSL_Test_Test")
+#endif
+#endif
@@ -1,11 +1,24 @@
 // This file was auto-generated by CQEnum.exe, do not edit
 #include <string_view>
+#include "CQEnumSupport.hpp"
+
+static_assert(CQENUM_SUPPORT_VERSION == 3, "Test.hpp was generated for a different version of CQEnumSupport.hpp");
+
+#include "TestPayloads.hpp"
 
 namespace CQSL { namespace Test { 
 
     constexpr unsigned int uTest = 10;
     static const wchar_t* const pszTest = L"The value of the raw string";
     extern const std::wstring strTest;
+    constexpr std::array<const char*, 3> apszTestNames =
+    {{
+          "One", "Two, Three", "Four"
+    }};
+    constexpr std::array<int16_t, 5> aiTestCurve =
+    {{
+          0, 1000, -1000, (-32767 - 1), 32767
+    }};
 
 
     enum class TestEnum : int
@@ -16,16 +29,81 @@ namespace CQSL { namespace Test {
         , Min = 0
         , Max = 2
         , Count = 3
-        , Syn1 = 0
+        , Syn1 = 2
     };
     const wchar_t* pszEnumToAltText1(const CQSL::Test::TestEnum eVal);
     const wchar_t* pszEnumToAltText2(const CQSL::Test::TestEnum eVal);
     const wchar_t* pszEnumToName(const CQSL::Test::TestEnum eVal);
     bool bNameToEnum(const std::wstring_view& svText, CQSL::Test::TestEnum& eToFill);
+    CQSL::CQEnum::AliasRegistry<CQSL::Test::TestEnum>& TestEnumAliases();
+    std::from_chars_result EnumFromChars(const char* const pszFirst, const char* const pszLast, CQSL::Test::TestEnum& eToFill, const CQSL::CQEnum::EFromChars eRules = CQSL::CQEnum::EFromChars::All);
     inline bool bIsValidEnumVal(const CQSL::Test::TestEnum eTest)
     {
-        return ((eTest >= CQSL::Test::TestEnum::Min) && (eTest <= CQSL::Test::TestEnum::Max));
+        const bool bRet = ((eTest >= CQSL::Test::TestEnum::Min) && (eTest <= CQSL::Test::TestEnum::Max));
+        CQENUM_LOOKUP(CQSL::Test::TestEnum, IsValid, bRet, 0);
+        return bRet;
+    }
+    constexpr uint32_t uEnumToIndex(const CQSL::Test::TestEnum eVal)
+    {
+        return (static_cast<uint64_t>(eVal) < 3) ? static_cast<uint32_t>(eVal) : 3;
     }
+    struct TestEnumAttrs
+    {
+        static constexpr double aWeight[4] =
+        {
+              0.5
+            , 1.5
+            , 2.5
+            , {} // Invalid values
+        };
+        static constexpr const char* aLabel[4] =
+        {
+              "one"
+            , "two"
+            , "three"
+            , {} // Invalid values
+        };
+    };
+    constexpr double EnumToWeight(const CQSL::Test::TestEnum eVal)
+    {
+        return TestEnumAttrs::aWeight[uEnumToIndex(eVal)];
+    }
+    constexpr const char* EnumToLabel(const CQSL::Test::TestEnum eVal)
+    {
+        return TestEnumAttrs::aLabel[uEnumToIndex(eVal)];
+    }
+    struct TestEnumSchema
+    {
+        static constexpr uint64_t c_uFingerprint = 0x99844a87572481afULL;
+    };
+    struct TestEnumRemap
+    {
+        static constexpr uint64_t c_uFromFingerprint = 0xf866c3b87032271ULL;
+        static constexpr uint32_t c_uTableSize = 4;
+        static constexpr int c_tRemoved = 3;
+        static constexpr int s_atTable[4] =
+        {
+              2 // Value3 -> Value3
+            , 0 // Value1 -> Value1
+            , c_tRemoved // Retired
+            , 1 // Value2 -> Value2
+        };
+
+        static bool bRemap(const int tOld, CQSL::Test::TestEnum& eToFill) noexcept
+        {
+            if ((static_cast<uint64_t>(tOld) >= c_uTableSize) || (s_atTable[tOld] == c_tRemoved))
+            {
+                return false;
+            }
+            eToFill = static_cast<CQSL::Test::TestEnum>(s_atTable[tOld]);
+            return true;
+        }
+
+        static size_t szRemap(const int* const patSrc, const size_t szCount, int* const patTar, const int tBad) noexcept
+        {
+            return CQSL::CQEnum::szRemapValues(patSrc, szCount, patTar, s_atTable, c_uTableSize, c_tRemoved, tBad);
+        }
+    };
 
 
     enum class TestBmp : unsigned short
@@ -42,9 +120,27 @@ namespace CQSL { namespace Test {
     const wchar_t* pszEnumToAltText2(const CQSL::Test::TestBmp eVal);
     bool bEnumToAltValue(const CQSL::Test::TestBmp eVal, int32_t& iToFill);
     bool bEnumFromAltValue(const int32_t iAltVal, CQSL::Test::TestBmp& eToFill);
+    size_t EnumsToAltValues(const CQSL::Test::TestBmp* const paeSrc, const size_t szCount, int32_t* const paiTar, uint64_t* const pauInvalid = nullptr);
+    size_t AltValuesToEnums(const int32_t* const paiSrc, const size_t szCount, CQSL::Test::TestBmp* const paeTar, uint64_t* const pauInvalid = nullptr);
     const wchar_t* pszEnumToName(const CQSL::Test::TestBmp eVal);
     bool bNameToEnum(const std::wstring_view& svText, CQSL::Test::TestBmp& eToFill);
+    std::from_chars_result EnumFromChars(const char* const pszFirst, const char* const pszLast, CQSL::Test::TestBmp& eToFill, const CQSL::CQEnum::EFromChars eRules = CQSL::CQEnum::EFromChars::All);
     bool bIsValidEnumVal(const CQSL::Test::TestBmp eTest);
+    constexpr uint32_t uEnumToIndex(const CQSL::Test::TestBmp eVal)
+    {
+        switch(eVal)
+        {
+            case CQSL::Test::TestBmp::Value1 : return 0;
+            case CQSL::Test::TestBmp::Value2 : return 1;
+            case CQSL::Test::TestBmp::Value3 : return 2;
+            default : break;
+        };
+        return 3;
+    }
+    struct TestBmpSchema
+    {
+        static constexpr uint64_t c_uFingerprint = 0x64c1c8f724cb3b3fULL;
+    };
     inline bool bAllEnumBitsOn(const CQSL::Test::TestBmp eTest, const CQSL::Test::TestBmp eBits)
     {
         return (static_cast<unsigned short>(eTest) & static_cast<unsigned short>(eBits)) == static_cast<unsigned short>(eBits);
@@ -53,6 +149,460 @@ namespace CQSL { namespace Test {
     {
         return (static_cast<unsigned short>(eTest) & static_cast<unsigned short>(eBits)) != 0;
     }
+    constexpr bool bIsValidBits(const CQSL::Test::TestBmp eTest)
+    {
+        return (static_cast<unsigned short>(eTest) & ~static_cast<unsigned short>(CQSL::Test::TestBmp::AllBits)) == 0;
+    }
+    constexpr bool bIsSingleBit(const CQSL::Test::TestBmp eTest)
+    {
+        return (static_cast<unsigned short>(eTest) != 0)
+            && ((static_cast<unsigned short>(eTest) & (static_cast<unsigned short>(eTest) - 1)) == 0)
+            && bIsValidBits(eTest);
+    }
+    inline bool bIsValidBits(const CQSL::Test::TestBmp* const peList, const size_t szCount)
+    {
+        return (CQSL::CQEnum::uOrAllBits(peList, szCount) & ~static_cast<unsigned short>(CQSL::Test::TestBmp::AllBits)) == 0;
+    }
+    inline bool bIsSingleBit(const CQSL::Test::TestBmp* const peList, const size_t szCount)
+    {
+        return CQSL::CQEnum::bAllSingleBits(peList, szCount) && bIsValidBits(peList, szCount);
+    }
+    inline uint32_t uCombinationIndex(const CQSL::Test::TestBmp eBits) noexcept
+    {
+#if defined(CQENUM_BMI2)
+        return _pext_u32(static_cast<uint32_t>(eBits), 0x7U);
+#else
+        const uint32_t uBits = static_cast<uint32_t>(eBits);
+        return (uBits & 0x7U);
+#endif
+    }
+    using TestBmpAtomicFlags = CQSL::CQEnum::AtomicFlags<CQSL::Test::TestBmp>;
+
+
+    enum class TestPerms : unsigned int
+    {
+          Read = 2
+        , Write = 4
+        , Exec = 64
+        , Hidden = 4096
+        , Locked = 1073741824
+        , AllBits = 0x40001046
+        , NoBits = 0x0
+        , ReadWrite = 6
+    };
+    const wchar_t* pszEnumToName(const CQSL::Test::TestPerms eVal);
+    bool bNameToEnum(const std::wstring_view& svText, CQSL::Test::TestPerms& eToFill);
+    std::from_chars_result EnumFromChars(const char* const pszFirst, const char* const pszLast, CQSL::Test::TestPerms& eToFill, const CQSL::CQEnum::EFromChars eRules = CQSL::CQEnum::EFromChars::All);
+    bool bIsValidEnumVal(const CQSL::Test::TestPerms eTest);
+    constexpr uint32_t uEnumToIndex(const CQSL::Test::TestPerms eVal)
+    {
+        switch(eVal)
+        {
+            case CQSL::Test::TestPerms::Read : return 0;
+            case CQSL::Test::TestPerms::Write : return 1;
+            case CQSL::Test::TestPerms::Exec : return 2;
+            case CQSL::Test::TestPerms::Hidden : return 3;
+            case CQSL::Test::TestPerms::Locked : return 4;
+            default : break;
+        };
+        return 5;
+    }
+    struct TestPermsSchema
+    {
+        static constexpr uint64_t c_uFingerprint = 0xd067fc7c4050e500ULL;
+    };
+    struct TestPermsRemap
+    {
+        static constexpr uint64_t c_uFromFingerprint = 0x6fa987f3db219143ULL;
+        static constexpr uint32_t c_uBitCount = 5;
+        static constexpr unsigned int c_tKnownBits = 0x8007;
+        static constexpr unsigned int s_atOldBits[5] =
+        {
+              0x1 // Read
+            , 0x2 // Write
+            , 0x4 // Exec
+            , 0x8 // Archive
+            , 0x8000 // Locked
+        };
+        static constexpr unsigned int s_atNewBits[5] =
+        {
+              0x2 // Read
+            , 0x4 // Write
+            , 0x40 // Exec
+            , 0 // Removed
+            , 0x40000000 // Locked
+        };
+
+        static bool bRemap(const unsigned int tOld, CQSL::Test::TestPerms& eToFill) noexcept
+        {
+            if (tOld & ~c_tKnownBits)
+            {
+                return false;
+            }
+
+            unsigned int tNew = 0;
+            for (uint32_t uIndex = 0; uIndex < c_uBitCount; uIndex++)
+            {
+                if (tOld & s_atOldBits[uIndex])
+                {
+                    tNew |= s_atNewBits[uIndex];
+                }
+            }
+            eToFill = static_cast<CQSL::Test::TestPerms>(tNew);
+            return true;
+        }
+
+        static size_t szRemap(const unsigned int* const patSrc, const size_t szCount, unsigned int* const patTar, const unsigned int tBad) noexcept
+        {
+            size_t szBad = 0;
+            for (size_t szIndex = 0; szIndex < szCount; szIndex++)
+            {
+                CQSL::Test::TestPerms eNew;
+                if (bRemap(patSrc[szIndex], eNew))
+                {
+                    patTar[szIndex] = static_cast<unsigned int>(eNew);
+                }
+                else
+                {
+                    patTar[szIndex] = tBad;
+                    szBad++;
+                }
+            }
+            return szBad;
+        }
+    };
+    inline bool bAllEnumBitsOn(const CQSL::Test::TestPerms eTest, const CQSL::Test::TestPerms eBits)
+    {
+        return (static_cast<unsigned int>(eTest) & static_cast<unsigned int>(eBits)) == static_cast<unsigned int>(eBits);
+    }
+    inline bool bAnyEnumBitsOn(const CQSL::Test::TestPerms eTest, const CQSL::Test::TestPerms eBits)
+    {
+        return (static_cast<unsigned int>(eTest) & static_cast<unsigned int>(eBits)) != 0;
+    }
+    constexpr bool bIsValidBits(const CQSL::Test::TestPerms eTest)
+    {
+        return (static_cast<unsigned int>(eTest) & ~static_cast<unsigned int>(CQSL::Test::TestPerms::AllBits)) == 0;
+    }
+    constexpr bool bIsSingleBit(const CQSL::Test::TestPerms eTest)
+    {
+        return (static_cast<unsigned int>(eTest) != 0)
+            && ((static_cast<unsigned int>(eTest) & (static_cast<unsigned int>(eTest) - 1)) == 0)
+            && bIsValidBits(eTest);
+    }
+    inline bool bIsValidBits(const CQSL::Test::TestPerms* const peList, const size_t szCount)
+    {
+        return (CQSL::CQEnum::uOrAllBits(peList, szCount) & ~static_cast<unsigned int>(CQSL::Test::TestPerms::AllBits)) == 0;
+    }
+    inline bool bIsSingleBit(const CQSL::Test::TestPerms* const peList, const size_t szCount)
+    {
+        return CQSL::CQEnum::bAllSingleBits(peList, szCount) && bIsValidBits(peList, szCount);
+    }
+    inline uint32_t uCombinationIndex(const CQSL::Test::TestPerms eBits) noexcept
+    {
+#if defined(CQENUM_BMI2)
+        return _pext_u32(static_cast<uint32_t>(eBits), 0x40001046U);
+#else
+        const uint32_t uBits = static_cast<uint32_t>(eBits);
+        return ((uBits >> 1) & 0x3U)
+            | ((uBits >> 4) & 0x4U)
+            | ((uBits >> 9) & 0x8U)
+            | ((uBits >> 26) & 0x10U);
+#endif
+    }
+    using TestPermsAtomicFlags = CQSL::CQEnum::AtomicFlags<CQSL::Test::TestPerms>;
+
+
+    enum class TestFlags : int
+    {
+          Perm00 = 0
+        , Perm01 = 1
+        , Perm02 = 2
+        , Perm03 = 3
+        , Perm04 = 4
+        , Perm05 = 5
+        , Perm06 = 6
+        , Perm07 = 7
+        , Perm08 = 8
+        , Perm09 = 9
+        , Perm10 = 10
+        , Perm11 = 11
+        , Perm12 = 12
+        , Perm13 = 13
+        , Perm14 = 14
+        , Perm15 = 15
+        , Perm16 = 16
+        , Perm17 = 17
+        , Perm18 = 18
+        , Perm19 = 19
+        , Perm20 = 20
+        , Perm21 = 21
+        , Perm22 = 22
+        , Perm23 = 23
+        , Perm24 = 24
+        , Perm25 = 25
+        , Perm26 = 26
+        , Perm27 = 27
+        , Perm28 = 28
+        , Perm29 = 29
+        , Perm30 = 30
+        , Perm31 = 31
+        , Perm32 = 32
+        , Perm33 = 33
+        , Perm34 = 34
+        , Perm35 = 35
+        , Perm36 = 36
+        , Perm37 = 37
+        , Perm38 = 38
+        , Perm39 = 39
+        , Perm40 = 40
+        , Perm41 = 41
+        , Perm42 = 42
+        , Perm43 = 43
+        , Perm44 = 44
+        , Perm45 = 45
+        , Perm46 = 46
+        , Perm47 = 47
+        , Perm48 = 48
+        , Perm49 = 49
+        , Perm50 = 50
+        , Perm51 = 51
+        , Perm52 = 52
+        , Perm53 = 53
+        , Perm54 = 54
+        , Perm55 = 55
+        , Perm56 = 56
+        , Perm57 = 57
+        , Perm58 = 58
+        , Perm59 = 59
+        , Perm60 = 60
+        , Perm61 = 61
+        , Perm62 = 62
+        , Perm63 = 63
+        , Perm64 = 64
+        , Perm65 = 65
+        , Perm66 = 66
+        , Perm67 = 67
+        , Perm68 = 68
+        , Perm69 = 69
+        , Min = 0
+        , Max = 69
+        , Count = 70
+    };
+    const wchar_t* pszEnumToName(const CQSL::Test::TestFlags eVal);
+    bool bNameToEnum(const std::wstring_view& svText, CQSL::Test::TestFlags& eToFill);
+    std::from_chars_result EnumFromChars(const char* const pszFirst, const char* const pszLast, CQSL::Test::TestFlags& eToFill, const CQSL::CQEnum::EFromChars eRules = CQSL::CQEnum::EFromChars::All);
+    inline bool bIsValidEnumVal(const CQSL::Test::TestFlags eTest)
+    {
+        const bool bRet = ((eTest >= CQSL::Test::TestFlags::Min) && (eTest <= CQSL::Test::TestFlags::Max));
+        CQENUM_LOOKUP(CQSL::Test::TestFlags, IsValid, bRet, 0);
+        return bRet;
+    }
+    constexpr uint32_t uEnumToIndex(const CQSL::Test::TestFlags eVal)
+    {
+        return (static_cast<uint64_t>(eVal) < 70) ? static_cast<uint32_t>(eVal) : 70;
+    }
+    struct TestFlagsSchema
+    {
+        static constexpr uint64_t c_uFingerprint = 0xd9794907662d9b22ULL;
+    };
+    using TestFlagsSet = CQSL::CQEnum::FlagSet<CQSL::Test::TestFlags, 70>;
+
+
+    enum class TestState : int
+    {
+          Idle = 10
+        , Connecting = 20
+        , Connected = 30
+        , Failed = 40
+        , Min = 10
+        , Max = 40
+        , Count = 4
+    };
+    bool bEnumToAltValue(const CQSL::Test::TestState eVal, int32_t& iToFill);
+    bool bEnumFromAltValue(const int32_t iAltVal, CQSL::Test::TestState& eToFill);
+    size_t EnumsToAltValues(const CQSL::Test::TestState* const paeSrc, const size_t szCount, int32_t* const paiTar, uint64_t* const pauInvalid = nullptr);
+    size_t AltValuesToEnums(const int32_t* const paiSrc, const size_t szCount, CQSL::Test::TestState* const paeTar, uint64_t* const pauInvalid = nullptr);
+    const wchar_t* pszEnumToName(const CQSL::Test::TestState eVal);
+    bool bNameToEnum(const std::wstring_view& svText, CQSL::Test::TestState& eToFill);
+    std::from_chars_result EnumFromChars(const char* const pszFirst, const char* const pszLast, CQSL::Test::TestState& eToFill, const CQSL::CQEnum::EFromChars eRules = CQSL::CQEnum::EFromChars::All);
+    bool bIsValidEnumVal(const CQSL::Test::TestState eTest);
+    constexpr uint32_t uEnumToIndex(const CQSL::Test::TestState eVal)
+    {
+        switch(eVal)
+        {
+            case CQSL::Test::TestState::Idle : return 0;
+            case CQSL::Test::TestState::Connecting : return 1;
+            case CQSL::Test::TestState::Connected : return 2;
+            case CQSL::Test::TestState::Failed : return 3;
+            default : break;
+        };
+        return 4;
+    }
+    struct TestStateTransitions
+    {
+        static constexpr uint32_t c_uWords = 1;
+        static constexpr uint64_t s_auMatrix[4][1] =
+        {
+              { 0x2ULL } // Idle
+            , { 0xdULL } // Connecting
+            , { 0x1ULL } // Connected
+            , { 0x1ULL } // Failed
+        };
+    };
+    constexpr bool bCanTransition(const CQSL::Test::TestState eFrom, const CQSL::Test::TestState eTo)
+    {
+        const uint32_t uFrom = uEnumToIndex(eFrom);
+        const uint32_t uTo = uEnumToIndex(eTo);
+        if ((uFrom >= 4) || (uTo >= 4))
+        {
+            return false;
+        }
+        return ((TestStateTransitions::s_auMatrix[uFrom][uTo / 64] >> (uTo % 64)) & 1) != 0;
+    }
+    inline CQSL::CQEnum::SuccessorRange<CQSL::Test::TestState, 1> EnumSuccessors(const CQSL::Test::TestState eFrom)
+    {
+        const uint32_t uFrom = uEnumToIndex(eFrom);
+        return CQSL::CQEnum::SuccessorRange<CQSL::Test::TestState, 1>
+        (
+            (uFrom < 4) ? TestStateTransitions::s_auMatrix[uFrom] : nullptr
+        );
+    }
+    struct TestStateGroups
+    {
+        static constexpr uint32_t c_uWords = 1;
+        static constexpr uint64_t s_auActive[1] = { 0x6ULL };
+        static CQSL::CQEnum::SuccessorRange<CQSL::Test::TestState, 1> Active() noexcept
+        {
+            return CQSL::CQEnum::SuccessorRange<CQSL::Test::TestState, 1>(s_auActive);
+        }
+        static constexpr uint64_t s_auTerminal[1] = { 0x8ULL };
+        static CQSL::CQEnum::SuccessorRange<CQSL::Test::TestState, 1> Terminal() noexcept
+        {
+            return CQSL::CQEnum::SuccessorRange<CQSL::Test::TestState, 1>(s_auTerminal);
+        }
+    };
+    constexpr bool bIsInActive(const CQSL::Test::TestState eTest)
+    {
+        const uint32_t uIndex = uEnumToIndex(eTest);
+        return (uIndex < 4) && (((TestStateGroups::s_auActive[uIndex / 64] >> (uIndex % 64)) & 1) != 0);
+    }
+    constexpr bool bIsInTerminal(const CQSL::Test::TestState eTest)
+    {
+        const uint32_t uIndex = uEnumToIndex(eTest);
+        return (uIndex < 4) && (((TestStateGroups::s_auTerminal[uIndex / 64] >> (uIndex % 64)) & 1) != 0);
+    }
+    using TestStateUnion = CQSL::CQEnum::TaggedUnion
+    <
+        CQSL::Test::TestState
+        , CQSL::CQEnum::NoPayload // Idle
+        , ConnectInfo // Connecting
+        , CQSL::CQEnum::NoPayload // Connected
+        , std::string // Failed
+    >;
+    struct TestStateSchema
+    {
+        static constexpr uint64_t c_uFingerprint = 0x60b4cde6c6644d43ULL;
+        static constexpr uint32_t s_auStableIds[4] =
+        {
+              100 // Idle
+            , 7 // Connecting
+            , 42 // Connected
+            , 3 // Failed
+        };
+        static constexpr uint32_t s_auSortedIds[4] =
+        {
+              3
+            , 7
+            , 42
+            , 100
+        };
+        static constexpr CQSL::Test::TestState s_aeSorted[4] =
+        {
+              CQSL::Test::TestState::Failed
+            , CQSL::Test::TestState::Connecting
+            , CQSL::Test::TestState::Connected
+            , CQSL::Test::TestState::Idle
+        };
+    };
+    constexpr uint32_t uEnumToStableId(const CQSL::Test::TestState eVal)
+    {
+        const uint32_t uIndex = uEnumToIndex(eVal);
+        return (uIndex < 4) ? TestStateSchema::s_auStableIds[uIndex] : 0xFFFFFFFF;
+    }
+    inline bool bStableIdToEnum(const uint32_t uId, CQSL::Test::TestState& eToFill)
+    {
+        const uint32_t* const puEnd = TestStateSchema::s_auSortedIds + 4;
+        const uint32_t* const puFound = std::lower_bound(TestStateSchema::s_auSortedIds, puEnd, uId);
+        if ((puFound == puEnd) || (*puFound != uId))
+        {
+            return false;
+        }
+        eToFill = TestStateSchema::s_aeSorted[puFound - TestStateSchema::s_auSortedIds];
+        return true;
+    }
+    struct TestStateRemap
+    {
+        static constexpr uint64_t c_uFromFingerprint = 0xfcbcb19bac99241fULL;
+        static constexpr uint32_t c_uTableSize = 6;
+        static constexpr int c_tRemoved = 0;
+        static constexpr int s_atTable[6] =
+        {
+              c_tRemoved // Unused
+            , 10 // Idle -> Idle
+            , 20 // Dialing -> Connecting
+            , c_tRemoved // Closed
+            , 30 // Connected -> Connected
+            , 40 // Failed -> Failed
+        };
+
+        static bool bRemap(const int tOld, CQSL::Test::TestState& eToFill) noexcept
+        {
+            if ((static_cast<uint64_t>(tOld) >= c_uTableSize) || (s_atTable[tOld] == c_tRemoved))
+            {
+                return false;
+            }
+            eToFill = static_cast<CQSL::Test::TestState>(s_atTable[tOld]);
+            return true;
+        }
+
+        static size_t szRemap(const int* const patSrc, const size_t szCount, int* const patTar, const int tBad) noexcept
+        {
+            return CQSL::CQEnum::szRemapValues(patSrc, szCount, patTar, s_atTable, c_uTableSize, c_tRemoved, tBad);
+        }
+    };
+
+    struct StateToTestEnumMap
+    {
+        static constexpr CQSL::Test::TestEnum s_aeTable[5] =
+        {
+              CQSL::Test::TestEnum::Value1 // Idle
+            , CQSL::Test::TestEnum::Value1 // Connecting
+            , CQSL::Test::TestEnum::Value2 // Connected
+            , CQSL::Test::TestEnum::Syn1 // Failed
+            , CQSL::Test::TestEnum::Value1 // Invalid source values
+        };
+    };
+    constexpr CQSL::Test::TestEnum StateToTestEnum(const CQSL::Test::TestState eSrc)
+    {
+        const uint32_t uIndex = uEnumToIndex(eSrc);
+        return StateToTestEnumMap::s_aeTable[(uIndex < 4) ? uIndex : 4];
+    }
+
+    struct TestEnumToStateMap
+    {
+        static constexpr CQSL::Test::TestState s_aeTable[4] =
+        {
+              CQSL::Test::TestState::Idle // Value1
+            , CQSL::Test::TestState::Connecting // Value2
+            , CQSL::Test::TestState::Failed // Value3
+            , CQSL::Test::TestState::Idle // Invalid source values
+        };
+    };
+    constexpr CQSL::Test::TestState TestEnumToState(const CQSL::Test::TestEnum eSrc)
+    {
+        const uint32_t uIndex = uEnumToIndex(eSrc);
+        return TestEnumToStateMap::s_aeTable[(uIndex < 3) ? uIndex : 3];
+    }
 
 }};
 
@@ -79,6 +629,84 @@ inline std::wostream& operator<<(std::wostream& out, const CQSL::Test::TestEnum
     out << CQSL::Test::pszEnumToAltText2(eVal);
     return out;
 }
+namespace CQSL { namespace CQEnum {
+template <> struct EnumValueList<CQSL::Test::TestEnum>
+{
+    static constexpr uint32_t c_uCount = 3;
+    static constexpr CQSL::Test::TestEnum s_aeValues[] =
+    {
+          CQSL::Test::TestEnum::Value1
+        , CQSL::Test::TestEnum::Value2
+        , CQSL::Test::TestEnum::Value3
+    };
+};
+template <> struct EnumTraits<CQSL::Test::TestEnum>
+{
+    using EnumType = CQSL::Test::TestEnum;
+    using UnderType = std::underlying_type_t<CQSL::Test::TestEnum>;
+
+    static constexpr EEnumKinds eKind = EEnumKinds::Standard;
+    static constexpr uint32_t c_uCount = 3;
+    static constexpr CQSL::Test::TestEnum eMin = CQSL::Test::TestEnum::Value1;
+    static constexpr CQSL::Test::TestEnum eMax = CQSL::Test::TestEnum::Value3;
+    static constexpr bool bIsMonotonic = true;
+    static constexpr bool bHasText1 = true;
+    static constexpr bool bHasText2 = true;
+    static constexpr bool bHasAltVal = false;
+    static constexpr bool bHasInc = true;
+    static constexpr uint64_t c_uFingerprint = CQSL::Test::TestEnumSchema::c_uFingerprint;
+
+    static const wchar_t* pszToName(const CQSL::Test::TestEnum eVal) { return CQSL::Test::pszEnumToName(eVal); }
+    static bool bFromName(const std::wstring_view& svName, CQSL::Test::TestEnum& eToFill) { return CQSL::Test::bNameToEnum(svName, eToFill); }
+    static std::from_chars_result FromChars(const char* const pszFirst, const char* const pszLast, CQSL::Test::TestEnum& eToFill, const EFromChars eRules) { return CQSL::Test::EnumFromChars(pszFirst, pszLast, eToFill, eRules); }
+    static bool bIsValid(const CQSL::Test::TestEnum eTest) { return CQSL::Test::bIsValidEnumVal(eTest); }
+    static const wchar_t* pszToText1(const CQSL::Test::TestEnum eVal) { return CQSL::Test::pszEnumToAltText1(eVal); }
+    static const wchar_t* pszToText2(const CQSL::Test::TestEnum eVal) { return CQSL::Test::pszEnumToAltText2(eVal); }
+
+    static constexpr const wchar_t* (*pfnToName)(CQSL::Test::TestEnum) = &pszToName;
+    static constexpr bool (*pfnFromName)(const std::wstring_view&, CQSL::Test::TestEnum&) = &bFromName;
+    static constexpr std::from_chars_result (*pfnFromChars)(const char*, const char*, CQSL::Test::TestEnum&, EFromChars) = &FromChars;
+    static constexpr bool (*pfnIsValid)(CQSL::Test::TestEnum) = &bIsValid;
+    static constexpr const wchar_t* (*pfnToText1)(CQSL::Test::TestEnum) = &pszToText1;
+    static constexpr const wchar_t* (*pfnToText2)(CQSL::Test::TestEnum) = &pszToText2;
+    static constexpr bool (*pfnToAltVal)(CQSL::Test::TestEnum, int32_t&) = nullptr;
+    static constexpr bool (*pfnFromAltVal)(int32_t, CQSL::Test::TestEnum&) = nullptr;
+    static constexpr size_t (*pfnToAltVals)(const CQSL::Test::TestEnum*, size_t, int32_t*, uint64_t*) = nullptr;
+    static constexpr size_t (*pfnFromAltVals)(const int32_t*, size_t, CQSL::Test::TestEnum*, uint64_t*) = nullptr;
+};
+template <> struct NameTrie<CQSL::Test::TestEnum>
+{
+    static constexpr NameTrieNode s_anodeTable[] =
+    {
+          { 0, 1, 0, 3, c_uTrieNoName }
+        , { 1, 1, 0, 3, c_uTrieNoName }
+        , { 2, 1, 0, 3, c_uTrieNoName }
+        , { 3, 1, 0, 3, c_uTrieNoName }
+        , { 4, 1, 0, 3, c_uTrieNoName }
+        , { 5, 3, 0, 3, c_uTrieNoName }
+        , { 8, 0, 0, 1, 0 }
+        , { 8, 0, 1, 2, 1 }
+        , { 8, 0, 2, 3, 2 }
+    };
+    static constexpr NameTrieEdge s_aedgeTable[] =
+    {
+          { 'V', 1 }
+        , { 'A', 2 }
+        , { 'L', 3 }
+        , { 'U', 4 }
+        , { 'E', 5 }
+        , { '1', 6 }
+        , { '2', 7 }
+        , { '3', 8 }
+    };
+    static constexpr CQSL::Test::TestEnum s_aeByName[] =
+    {
+          CQSL::Test::TestEnum::Value1
+        , CQSL::Test::TestEnum::Value2
+        , CQSL::Test::TestEnum::Value3
+    };
+};
+}}
 
 
 constexpr CQSL::Test::TestBmp operator|(const CQSL::Test::TestBmp eLHS, const CQSL::Test::TestBmp eRHS)
@@ -103,5 +731,705 @@ constexpr CQSL::Test::TestBmp operator~(const CQSL::Test::TestBmp eTurnOff)
 {
     return static_cast<CQSL::Test::TestBmp>((static_cast<unsigned short>(eTurnOff) ^ 0xFFFFFFFF) & static_cast<unsigned short>(CQSL::Test::TestBmp::AllBits));
 }
+namespace CQSL { namespace CQEnum {
+template <> struct EnumValueList<CQSL::Test::TestBmp>
+{
+    static constexpr uint32_t c_uCount = 3;
+    static constexpr CQSL::Test::TestBmp s_aeValues[] =
+    {
+          CQSL::Test::TestBmp::Value1
+        , CQSL::Test::TestBmp::Value2
+        , CQSL::Test::TestBmp::Value3
+    };
+};
+template <> struct BitmapCombos<CQSL::Test::TestBmp>
+{
+    static constexpr uint32_t c_uBits = 3;
+    static constexpr uint32_t c_uMask = 0x7U;
+};
+template <> struct EnumTraits<CQSL::Test::TestBmp>
+{
+    using EnumType = CQSL::Test::TestBmp;
+    using UnderType = std::underlying_type_t<CQSL::Test::TestBmp>;
+
+    static constexpr EEnumKinds eKind = EEnumKinds::Bitmap;
+    static constexpr uint32_t c_uCount = 3;
+    static constexpr CQSL::Test::TestBmp eMin = CQSL::Test::TestBmp::Value1;
+    static constexpr CQSL::Test::TestBmp eMax = CQSL::Test::TestBmp::Value3;
+    static constexpr bool bIsMonotonic = false;
+    static constexpr bool bHasText1 = true;
+    static constexpr bool bHasText2 = true;
+    static constexpr bool bHasAltVal = true;
+    static constexpr bool bHasInc = false;
+    static constexpr uint64_t c_uFingerprint = CQSL::Test::TestBmpSchema::c_uFingerprint;
+
+    static const wchar_t* pszToName(const CQSL::Test::TestBmp eVal) { return CQSL::Test::pszEnumToName(eVal); }
+    static bool bFromName(const std::wstring_view& svName, CQSL::Test::TestBmp& eToFill) { return CQSL::Test::bNameToEnum(svName, eToFill); }
+    static std::from_chars_result FromChars(const char* const pszFirst, const char* const pszLast, CQSL::Test::TestBmp& eToFill, const EFromChars eRules) { return CQSL::Test::EnumFromChars(pszFirst, pszLast, eToFill, eRules); }
+    static bool bIsValid(const CQSL::Test::TestBmp eTest) { return CQSL::Test::bIsValidEnumVal(eTest); }
+    static const wchar_t* pszToText1(const CQSL::Test::TestBmp eVal) { return CQSL::Test::pszEnumToAltText1(eVal); }
+    static const wchar_t* pszToText2(const CQSL::Test::TestBmp eVal) { return CQSL::Test::pszEnumToAltText2(eVal); }
+    static bool bToAltVal(const CQSL::Test::TestBmp eVal, int32_t& iToFill) { return CQSL::Test::bEnumToAltValue(eVal, iToFill); }
+    static bool bFromAltVal(const int32_t iAltVal, CQSL::Test::TestBmp& eToFill) { return CQSL::Test::bEnumFromAltValue(iAltVal, eToFill); }
+    static size_t szToAltVals(const CQSL::Test::TestBmp* const paeSrc, const size_t szCount, int32_t* const paiTar, uint64_t* const pauInvalid) { return CQSL::Test::EnumsToAltValues(paeSrc, szCount, paiTar, pauInvalid); }
+    static size_t szFromAltVals(const int32_t* const paiSrc, const size_t szCount, CQSL::Test::TestBmp* const paeTar, uint64_t* const pauInvalid) { return CQSL::Test::AltValuesToEnums(paiSrc, szCount, paeTar, pauInvalid); }
+
+    static constexpr const wchar_t* (*pfnToName)(CQSL::Test::TestBmp) = &pszToName;
+    static constexpr bool (*pfnFromName)(const std::wstring_view&, CQSL::Test::TestBmp&) = &bFromName;
+    static constexpr std::from_chars_result (*pfnFromChars)(const char*, const char*, CQSL::Test::TestBmp&, EFromChars) = &FromChars;
+    static constexpr bool (*pfnIsValid)(CQSL::Test::TestBmp) = &bIsValid;
+    static constexpr const wchar_t* (*pfnToText1)(CQSL::Test::TestBmp) = &pszToText1;
+    static constexpr const wchar_t* (*pfnToText2)(CQSL::Test::TestBmp) = &pszToText2;
+    static constexpr bool (*pfnToAltVal)(CQSL::Test::TestBmp, int32_t&) = &bToAltVal;
+    static constexpr bool (*pfnFromAltVal)(int32_t, CQSL::Test::TestBmp&) = &bFromAltVal;
+    static constexpr size_t (*pfnToAltVals)(const CQSL::Test::TestBmp*, size_t, int32_t*, uint64_t*) = &szToAltVals;
+    static constexpr size_t (*pfnFromAltVals)(const int32_t*, size_t, CQSL::Test::TestBmp*, uint64_t*) = &szFromAltVals;
+};
+template <> struct NameTrie<CQSL::Test::TestBmp>
+{
+    static constexpr NameTrieNode s_anodeTable[] =
+    {
+          { 0, 1, 0, 3, c_uTrieNoName }
+        , { 1, 1, 0, 3, c_uTrieNoName }
+        , { 2, 1, 0, 3, c_uTrieNoName }
+        , { 3, 1, 0, 3, c_uTrieNoName }
+        , { 4, 1, 0, 3, c_uTrieNoName }
+        , { 5, 3, 0, 3, c_uTrieNoName }
+        , { 8, 0, 0, 1, 0 }
+        , { 8, 0, 1, 2, 1 }
+        , { 8, 0, 2, 3, 2 }
+    };
+    static constexpr NameTrieEdge s_aedgeTable[] =
+    {
+          { 'V', 1 }
+        , { 'A', 2 }
+        , { 'L', 3 }
+        , { 'U', 4 }
+        , { 'E', 5 }
+        , { '1', 6 }
+        , { '2', 7 }
+        , { '3', 8 }
+    };
+    static constexpr CQSL::Test::TestBmp s_aeByName[] =
+    {
+          CQSL::Test::TestBmp::Value1
+        , CQSL::Test::TestBmp::Value2
+        , CQSL::Test::TestBmp::Value3
+    };
+};
+}}
+
+
+constexpr CQSL::Test::TestPerms operator|(const CQSL::Test::TestPerms eLHS, const CQSL::Test::TestPerms eRHS)
+{
+    return static_cast<CQSL::Test::TestPerms>(static_cast<unsigned int>(eLHS) | static_cast<unsigned int>(eRHS));
+}
+constexpr CQSL::Test::TestPerms operator&(const CQSL::Test::TestPerms eLHS, const CQSL::Test::TestPerms eRHS)
+{
+    return static_cast<CQSL::Test::TestPerms>(static_cast<unsigned int>(eLHS) & static_cast<unsigned int>(eRHS));
+}
+constexpr CQSL::Test::TestPerms operator|=(CQSL::Test::TestPerms& eLHS, const CQSL::Test::TestPerms eRHS)
+{
+    eLHS = static_cast<CQSL::Test::TestPerms>(static_cast<unsigned int>(eLHS) | static_cast<unsigned int>(eRHS));
+    return eLHS;
+}
+constexpr CQSL::Test::TestPerms operator&=(CQSL::Test::TestPerms& eLHS, const CQSL::Test::TestPerms eRHS)
+{
+    eLHS = static_cast<CQSL::Test::TestPerms>(static_cast<unsigned int>(eLHS) & static_cast<unsigned int>(eRHS));
+    return eLHS;
+}
+constexpr CQSL::Test::TestPerms operator~(const CQSL::Test::TestPerms eTurnOff)
+{
+    return static_cast<CQSL::Test::TestPerms>((static_cast<unsigned int>(eTurnOff) ^ 0xFFFFFFFF) & static_cast<unsigned int>(CQSL::Test::TestPerms::AllBits));
+}
+namespace CQSL { namespace CQEnum {
+template <> struct EnumValueList<CQSL::Test::TestPerms>
+{
+    static constexpr uint32_t c_uCount = 5;
+    static constexpr CQSL::Test::TestPerms s_aeValues[] =
+    {
+          CQSL::Test::TestPerms::Read
+        , CQSL::Test::TestPerms::Write
+        , CQSL::Test::TestPerms::Exec
+        , CQSL::Test::TestPerms::Hidden
+        , CQSL::Test::TestPerms::Locked
+    };
+};
+template <> struct BitmapCombos<CQSL::Test::TestPerms>
+{
+    static constexpr uint32_t c_uBits = 5;
+    static constexpr uint32_t c_uMask = 0x40001046U;
+};
+template <> struct EnumTraits<CQSL::Test::TestPerms>
+{
+    using EnumType = CQSL::Test::TestPerms;
+    using UnderType = std::underlying_type_t<CQSL::Test::TestPerms>;
+
+    static constexpr EEnumKinds eKind = EEnumKinds::Bitmap;
+    static constexpr uint32_t c_uCount = 5;
+    static constexpr CQSL::Test::TestPerms eMin = CQSL::Test::TestPerms::Read;
+    static constexpr CQSL::Test::TestPerms eMax = CQSL::Test::TestPerms::Locked;
+    static constexpr bool bIsMonotonic = false;
+    static constexpr bool bHasText1 = false;
+    static constexpr bool bHasText2 = false;
+    static constexpr bool bHasAltVal = false;
+    static constexpr bool bHasInc = false;
+    static constexpr uint64_t c_uFingerprint = CQSL::Test::TestPermsSchema::c_uFingerprint;
+
+    static const wchar_t* pszToName(const CQSL::Test::TestPerms eVal) { return CQSL::Test::pszEnumToName(eVal); }
+    static bool bFromName(const std::wstring_view& svName, CQSL::Test::TestPerms& eToFill) { return CQSL::Test::bNameToEnum(svName, eToFill); }
+    static std::from_chars_result FromChars(const char* const pszFirst, const char* const pszLast, CQSL::Test::TestPerms& eToFill, const EFromChars eRules) { return CQSL::Test::EnumFromChars(pszFirst, pszLast, eToFill, eRules); }
+    static bool bIsValid(const CQSL::Test::TestPerms eTest) { return CQSL::Test::bIsValidEnumVal(eTest); }
+
+    static constexpr const wchar_t* (*pfnToName)(CQSL::Test::TestPerms) = &pszToName;
+    static constexpr bool (*pfnFromName)(const std::wstring_view&, CQSL::Test::TestPerms&) = &bFromName;
+    static constexpr std::from_chars_result (*pfnFromChars)(const char*, const char*, CQSL::Test::TestPerms&, EFromChars) = &FromChars;
+    static constexpr bool (*pfnIsValid)(CQSL::Test::TestPerms) = &bIsValid;
+    static constexpr const wchar_t* (*pfnToText1)(CQSL::Test::TestPerms) = nullptr;
+    static constexpr const wchar_t* (*pfnToText2)(CQSL::Test::TestPerms) = nullptr;
+    static constexpr bool (*pfnToAltVal)(CQSL::Test::TestPerms, int32_t&) = nullptr;
+    static constexpr bool (*pfnFromAltVal)(int32_t, CQSL::Test::TestPerms&) = nullptr;
+    static constexpr size_t (*pfnToAltVals)(const CQSL::Test::TestPerms*, size_t, int32_t*, uint64_t*) = nullptr;
+    static constexpr size_t (*pfnFromAltVals)(const int32_t*, size_t, CQSL::Test::TestPerms*, uint64_t*) = nullptr;
+};
+template <> struct NameTrie<CQSL::Test::TestPerms>
+{
+    static constexpr NameTrieNode s_anodeTable[] =
+    {
+          { 0, 5, 0, 5, c_uTrieNoName }
+        , { 5, 1, 0, 1, c_uTrieNoName }
+        , { 6, 1, 0, 1, c_uTrieNoName }
+        , { 7, 1, 0, 1, c_uTrieNoName }
+        , { 8, 0, 0, 1, 0 }
+        , { 8, 1, 1, 2, c_uTrieNoName }
+        , { 9, 1, 1, 2, c_uTrieNoName }
+        , { 10, 1, 1, 2, c_uTrieNoName }
+        , { 11, 1, 1, 2, c_uTrieNoName }
+        , { 12, 1, 1, 2, c_uTrieNoName }
+        , { 13, 0, 1, 2, 1 }
+        , { 13, 1, 2, 3, c_uTrieNoName }
+        , { 14, 1, 2, 3, c_uTrieNoName }
+        , { 15, 1, 2, 3, c_uTrieNoName }
+        , { 16, 1, 2, 3, c_uTrieNoName }
+        , { 17, 1, 2, 3, c_uTrieNoName }
+        , { 18, 0, 2, 3, 2 }
+        , { 18, 1, 3, 4, c_uTrieNoName }
+        , { 19, 1, 3, 4, c_uTrieNoName }
+        , { 20, 1, 3, 4, c_uTrieNoName }
+        , { 21, 0, 3, 4, 3 }
+        , { 21, 1, 4, 5, c_uTrieNoName }
+        , { 22, 1, 4, 5, c_uTrieNoName }
+        , { 23, 1, 4, 5, c_uTrieNoName }
+        , { 24, 1, 4, 5, c_uTrieNoName }
+        , { 25, 0, 4, 5, 4 }
+    };
+    static constexpr NameTrieEdge s_aedgeTable[] =
+    {
+          { 'E', 1 }
+        , { 'H', 5 }
+        , { 'L', 11 }
+        , { 'R', 17 }
+        , { 'W', 21 }
+        , { 'X', 2 }
+        , { 'E', 3 }
+        , { 'C', 4 }
+        , { 'I', 6 }
+        , { 'D', 7 }
+        , { 'D', 8 }
+        , { 'E', 9 }
+        , { 'N', 10 }
+        , { 'O', 12 }
+        , { 'C', 13 }
+        , { 'K', 14 }
+        , { 'E', 15 }
+        , { 'D', 16 }
+        , { 'E', 18 }
+        , { 'A', 19 }
+        , { 'D', 20 }
+        , { 'R', 22 }
+        , { 'I', 23 }
+        , { 'T', 24 }
+        , { 'E', 25 }
+    };
+    static constexpr CQSL::Test::TestPerms s_aeByName[] =
+    {
+          CQSL::Test::TestPerms::Exec
+        , CQSL::Test::TestPerms::Hidden
+        , CQSL::Test::TestPerms::Locked
+        , CQSL::Test::TestPerms::Read
+        , CQSL::Test::TestPerms::Write
+    };
+};
+}}
+
+
+namespace CQSL { namespace CQEnum {
+template <> struct EnumValueList<CQSL::Test::TestFlags>
+{
+    static constexpr uint32_t c_uCount = 70;
+    static constexpr CQSL::Test::TestFlags s_aeValues[] =
+    {
+          CQSL::Test::TestFlags::Perm00
+        , CQSL::Test::TestFlags::Perm01
+        , CQSL::Test::TestFlags::Perm02
+        , CQSL::Test::TestFlags::Perm03
+        , CQSL::Test::TestFlags::Perm04
+        , CQSL::Test::TestFlags::Perm05
+        , CQSL::Test::TestFlags::Perm06
+        , CQSL::Test::TestFlags::Perm07
+        , CQSL::Test::TestFlags::Perm08
+        , CQSL::Test::TestFlags::Perm09
+        , CQSL::Test::TestFlags::Perm10
+        , CQSL::Test::TestFlags::Perm11
+        , CQSL::Test::TestFlags::Perm12
+        , CQSL::Test::TestFlags::Perm13
+        , CQSL::Test::TestFlags::Perm14
+        , CQSL::Test::TestFlags::Perm15
+        , CQSL::Test::TestFlags::Perm16
+        , CQSL::Test::TestFlags::Perm17
+        , CQSL::Test::TestFlags::Perm18
+        , CQSL::Test::TestFlags::Perm19
+        , CQSL::Test::TestFlags::Perm20
+        , CQSL::Test::TestFlags::Perm21
+        , CQSL::Test::TestFlags::Perm22
+        , CQSL::Test::TestFlags::Perm23
+        , CQSL::Test::TestFlags::Perm24
+        , CQSL::Test::TestFlags::Perm25
+        , CQSL::Test::TestFlags::Perm26
+        , CQSL::Test::TestFlags::Perm27
+        , CQSL::Test::TestFlags::Perm28
+        , CQSL::Test::TestFlags::Perm29
+        , CQSL::Test::TestFlags::Perm30
+        , CQSL::Test::TestFlags::Perm31
+        , CQSL::Test::TestFlags::Perm32
+        , CQSL::Test::TestFlags::Perm33
+        , CQSL::Test::TestFlags::Perm34
+        , CQSL::Test::TestFlags::Perm35
+        , CQSL::Test::TestFlags::Perm36
+        , CQSL::Test::TestFlags::Perm37
+        , CQSL::Test::TestFlags::Perm38
+        , CQSL::Test::TestFlags::Perm39
+        , CQSL::Test::TestFlags::Perm40
+        , CQSL::Test::TestFlags::Perm41
+        , CQSL::Test::TestFlags::Perm42
+        , CQSL::Test::TestFlags::Perm43
+        , CQSL::Test::TestFlags::Perm44
+        , CQSL::Test::TestFlags::Perm45
+        , CQSL::Test::TestFlags::Perm46
+        , CQSL::Test::TestFlags::Perm47
+        , CQSL::Test::TestFlags::Perm48
+        , CQSL::Test::TestFlags::Perm49
+        , CQSL::Test::TestFlags::Perm50
+        , CQSL::Test::TestFlags::Perm51
+        , CQSL::Test::TestFlags::Perm52
+        , CQSL::Test::TestFlags::Perm53
+        , CQSL::Test::TestFlags::Perm54
+        , CQSL::Test::TestFlags::Perm55
+        , CQSL::Test::TestFlags::Perm56
+        , CQSL::Test::TestFlags::Perm57
+        , CQSL::Test::TestFlags::Perm58
+        , CQSL::Test::TestFlags::Perm59
+        , CQSL::Test::TestFlags::Perm60
+        , CQSL::Test::TestFlags::Perm61
+        , CQSL::Test::TestFlags::Perm62
+        , CQSL::Test::TestFlags::Perm63
+        , CQSL::Test::TestFlags::Perm64
+        , CQSL::Test::TestFlags::Perm65
+        , CQSL::Test::TestFlags::Perm66
+        , CQSL::Test::TestFlags::Perm67
+        , CQSL::Test::TestFlags::Perm68
+        , CQSL::Test::TestFlags::Perm69
+    };
+};
+template <> struct EnumTraits<CQSL::Test::TestFlags>
+{
+    using EnumType = CQSL::Test::TestFlags;
+    using UnderType = std::underlying_type_t<CQSL::Test::TestFlags>;
+
+    static constexpr EEnumKinds eKind = EEnumKinds::FlagSet;
+    static constexpr uint32_t c_uCount = 70;
+    static constexpr CQSL::Test::TestFlags eMin = CQSL::Test::TestFlags::Perm00;
+    static constexpr CQSL::Test::TestFlags eMax = CQSL::Test::TestFlags::Perm69;
+    static constexpr bool bIsMonotonic = true;
+    static constexpr bool bHasText1 = false;
+    static constexpr bool bHasText2 = false;
+    static constexpr bool bHasAltVal = false;
+    static constexpr bool bHasInc = false;
+    static constexpr uint64_t c_uFingerprint = CQSL::Test::TestFlagsSchema::c_uFingerprint;
+
+    static const wchar_t* pszToName(const CQSL::Test::TestFlags eVal) { return CQSL::Test::pszEnumToName(eVal); }
+    static bool bFromName(const std::wstring_view& svName, CQSL::Test::TestFlags& eToFill) { return CQSL::Test::bNameToEnum(svName, eToFill); }
+    static std::from_chars_result FromChars(const char* const pszFirst, const char* const pszLast, CQSL::Test::TestFlags& eToFill, const EFromChars eRules) { return CQSL::Test::EnumFromChars(pszFirst, pszLast, eToFill, eRules); }
+    static bool bIsValid(const CQSL::Test::TestFlags eTest) { return CQSL::Test::bIsValidEnumVal(eTest); }
+
+    static constexpr const wchar_t* (*pfnToName)(CQSL::Test::TestFlags) = &pszToName;
+    static constexpr bool (*pfnFromName)(const std::wstring_view&, CQSL::Test::TestFlags&) = &bFromName;
+    static constexpr std::from_chars_result (*pfnFromChars)(const char*, const char*, CQSL::Test::TestFlags&, EFromChars) = &FromChars;
+    static constexpr bool (*pfnIsValid)(CQSL::Test::TestFlags) = &bIsValid;
+    static constexpr const wchar_t* (*pfnToText1)(CQSL::Test::TestFlags) = nullptr;
+    static constexpr const wchar_t* (*pfnToText2)(CQSL::Test::TestFlags) = nullptr;
+    static constexpr bool (*pfnToAltVal)(CQSL::Test::TestFlags, int32_t&) = nullptr;
+    static constexpr bool (*pfnFromAltVal)(int32_t, CQSL::Test::TestFlags&) = nullptr;
+    static constexpr size_t (*pfnToAltVals)(const CQSL::Test::TestFlags*, size_t, int32_t*, uint64_t*) = nullptr;
+    static constexpr size_t (*pfnFromAltVals)(const int32_t*, size_t, CQSL::Test::TestFlags*, uint64_t*) = nullptr;
+};
+template <> struct NameTrie<CQSL::Test::TestFlags>
+{
+    static constexpr NameTrieNode s_anodeTable[] =
+    {
+          { 0, 1, 0, 70, c_uTrieNoName }
+        , { 1, 1, 0, 70, c_uTrieNoName }
+        , { 2, 1, 0, 70, c_uTrieNoName }
+        , { 3, 1, 0, 70, c_uTrieNoName }
+        , { 4, 7, 0, 70, c_uTrieNoName }
+        , { 11, 10, 0, 10, c_uTrieNoName }
+        , { 21, 0, 0, 1, 0 }
+        , { 21, 0, 1, 2, 1 }
+        , { 21, 0, 2, 3, 2 }
+        , { 21, 0, 3, 4, 3 }
+        , { 21, 0, 4, 5, 4 }
+        , { 21, 0, 5, 6, 5 }
+        , { 21, 0, 6, 7, 6 }
+        , { 21, 0, 7, 8, 7 }
+        , { 21, 0, 8, 9, 8 }
+        , { 21, 0, 9, 10, 9 }
+        , { 21, 10, 10, 20, c_uTrieNoName }
+        , { 31, 0, 10, 11, 10 }
+        , { 31, 0, 11, 12, 11 }
+        , { 31, 0, 12, 13, 12 }
+        , { 31, 0, 13, 14, 13 }
+        , { 31, 0, 14, 15, 14 }
+        , { 31, 0, 15, 16, 15 }
+        , { 31, 0, 16, 17, 16 }
+        , { 31, 0, 17, 18, 17 }
+        , { 31, 0, 18, 19, 18 }
+        , { 31, 0, 19, 20, 19 }
+        , { 31, 10, 20, 30, c_uTrieNoName }
+        , { 41, 0, 20, 21, 20 }
+        , { 41, 0, 21, 22, 21 }
+        , { 41, 0, 22, 23, 22 }
+        , { 41, 0, 23, 24, 23 }
+        , { 41, 0, 24, 25, 24 }
+        , { 41, 0, 25, 26, 25 }
+        , { 41, 0, 26, 27, 26 }
+        , { 41, 0, 27, 28, 27 }
+        , { 41, 0, 28, 29, 28 }
+        , { 41, 0, 29, 30, 29 }
+        , { 41, 10, 30, 40, c_uTrieNoName }
+        , { 51, 0, 30, 31, 30 }
+        , { 51, 0, 31, 32, 31 }
+        , { 51, 0, 32, 33, 32 }
+        , { 51, 0, 33, 34, 33 }
+        , { 51, 0, 34, 35, 34 }
+        , { 51, 0, 35, 36, 35 }
+        , { 51, 0, 36, 37, 36 }
+        , { 51, 0, 37, 38, 37 }
+        , { 51, 0, 38, 39, 38 }
+        , { 51, 0, 39, 40, 39 }
+        , { 51, 10, 40, 50, c_uTrieNoName }
+        , { 61, 0, 40, 41, 40 }
+        , { 61, 0, 41, 42, 41 }
+        , { 61, 0, 42, 43, 42 }
+        , { 61, 0, 43, 44, 43 }
+        , { 61, 0, 44, 45, 44 }
+        , { 61, 0, 45, 46, 45 }
+        , { 61, 0, 46, 47, 46 }
+        , { 61, 0, 47, 48, 47 }
+        , { 61, 0, 48, 49, 48 }
+        , { 61, 0, 49, 50, 49 }
+        , { 61, 10, 50, 60, c_uTrieNoName }
+        , { 71, 0, 50, 51, 50 }
+        , { 71, 0, 51, 52, 51 }
+        , { 71, 0, 52, 53, 52 }
+        , { 71, 0, 53, 54, 53 }
+        , { 71, 0, 54, 55, 54 }
+        , { 71, 0, 55, 56, 55 }
+        , { 71, 0, 56, 57, 56 }
+        , { 71, 0, 57, 58, 57 }
+        , { 71, 0, 58, 59, 58 }
+        , { 71, 0, 59, 60, 59 }
+        , { 71, 10, 60, 70, c_uTrieNoName }
+        , { 81, 0, 60, 61, 60 }
+        , { 81, 0, 61, 62, 61 }
+        , { 81, 0, 62, 63, 62 }
+        , { 81, 0, 63, 64, 63 }
+        , { 81, 0, 64, 65, 64 }
+        , { 81, 0, 65, 66, 65 }
+        , { 81, 0, 66, 67, 66 }
+        , { 81, 0, 67, 68, 67 }
+        , { 81, 0, 68, 69, 68 }
+        , { 81, 0, 69, 70, 69 }
+    };
+    static constexpr NameTrieEdge s_aedgeTable[] =
+    {
+          { 'P', 1 }
+        , { 'E', 2 }
+        , { 'R', 3 }
+        , { 'M', 4 }
+        , { '0', 5 }
+        , { '1', 16 }
+        , { '2', 27 }
+        , { '3', 38 }
+        , { '4', 49 }
+        , { '5', 60 }
+        , { '6', 71 }
+        , { '0', 6 }
+        , { '1', 7 }
+        , { '2', 8 }
+        , { '3', 9 }
+        , { '4', 10 }
+        , { '5', 11 }
+        , { '6', 12 }
+        , { '7', 13 }
+        , { '8', 14 }
+        , { '9', 15 }
+        , { '0', 17 }
+        , { '1', 18 }
+        , { '2', 19 }
+        , { '3', 20 }
+        , { '4', 21 }
+        , { '5', 22 }
+        , { '6', 23 }
+        , { '7', 24 }
+        , { '8', 25 }
+        , { '9', 26 }
+        , { '0', 28 }
+        , { '1', 29 }
+        , { '2', 30 }
+        , { '3', 31 }
+        , { '4', 32 }
+        , { '5', 33 }
+        , { '6', 34 }
+        , { '7', 35 }
+        , { '8', 36 }
+        , { '9', 37 }
+        , { '0', 39 }
+        , { '1', 40 }
+        , { '2', 41 }
+        , { '3', 42 }
+        , { '4', 43 }
+        , { '5', 44 }
+        , { '6', 45 }
+        , { '7', 46 }
+        , { '8', 47 }
+        , { '9', 48 }
+        , { '0', 50 }
+        , { '1', 51 }
+        , { '2', 52 }
+        , { '3', 53 }
+        , { '4', 54 }
+        , { '5', 55 }
+        , { '6', 56 }
+        , { '7', 57 }
+        , { '8', 58 }
+        , { '9', 59 }
+        , { '0', 61 }
+        , { '1', 62 }
+        , { '2', 63 }
+        , { '3', 64 }
+        , { '4', 65 }
+        , { '5', 66 }
+        , { '6', 67 }
+        , { '7', 68 }
+        , { '8', 69 }
+        , { '9', 70 }
+        , { '0', 72 }
+        , { '1', 73 }
+        , { '2', 74 }
+        , { '3', 75 }
+        , { '4', 76 }
+        , { '5', 77 }
+        , { '6', 78 }
+        , { '7', 79 }
+        , { '8', 80 }
+        , { '9', 81 }
+    };
+    static constexpr CQSL::Test::TestFlags s_aeByName[] =
+    {
+          CQSL::Test::TestFlags::Perm00
+        , CQSL::Test::TestFlags::Perm01
+        , CQSL::Test::TestFlags::Perm02
+        , CQSL::Test::TestFlags::Perm03
+        , CQSL::Test::TestFlags::Perm04
+        , CQSL::Test::TestFlags::Perm05
+        , CQSL::Test::TestFlags::Perm06
+        , CQSL::Test::TestFlags::Perm07
+        , CQSL::Test::TestFlags::Perm08
+        , CQSL::Test::TestFlags::Perm09
+        , CQSL::Test::TestFlags::Perm10
+        , CQSL::Test::TestFlags::Perm11
+        , CQSL::Test::TestFlags::Perm12
+        , CQSL::Test::TestFlags::Perm13
+        , CQSL::Test::TestFlags::Perm14
+        , CQSL::Test::TestFlags::Perm15
+        , CQSL::Test::TestFlags::Perm16
+        , CQSL::Test::TestFlags::Perm17
+        , CQSL::Test::TestFlags::Perm18
+        , CQSL::Test::TestFlags::Perm19
+        , CQSL::Test::TestFlags::Perm20
+        , CQSL::Test::TestFlags::Perm21
+        , CQSL::Test::TestFlags::Perm22
+        , CQSL::Test::TestFlags::Perm23
+        , CQSL::Test::TestFlags::Perm24
+        , CQSL::Test::TestFlags::Perm25
+        , CQSL::Test::TestFlags::Perm26
+        , CQSL::Test::TestFlags::Perm27
+        , CQSL::Test::TestFlags::Perm28
+        , CQSL::Test::TestFlags::Perm29
+        , CQSL::Test::TestFlags::Perm30
+        , CQSL::Test::TestFlags::Perm31
+        , CQSL::Test::TestFlags::Perm32
+        , CQSL::Test::TestFlags::Perm33
+        , CQSL::Test::TestFlags::Perm34
+        , CQSL::Test::TestFlags::Perm35
+        , CQSL::Test::TestFlags::Perm36
+        , CQSL::Test::TestFlags::Perm37
+        , CQSL::Test::TestFlags::Perm38
+        , CQSL::Test::TestFlags::Perm39
+        , CQSL::Test::TestFlags::Perm40
+        , CQSL::Test::TestFlags::Perm41
+        , CQSL::Test::TestFlags::Perm42
+        , CQSL::Test::TestFlags::Perm43
+        , CQSL::Test::TestFlags::Perm44
+        , CQSL::Test::TestFlags::Perm45
+        , CQSL::Test::TestFlags::Perm46
+        , CQSL::Test::TestFlags::Perm47
+        , CQSL::Test::TestFlags::Perm48
+        , CQSL::Test::TestFlags::Perm49
+        , CQSL::Test::TestFlags::Perm50
+        , CQSL::Test::TestFlags::Perm51
+        , CQSL::Test::TestFlags::Perm52
+        , CQSL::Test::TestFlags::Perm53
+        , CQSL::Test::TestFlags::Perm54
+        , CQSL::Test::TestFlags::Perm55
+        , CQSL::Test::TestFlags::Perm56
+        , CQSL::Test::TestFlags::Perm57
+        , CQSL::Test::TestFlags::Perm58
+        , CQSL::Test::TestFlags::Perm59
+        , CQSL::Test::TestFlags::Perm60
+        , CQSL::Test::TestFlags::Perm61
+        , CQSL::Test::TestFlags::Perm62
+        , CQSL::Test::TestFlags::Perm63
+        , CQSL::Test::TestFlags::Perm64
+        , CQSL::Test::TestFlags::Perm65
+        , CQSL::Test::TestFlags::Perm66
+        , CQSL::Test::TestFlags::Perm67
+        , CQSL::Test::TestFlags::Perm68
+        , CQSL::Test::TestFlags::Perm69
+    };
+};
+}}
+
+
+namespace CQSL { namespace CQEnum {
+template <> struct EnumValueList<CQSL::Test::TestState>
+{
+    static constexpr uint32_t c_uCount = 4;
+    static constexpr CQSL::Test::TestState s_aeValues[] =
+    {
+          CQSL::Test::TestState::Idle
+        , CQSL::Test::TestState::Connecting
+        , CQSL::Test::TestState::Connected
+        , CQSL::Test::TestState::Failed
+    };
+};
+template <> struct EnumTraits<CQSL::Test::TestState>
+{
+    using EnumType = CQSL::Test::TestState;
+    using UnderType = std::underlying_type_t<CQSL::Test::TestState>;
+
+    static constexpr EEnumKinds eKind = EEnumKinds::Arbitrary;
+    static constexpr uint32_t c_uCount = 4;
+    static constexpr CQSL::Test::TestState eMin = CQSL::Test::TestState::Idle;
+    static constexpr CQSL::Test::TestState eMax = CQSL::Test::TestState::Failed;
+    static constexpr bool bIsMonotonic = false;
+    static constexpr bool bHasText1 = false;
+    static constexpr bool bHasText2 = false;
+    static constexpr bool bHasAltVal = true;
+    static constexpr bool bHasInc = false;
+    static constexpr uint64_t c_uFingerprint = CQSL::Test::TestStateSchema::c_uFingerprint;
+
+    static const wchar_t* pszToName(const CQSL::Test::TestState eVal) { return CQSL::Test::pszEnumToName(eVal); }
+    static bool bFromName(const std::wstring_view& svName, CQSL::Test::TestState& eToFill) { return CQSL::Test::bNameToEnum(svName, eToFill); }
+    static std::from_chars_result FromChars(const char* const pszFirst, const char* const pszLast, CQSL::Test::TestState& eToFill, const EFromChars eRules) { return CQSL::Test::EnumFromChars(pszFirst, pszLast, eToFill, eRules); }
+    static bool bIsValid(const CQSL::Test::TestState eTest) { return CQSL::Test::bIsValidEnumVal(eTest); }
+    static bool bToAltVal(const CQSL::Test::TestState eVal, int32_t& iToFill) { return CQSL::Test::bEnumToAltValue(eVal, iToFill); }
+    static bool bFromAltVal(const int32_t iAltVal, CQSL::Test::TestState& eToFill) { return CQSL::Test::bEnumFromAltValue(iAltVal, eToFill); }
+    static size_t szToAltVals(const CQSL::Test::TestState* const paeSrc, const size_t szCount, int32_t* const paiTar, uint64_t* const pauInvalid) { return CQSL::Test::EnumsToAltValues(paeSrc, szCount, paiTar, pauInvalid); }
+    static size_t szFromAltVals(const int32_t* const paiSrc, const size_t szCount, CQSL::Test::TestState* const paeTar, uint64_t* const pauInvalid) { return CQSL::Test::AltValuesToEnums(paiSrc, szCount, paeTar, pauInvalid); }
+
+    static constexpr const wchar_t* (*pfnToName)(CQSL::Test::TestState) = &pszToName;
+    static constexpr bool (*pfnFromName)(const std::wstring_view&, CQSL::Test::TestState&) = &bFromName;
+    static constexpr std::from_chars_result (*pfnFromChars)(const char*, const char*, CQSL::Test::TestState&, EFromChars) = &FromChars;
+    static constexpr bool (*pfnIsValid)(CQSL::Test::TestState) = &bIsValid;
+    static constexpr const wchar_t* (*pfnToText1)(CQSL::Test::TestState) = nullptr;
+    static constexpr const wchar_t* (*pfnToText2)(CQSL::Test::TestState) = nullptr;
+    static constexpr bool (*pfnToAltVal)(CQSL::Test::TestState, int32_t&) = &bToAltVal;
+    static constexpr bool (*pfnFromAltVal)(int32_t, CQSL::Test::TestState&) = &bFromAltVal;
+    static constexpr size_t (*pfnToAltVals)(const CQSL::Test::TestState*, size_t, int32_t*, uint64_t*) = &szToAltVals;
+    static constexpr size_t (*pfnFromAltVals)(const int32_t*, size_t, CQSL::Test::TestState*, uint64_t*) = &szFromAltVals;
+};
+template <> struct NameTrie<CQSL::Test::TestState>
+{
+    static constexpr NameTrieNode s_anodeTable[] =
+    {
+          { 0, 3, 0, 4, c_uTrieNoName }
+        , { 3, 1, 0, 2, c_uTrieNoName }
+        , { 4, 1, 0, 2, c_uTrieNoName }
+        , { 5, 1, 0, 2, c_uTrieNoName }
+        , { 6, 1, 0, 2, c_uTrieNoName }
+        , { 7, 1, 0, 2, c_uTrieNoName }
+        , { 8, 1, 0, 2, c_uTrieNoName }
+        , { 9, 2, 0, 2, c_uTrieNoName }
+        , { 11, 1, 0, 1, c_uTrieNoName }
+        , { 12, 0, 0, 1, 0 }
+        , { 12, 1, 1, 2, c_uTrieNoName }
+        , { 13, 1, 1, 2, c_uTrieNoName }
+        , { 14, 0, 1, 2, 1 }
+        , { 14, 1, 2, 3, c_uTrieNoName }
+        , { 15, 1, 2, 3, c_uTrieNoName }
+        , { 16, 1, 2, 3, c_uTrieNoName }
+        , { 17, 1, 2, 3, c_uTrieNoName }
+        , { 18, 1, 2, 3, c_uTrieNoName }
+        , { 19, 0, 2, 3, 2 }
+        , { 19, 1, 3, 4, c_uTrieNoName }
+        , { 20, 1, 3, 4, c_uTrieNoName }
+        , { 21, 1, 3, 4, c_uTrieNoName }
+        , { 22, 0, 3, 4, 3 }
+    };
+    static constexpr NameTrieEdge s_aedgeTable[] =
+    {
+          { 'C', 1 }
+        , { 'F', 13 }
+        , { 'I', 19 }
+        , { 'O', 2 }
+        , { 'N', 3 }
+        , { 'N', 4 }
+        , { 'E', 5 }
+        , { 'C', 6 }
+        , { 'T', 7 }
+        , { 'E', 8 }
+        , { 'I', 10 }
+        , { 'D', 9 }
+        , { 'N', 11 }
+        , { 'G', 12 }
+        , { 'A', 14 }
+        , { 'I', 15 }
+        , { 'L', 16 }
+        , { 'E', 17 }
+        , { 'D', 18 }
+        , { 'D', 20 }
+        , { 'L', 21 }
+        , { 'E', 22 }
+    };
+    static constexpr CQSL::Test::TestState s_aeByName[] =
+    {
+          CQSL::Test::TestState::Connected
+        , CQSL::Test::TestState::Connecting
+        , CQSL::Test::TestState::Failed
+        , CQSL::Test::TestState::Idle
+    };
+};
+}}
 
 
@@ -11,9 +11,13 @@
 //  Obviously more tests could be provided here eventually. This is just
 //  doing some basic tests to make sure that the generation is correct.
 //
+#include <algorithm>
+#include <cstring>
 #include <string>
 #include <iostream>
 #include <sstream>
+#include <thread>
+#include <vector>
 #include "Test.hpp"
 
 using namespace CQSL::Test;
@@ -187,6 +191,1190 @@ int main()
     }
 
 
+    // A standard enum synonym should get the ordinal of the value it references
+    if (TestEnum::Syn1 != TestEnum::Value3)
+    {
+        std::wcout << L"Standard enum Syn1 value is wrong" << std::endl;
+    }
+
+    // And standard values are numbered from zero in the order defined
+    static_assert(static_cast<int>(TestEnum::Value1) == 0, "Wrong standard enum ordinal");
+    static_assert(static_cast<int>(TestEnum::Value3) == 2, "Wrong standard enum ordinal");
+    static_assert(static_cast<int>(TestEnum::Syn1) == 2, "Wrong standard enum synonym ordinal");
+
+
+    // A flag set, which spans more than one 64 bit word
+    TestFlagsSet fsetTest{ TestFlags::Perm01, TestFlags::Perm65 };
+    if (!fsetTest.bIsSet(TestFlags::Perm65) || fsetTest.bIsSet(TestFlags::Perm02))
+    {
+        std::wcout << L"Flag set bit test failed" << std::endl;
+    }
+
+    if (fsetTest.uCount() != 2)
+    {
+        std::wcout << L"Flag set count should be 2 but got " << fsetTest.uCount() << std::endl;
+    }
+
+    // Iterate the set bits, which should come back in order
+    {
+        std::wstring strBits;
+        for (const TestFlags eBit : fsetTest)
+        {
+            strBits.append(pszEnumToName(eBit));
+        }
+        if (strBits != L"Perm01Perm65")
+        {
+            std::wcout << L"Flag set iteration failed" << std::endl;
+        }
+    }
+
+    // Flip it, which should turn on all of the other defined bits and no others
+    {
+        const TestFlagsSet fsetFlipped = ~fsetTest;
+        if ((fsetFlipped.uCount() != 68) || fsetFlipped.bAnyOf(fsetTest))
+        {
+            std::wcout << L"Flag set complement failed" << std::endl;
+        }
+
+        if (!(fsetFlipped | fsetTest).bAll() || (fsetFlipped & fsetTest).bAny())
+        {
+            std::wcout << L"Flag set and/or failed" << std::endl;
+        }
+    }
+
+    // Format it out and parse it back
+    {
+        TestFlagsSet fsetParsed;
+        if (!TestFlagsSet::bParse(fsetTest.strFormat(), fsetParsed) || (fsetParsed != fsetTest))
+        {
+            std::wcout << L"Flag set format/parse round trip failed" << std::endl;
+        }
+
+        if (TestFlagsSet::bParse(L"Perm01 | Bogus", fsetParsed))
+        {
+            std::wcout << L"Flag set parse should have failed" << std::endl;
+        }
+    }
+
+
+    // Parse from raw UTF-8 ranges, by name, ordinal and alt value
+    {
+        const char* const pszInput = "value2,4,0x67,Value99";
+        const char* const pszEnd = pszInput + std::strlen(pszInput);
+
+        std::from_chars_result frRes = EnumFromChars(pszInput, pszEnd, eBmp);
+        if ((frRes.ec != std::errc()) || (eBmp != TestBmp::Value2) || (*frRes.ptr != ','))
+        {
+            std::wcout << L"EnumFromChars by name failed" << std::endl;
+        }
+
+        frRes = EnumFromChars(frRes.ptr + 1, pszEnd, eBmp, CQSL::CQEnum::EFromChars::Ordinals);
+        if ((frRes.ec != std::errc()) || (eBmp != TestBmp::Value3))
+        {
+            std::wcout << L"EnumFromChars by ordinal failed" << std::endl;
+        }
+
+        // 0x67 is not an ordinal, but it is the alt value of Value3
+        const char* const pszAlt = frRes.ptr + 1;
+        frRes = EnumFromChars(pszAlt, pszEnd, eBmp, CQSL::CQEnum::EFromChars::Ordinals);
+        if ((frRes.ec != std::errc::invalid_argument) || (frRes.ptr != pszAlt))
+        {
+            std::wcout << L"EnumFromChars should have rejected the alt value" << std::endl;
+        }
+
+        eBmp = TestBmp::NoBits;
+        frRes = EnumFromChars(pszAlt, pszEnd, eBmp);
+        if ((frRes.ec != std::errc()) || (eBmp != TestBmp::Value3))
+        {
+            std::wcout << L"EnumFromChars by alt value failed" << std::endl;
+        }
+
+        // A name that only matches as a prefix isn't a match
+        frRes = EnumFromChars(frRes.ptr + 1, pszEnd, eStd);
+        if (frRes.ec != std::errc::invalid_argument)
+        {
+            std::wcout << L"EnumFromChars should have rejected a partial name" << std::endl;
+        }
+
+        // A dash isn't part of a name, so it stops the name there
+        const char* const pszDash = "Value1-Value2";
+        frRes = EnumFromChars(pszDash, pszDash + std::strlen(pszDash), eBmp);
+        if ((frRes.ec != std::errc()) || (eBmp != TestBmp::Value1) || (frRes.ptr != pszDash + 6))
+        {
+            std::wcout << L"EnumFromChars should have stopped at the dash" << std::endl;
+        }
+    }
+
+
+    // Match a name that arrives in pieces
+    {
+        CQSL::CQEnum::NameMatcher<TestFlags> nmatchTest;
+        size_t szUsed = 0;
+        if (nmatchTest.eFeed("pe", 2, szUsed) != CQSL::CQEnum::ENameMatch::NeedMore)
+        {
+            std::wcout << L"Name matcher should need more input" << std::endl;
+        }
+
+        // All of the names start with that
+        if (nmatchTest.rangeCandidates().uCount() != 70)
+        {
+            std::wcout << L"Name matcher candidates are wrong" << std::endl;
+        }
+
+        // The space isn't part of the name, so it's not consumed
+        if ((nmatchTest.eFeed("rm65 ", 5, szUsed) != CQSL::CQEnum::ENameMatch::Match)
+        ||  (szUsed != 4)
+        ||  (nmatchTest.eMatch() != TestFlags::Perm65))
+        {
+            std::wcout << L"Name matcher failed to match across chunks" << std::endl;
+        }
+
+        nmatchTest.Reset();
+        if ((nmatchTest.eFeed("Value", 5, szUsed) != CQSL::CQEnum::ENameMatch::NoMatch)
+        ||  (szUsed != 0))
+        {
+            std::wcout << L"Name matcher should have rejected the name" << std::endl;
+        }
+
+        // Prefix completion
+        const CQSL::CQEnum::NameRange<TestFlags> rangePerm6 = CQSL::CQEnum::PrefixRange<TestFlags>("PERM6");
+        if ((rangePerm6.uCount() != 10) || (*rangePerm6.begin() != TestFlags::Perm60))
+        {
+            std::wcout << L"Name prefix range is wrong" << std::endl;
+        }
+    }
+
+
+    // Iterate all of the values of a bitmap, which shouldn't include synonyms or magic values
+    {
+        uint32_t uBits = 0;
+        uint32_t uCount = 0;
+        for (const TestBmp eVal : CQSL::CQEnum::AllValues<TestBmp>())
+        {
+            uBits |= static_cast<uint32_t>(eVal);
+            uCount++;
+        }
+        if ((uCount != 3) || (uBits != static_cast<uint32_t>(TestBmp::AllBits)))
+        {
+            std::wcout << L"Iteration of bitmap values failed" << std::endl;
+        }
+
+        static_assert(CQSL::CQEnum::AllValues<TestFlags>().uCount() == 70, "Wrong flag set value count");
+    }
+
+
+    // Compile time traits, and the lookups through them
+    {
+        using TraitsBmp = CQSL::CQEnum::EnumTraits<TestBmp>;
+        static_assert(TraitsBmp::eKind == CQSL::CQEnum::EEnumKinds::Bitmap, "Wrong enum kind");
+        static_assert((TraitsBmp::c_uCount == 3) && (TraitsBmp::eMax == TestBmp::Value3), "Wrong count/max");
+        static_assert(std::is_same_v<TraitsBmp::UnderType, unsigned short>, "Wrong underlying type");
+        static_assert(TraitsBmp::bHasAltVal && TraitsBmp::bHasText2, "Should have alt values and text 2");
+
+        using TraitsStd = CQSL::CQEnum::EnumTraits<TestEnum>;
+        static_assert(!TraitsStd::bHasAltVal && (TraitsStd::pfnFromAltVal == nullptr), "Should not have alt values");
+
+        if (std::wstring(TraitsStd::pfnToText1(TestEnum::Value2)) != L"The text for value 2")
+        {
+            std::wcout << L"Traits text lookup failed" << std::endl;
+        }
+
+        if (!TraitsBmp::pfnFromName(L"Value3", eBmp) || (eBmp != TestBmp::Value3))
+        {
+            std::wcout << L"Traits name lookup failed" << std::endl;
+        }
+    }
+
+
+    // Dense indices and custom attribute columns
+    {
+        static_assert(uEnumToIndex(TestBmp::Value3) == 2, "Wrong bitmap dense index");
+        static_assert(uEnumToIndex(TestBmp::Syn2) == 3, "Combined bits should not have a dense index");
+        static_assert(EnumToWeight(TestEnum::Value2) == 1.5, "Wrong attribute value");
+
+        // Invalid values of monotonic enums get the count, and the attribute default
+        static_assert(uEnumToIndex(static_cast<TestEnum>(1000)) == CQSL::CQEnum::EnumTraits<TestEnum>::c_uCount, "Invalid value should get the count");
+        static_assert(uEnumToIndex(static_cast<TestEnum>(-1)) == CQSL::CQEnum::EnumTraits<TestEnum>::c_uCount, "Negative value should get the count");
+        static_assert(EnumToWeight(static_cast<TestEnum>(1000)) == 0.0, "Invalid value should get the default attribute");
+        static_assert(EnumToLabel(static_cast<TestEnum>(-1)) == nullptr, "Invalid value should get the default attribute");
+
+        if (std::strcmp(EnumToLabel(TestEnum::Value3), "three") != 0)
+        {
+            std::wcout << L"Wrong text attribute value" << std::endl;
+        }
+    }
+
+
+    // State transitions
+    {
+        static_assert(bCanTransition(TestState::Connecting, TestState::Failed), "Transition should be allowed");
+        static_assert(!bCanTransition(TestState::Idle, TestState::Connected), "Transition should not be allowed");
+        static_assert(!bCanTransition(static_cast<TestState>(25), TestState::Idle), "Invalid values cannot transition");
+
+        TestState aeExpected[] = { TestState::Idle, TestState::Connected, TestState::Failed };
+        uint32_t uIndex = 0;
+        for (const TestState eCur : EnumSuccessors(TestState::Connecting))
+        {
+            if ((uIndex >= 3) || (eCur != aeExpected[uIndex]))
+            {
+                std::wcout << L"Wrong transition successor" << std::endl;
+                break;
+            }
+            uIndex++;
+        }
+        if ((uIndex != 3) || (EnumSuccessors(TestState::Failed).uCount() != 1))
+        {
+            std::wcout << L"Wrong transition successor count" << std::endl;
+        }
+    }
+
+
+    // Named value groups
+    {
+        static_assert(bIsInActive(TestState::Connected) && !bIsInActive(TestState::Idle), "Wrong group membership");
+        static_assert(bIsInTerminal(TestState::Failed) && !bIsInTerminal(TestState::Connecting), "Wrong group membership");
+        static_assert(!bIsInActive(static_cast<TestState>(25)), "Invalid value should not be in a group");
+
+        TestState aeExpected[] = { TestState::Connecting, TestState::Connected };
+        uint32_t uIndex = 0;
+        for (const TestState eCur : TestStateGroups::Active())
+        {
+            if ((uIndex >= 2) || (eCur != aeExpected[uIndex]))
+            {
+                std::wcout << L"Wrong group member" << std::endl;
+                break;
+            }
+            uIndex++;
+        }
+        if ((uIndex != 2) || (TestStateGroups::Terminal().uCount() != 1))
+        {
+            std::wcout << L"Wrong group member count" << std::endl;
+        }
+    }
+
+
+    // Jump table dispatch, with a handler per value
+    {
+        auto fnVisit = [](const TestState eState)
+        {
+            return CQSL::CQEnum::EnumVisit
+            (
+                eState
+                , []() { return 1; }
+                , [](auto eConst) { static_assert(eConst == TestState::Connecting, "Wrong visit value"); return 2; }
+                , []() { return 3; }
+                , []() { return 4; }
+            );
+        };
+
+        if ((fnVisit(TestState::Idle) != 1)
+        ||  (fnVisit(TestState::Connecting) != 2)
+        ||  (fnVisit(TestState::Failed) != 4))
+        {
+            std::wcout << L"Wrong enum visit handler called" << std::endl;
+        }
+
+        bool bThrew = false;
+        try
+        {
+            fnVisit(static_cast<TestState>(25));
+        }
+
+        catch(const std::runtime_error&)
+        {
+            bThrew = true;
+        }
+        if (!bThrew)
+        {
+            std::wcout << L"Invalid enum visit value should throw" << std::endl;
+        }
+    }
+
+
+    // Tagged unions with per-value payload types
+    {
+        static_assert(std::is_same_v<TestStateUnion::PayloadType<TestState::Failed>, std::string>, "Wrong payload type");
+
+        TestStateUnion tuTest;
+        if (!tuTest.bIs<TestState::Idle>() || tuTest.pGet<TestState::Failed>())
+        {
+            std::wcout << L"Tagged union should default to the first value" << std::endl;
+        }
+
+        tuTest.Set<TestState::Connecting>(ConnectInfo{ "localhost", 80 });
+        TestStateUnion tuCopy(tuTest);
+        tuTest = TestStateUnion::Make<TestState::Failed>("Refused");
+
+        auto fnVisit = [](const TestStateUnion& tuVisit)
+        {
+            return tuVisit.Visit
+            (
+                []() { return std::string("Idle"); }
+                , [](const ConnectInfo& ciCur) { return ciCur.strHost; }
+                , []() { return std::string("Connected"); }
+                , [](const std::string& strErr) { return strErr; }
+            );
+        };
+
+        if ((fnVisit(tuCopy) != "localhost")
+        ||  (tuCopy.Get<TestState::Connecting>().uPort != 80)
+        ||  (fnVisit(tuTest) != "Refused")
+        ||  (tuTest.eTag() != TestState::Failed))
+        {
+            std::wcout << L"Wrong tagged union payload" << std::endl;
+        }
+
+        bool bThrew = false;
+        try
+        {
+            tuTest.Get<TestState::Connecting>();
+        }
+
+        catch(const std::runtime_error&)
+        {
+            bThrew = true;
+        }
+        if (!bThrew)
+        {
+            std::wcout << L"Getting the wrong tagged union payload should throw" << std::endl;
+        }
+
+        tuCopy = tuTest;
+        if (*tuCopy.pGet<TestState::Failed>() != "Refused")
+        {
+            std::wcout << L"Tagged union copy assign failed" << std::endl;
+        }
+    }
+
+
+    // Enum to enum maps
+    {
+        static_assert(StateToTestEnum(TestState::Connected) == TestEnum::Value2, "Wrong mapped value");
+        static_assert(StateToTestEnum(TestState::Failed) == TestEnum::Value3, "Wrong synonym mapped value");
+        static_assert(StateToTestEnum(TestState::Idle) == TestEnum::Value1, "Unmapped value should get default");
+        static_assert(StateToTestEnum(static_cast<TestState>(25)) == TestEnum::Value1, "Invalid value should get default");
+        static_assert(TestEnumToState(TestEnum::Value2) == TestState::Connecting, "Wrong mapped value");
+    }
+
+
+    // Lazily created per-value tables, first used from multiple threads
+    {
+        CQSL::CQEnum::LazyEnumTable<TestState, std::string> ltblTest;
+        std::atomic<uint32_t> uInits(0);
+        if (ltblTest.pFind(TestState::Idle))
+        {
+            std::wcout << L"Lazy table slot should not be ready yet" << std::endl;
+        }
+
+        // An init that throws leaves the slot empty
+        try
+        {
+            ltblTest.Get(TestState::Failed, []() -> std::string { throw std::runtime_error("Init failed"); });
+        }
+
+        catch(const std::runtime_error&)
+        {
+        }
+        if (ltblTest.bIsReady(TestState::Failed))
+        {
+            std::wcout << L"Lazy table slot should be empty after a failed init" << std::endl;
+        }
+
+        std::vector<std::thread> vThreads;
+        std::atomic<uint32_t> uBadValues(0);
+        for (uint32_t uThread = 0; uThread < 6; uThread++)
+        {
+            vThreads.emplace_back
+            (
+                [&ltblTest, &uInits, &uBadValues]()
+                {
+                    for (uint32_t uRound = 0; uRound < 1000; uRound++)
+                    {
+                        for (const TestState eCur : CQSL::CQEnum::AllValues<TestState>())
+                        {
+                            const std::string& strCur = ltblTest.Get
+                            (
+                                eCur
+                                , [&uInits](const TestState eInit)
+                                  {
+                                      uInits++;
+                                      std::this_thread::yield();
+                                      return std::string(1, static_cast<char>('A' + uEnumToIndex(eInit)));
+                                  }
+                            );
+                            if (strCur[0] != static_cast<char>('A' + uEnumToIndex(eCur)))
+                            {
+                                uBadValues++;
+                            }
+                        }
+                    }
+                }
+            );
+        }
+        for (std::thread& thrCur : vThreads)
+        {
+            thrCur.join();
+        }
+
+        if ((uInits != 4) || uBadValues || (*ltblTest.pFind(TestState::Connected) != "C"))
+        {
+            std::wcout << L"Lazy table slots should be created once" << std::endl;
+        }
+    }
+
+
+    // Counting sort, partition and group by, on one and multiple threads
+    {
+        struct TestRec
+        {
+            TestState   eState;
+            uint32_t    uSeq;
+        };
+
+        std::vector<TestRec> vRecs;
+        uint32_t uSeed = 12345;
+        for (uint32_t uIndex = 0; uIndex < 100000; uIndex++)
+        {
+            uSeed = (uSeed * 1103515245) + 12345;
+            const uint32_t uPick = (uSeed >> 16) % 5;
+            vRecs.push_back({ (uPick < 4) ? CQSL::CQEnum::EnumValueList<TestState>::s_aeValues[uPick] : static_cast<TestState>(25), uIndex });
+        }
+        auto fnKey = [](const TestRec& recCur) { return recCur.eState; };
+
+        // What the results should be, with invalid values last
+        std::vector<TestRec> vExpected(vRecs);
+        std::stable_sort
+        (
+            vExpected.begin()
+            , vExpected.end()
+            , [](const TestRec& rec1, const TestRec& rec2) { return uEnumToIndex(rec1.eState) < uEnumToIndex(rec2.eState); }
+        );
+        auto fnSame = [&vExpected](const std::vector<TestRec>& vTest)
+        {
+            for (size_t szIndex = 0; szIndex < vTest.size(); szIndex++)
+            {
+                if (vTest[szIndex].uSeq != vExpected[szIndex].uSeq)
+                {
+                    return false;
+                }
+            }
+            return vTest.size() == vExpected.size();
+        };
+
+        for (const uint32_t uThreads : { 1U, 4U })
+        {
+            std::vector<TestRec> vSorted(vRecs.size());
+            const CQSL::CQEnum::EnumBuckets<TestState> bktsSort = CQSL::CQEnum::EnumCountingSort
+            (
+                vRecs.begin(), vRecs.end(), vSorted.begin(), fnKey, uThreads
+            );
+            if (!fnSame(vSorted))
+            {
+                std::wcout << L"Enum counting sort gave the wrong order" << std::endl;
+            }
+
+            const CQSL::CQEnum::EnumCountList<TestState> aszHisto = CQSL::CQEnum::EnumHistogram
+            (
+                vRecs.begin(), vRecs.end(), fnKey, uThreads
+            );
+            if ((aszHisto[1] != bktsSort.szCount(TestState::Connecting))
+            ||  (aszHisto[4] != bktsSort.szInvalidCount())
+            ||  (bktsSort.szStart(TestState::Connecting) != aszHisto[0]))
+            {
+                std::wcout << L"Enum histogram and buckets don't agree" << std::endl;
+            }
+
+            const CQSL::CQEnum::EnumGroups<TestState> grpsTest = CQSL::CQEnum::EnumGroupBy
+            (
+                vRecs.begin(), vRecs.end(), fnKey, uThreads
+            );
+            size_t szGroupCount = 0;
+            for (const size_t szIndex : grpsTest.Group(TestState::Failed))
+            {
+                if (vRecs[szIndex].eState != TestState::Failed)
+                {
+                    std::wcout << L"Wrong enum group by member" << std::endl;
+                    break;
+                }
+                szGroupCount++;
+            }
+            if (szGroupCount != aszHisto[3])
+            {
+                std::wcout << L"Wrong enum group by count" << std::endl;
+            }
+
+            std::vector<TestRec> vParted(vRecs);
+            CQSL::CQEnum::EnumPartition(vParted.begin(), vParted.end(), fnKey, uThreads);
+            if (!fnSame(vParted))
+            {
+                std::wcout << L"Enum partition gave the wrong order" << std::endl;
+            }
+        }
+
+        // For lists of the enums themselves no key function is needed
+        TestState aeStates[] = { TestState::Failed, TestState::Idle, TestState::Failed };
+        if (CQSL::CQEnum::EnumHistogram(std::begin(aeStates), std::end(aeStates))[3] != 2)
+        {
+            std::wcout << L"Wrong enum histogram of enums" << std::endl;
+        }
+
+        // Invalid values of a monotonic enum go into the invalid bucket
+        TestEnum aeStds[] = { TestEnum::Value1, static_cast<TestEnum>(1000), TestEnum::Value2, static_cast<TestEnum>(-1) };
+        const CQSL::CQEnum::EnumCountList<TestEnum> aszStdHisto = CQSL::CQEnum::EnumHistogram
+        (
+            std::begin(aeStds), std::end(aeStds)
+        );
+        if ((aszStdHisto[0] != 1) || (aszStdHisto[1] != 1) || (aszStdHisto[3] != 2))
+        {
+            std::wcout << L"Invalid enum values were not put in the invalid bucket" << std::endl;
+        }
+
+        TestEnum aeStdSorted[4];
+        const CQSL::CQEnum::EnumBuckets<TestEnum> bktsStd = CQSL::CQEnum::EnumCountingSort
+        (
+            std::begin(aeStds), std::end(aeStds), std::begin(aeStdSorted)
+        );
+        if ((bktsStd.szInvalidCount() != 2)
+        ||  (bktsStd.szStart(static_cast<TestEnum>(1000)) != 2)
+        ||  (bktsStd.szCount(static_cast<TestEnum>(-1)) != 2)
+        ||  (aeStdSorted[2] != static_cast<TestEnum>(1000))
+        ||  (aeStdSorted[3] != static_cast<TestEnum>(-1)))
+        {
+            std::wcout << L"Invalid enum values were not sorted into the invalid bucket" << std::endl;
+        }
+
+        //
+        //  If the calling thread's chunk throws, the other threads have to be joined
+        //  before the exception gets out, else we'd terminate.
+        //
+        std::vector<TestState> vMany(CQSL::CQEnum::c_szMinBucketChunk * 2, TestState::Idle);
+        const TestState* const peThrowAt = vMany.data();
+        try
+        {
+            CQSL::CQEnum::EnumHistogram
+            (
+                vMany.begin()
+                , vMany.end()
+                , [peThrowAt](const TestState& eCur)
+                  {
+                      if (&eCur == peThrowAt)
+                      {
+                          throw std::runtime_error("Bad key");
+                      }
+                      return eCur;
+                  }
+                , 2
+            );
+            std::wcout << L"Enum histogram key exception was not passed on" << std::endl;
+        }
+
+        catch(const std::runtime_error&)
+        {
+        }
+    }
+
+
+    // Columns of enum values, with filters, histograms and postings
+    {
+        CQSL::CQEnum::EnumColumn<TestState> colStates;
+        static_assert(sizeof(CQSL::CQEnum::EnumColumn<TestState>::IndexType) == 1, "Wrong column width");
+
+        // Not a multiple of 64, so that the tails are tested
+        const uint32_t c_uRows = 10007;
+        for (uint32_t uRow = 0; uRow < c_uRows; uRow++)
+        {
+            colStates.Append(CQSL::CQEnum::EnumValueList<TestState>::s_aeValues[(uRow * 7 + (uRow >> 5)) % 4]);
+        }
+
+        const CQSL::CQEnum::EnumColumn<TestState>::RowBitmap bmpEq = colStates.FilterEq(TestState::Connected);
+        const CQSL::CQEnum::EnumColumn<TestState>::RowBitmap bmpIn = colStates.FilterIn(TestStateGroups::s_auActive);
+        const CQSL::CQEnum::EnumColumn<TestState>::RowBitmap bmpList = colStates.FilterIn({ TestState::Idle, TestState::Failed });
+        const std::array<CQSL::CQEnum::EnumColumn<TestState>::RowBitmap, 4> abmpPosts = colStates.Postings();
+        std::array<size_t, 4> aszExpected = {};
+        bool bBadRow = false;
+        for (uint32_t uRow = 0; uRow < c_uRows; uRow++)
+        {
+            const TestState eCur = colStates[uRow];
+            const uint32_t uIndex = uEnumToIndex(eCur);
+            aszExpected[uIndex]++;
+
+            const uint64_t uBit = 1ULL << (uRow % 64);
+            if ((((bmpEq[uRow / 64] & uBit) != 0) != (eCur == TestState::Connected))
+            ||  (((bmpIn[uRow / 64] & uBit) != 0) != bIsInActive(eCur))
+            ||  (((bmpList[uRow / 64] & uBit) != 0) == bIsInActive(eCur))
+            ||  !(abmpPosts[uIndex][uRow / 64] & uBit))
+            {
+                bBadRow = true;
+            }
+        }
+        if (bBadRow)
+        {
+            std::wcout << L"Wrong enum column filter results" << std::endl;
+        }
+        if ((colStates.Histogram() != aszExpected)
+        ||  (CQSL::CQEnum::EnumColumn<TestState>::szRowCount(bmpEq) != aszExpected[2])
+        ||  (CQSL::CQEnum::EnumColumn<TestState>::szRowCount(abmpPosts[0]) != aszExpected[0])
+        ||  (CQSL::CQEnum::EnumColumn<TestState>::szRowCount(colStates.FilterEq(static_cast<TestState>(25))) != 0))
+        {
+            std::wcout << L"Wrong enum column counts" << std::endl;
+        }
+
+        // And one with more values than the vector paths handle
+        CQSL::CQEnum::EnumColumn<TestFlags> colFlags;
+        for (uint32_t uRow = 0; uRow < 1000; uRow++)
+        {
+            colFlags.Append(static_cast<TestFlags>(uRow % 70));
+        }
+        if ((colFlags.Histogram()[69] != 14)
+        ||  (CQSL::CQEnum::EnumColumn<TestFlags>::szRowCount(colFlags.FilterEq(static_cast<TestFlags>(3))) != 15)
+        ||  (CQSL::CQEnum::EnumColumn<TestFlags>::szRowCount(colFlags.FilterIn({ static_cast<TestFlags>(1), static_cast<TestFlags>(65) })) != 29))
+        {
+            std::wcout << L"Wrong wide enum column counts" << std::endl;
+        }
+    }
+
+
+    // Sharded per-value counters, bumped from multiple threads
+    {
+        CQSL::CQEnum::EnumCounters<TestBmp, 4> ectrsTest;
+        std::vector<std::thread> vThreads;
+        for (uint32_t uThread = 0; uThread < 6; uThread++)
+        {
+            vThreads.emplace_back
+            (
+                [&ectrsTest]()
+                {
+                    for (uint32_t uIndex = 0; uIndex < 1000; uIndex++)
+                    {
+                        ectrsTest.Increment(TestBmp::Value2);
+                        ectrsTest.Increment((uIndex & 1) ? TestBmp::Value3 : TestBmp::Syn2);
+                    }
+                }
+            );
+        }
+        for (std::thread& thrCur : vThreads)
+        {
+            thrCur.join();
+        }
+
+        const CQSL::CQEnum::EnumCounters<TestBmp, 4>::CountList auCounts = ectrsTest.Snapshot();
+        if ((auCounts[0] != 0) || (auCounts[1] != 6000) || (auCounts[2] != 3000)
+        ||  (ectrsTest.uValue(TestBmp::Value2) != 6000))
+        {
+            std::wcout << L"Wrong enum counter values" << std::endl;
+        }
+
+        ectrsTest.Reset();
+        if (ectrsTest.uValue(TestBmp::Value3) != 0)
+        {
+            std::wcout << L"Enum counters were not reset" << std::endl;
+        }
+    }
+
+
+    // Atomic flags for bitmap enums
+    {
+        TestBmpAtomicFlags aflTest(TestBmp::Value1);
+        if (aflTest.test_and_set(TestBmp::Value2) || !aflTest.test_and_set(TestBmp::Value2))
+        {
+            std::wcout << L"Atomic flags test and set failed" << std::endl;
+        }
+
+        const TestBmp ePrev = aflTest.fetch_clear(TestBmp::Value1);
+        if ((ePrev != (TestBmp::Value1 | TestBmp::Value2)) || (aflTest.load() != TestBmp::Value2))
+        {
+            std::wcout << L"Atomic flags clear failed" << std::endl;
+        }
+
+        // Set a bit from another thread and wait for the change
+        std::thread thrSet
+        (
+            [&aflTest]()
+            {
+                aflTest.fetch_set(TestBmp::Value3);
+                aflTest.notify_all();
+            }
+        );
+        aflTest.wait(TestBmp::Value2);
+        thrSet.join();
+        if (!aflTest.bAllOn(TestBmp::Value2 | TestBmp::Value3) || aflTest.bAnyOn(TestBmp::Value1))
+        {
+            std::wcout << L"Atomic flags set failed" << std::endl;
+        }
+    }
+
+
+    // Runtime name aliases
+    {
+        if (bNameToEnum(L"Legacy2", eStd))
+        {
+            std::wcout << L"Alias should not be found before it is added" << std::endl;
+        }
+
+        TestEnumAliases().SetAliases({ { L"Legacy2", TestEnum::Value2 }, { L"Old3", TestEnum::Value1 } });
+        TestEnumAliases().AddAlias(L"old3", TestEnum::Value3);
+        if (!bNameToEnum(L"LEGACY2", eStd) || (eStd != TestEnum::Value2)
+        ||  !bNameToEnum(L"Old3", eStd) || (eStd != TestEnum::Value3)
+        ||  (TestEnumAliases().uCount() != 2))
+        {
+            std::wcout << L"Runtime alias lookup failed" << std::endl;
+        }
+
+        // Look up from some threads while the aliases are being replaced
+        std::atomic<bool> bFailed(false);
+        std::vector<std::thread> vThreads;
+        for (uint32_t uThread = 0; uThread < 4; uThread++)
+        {
+            vThreads.emplace_back
+            (
+                [&bFailed]()
+                {
+                    TestEnum eFound;
+                    for (uint32_t uIndex = 0; uIndex < 20000; uIndex++)
+                    {
+                        if (!bNameToEnum(L"Legacy2", eFound) || (eFound != TestEnum::Value2))
+                        {
+                            bFailed = true;
+                        }
+                    }
+                }
+            );
+        }
+        for (uint32_t uIndex = 0; uIndex < 200; uIndex++)
+        {
+            TestEnumAliases().SetAliases({ { L"Legacy2", TestEnum::Value2 }, { L"Other" + std::to_wstring(uIndex), TestEnum::Value1 } });
+        }
+        for (std::thread& thrCur : vThreads)
+        {
+            thrCur.join();
+        }
+        if (bFailed)
+        {
+            std::wcout << L"Concurrent alias lookup failed" << std::endl;
+        }
+
+        // Actual names always win over aliases
+        TestEnumAliases().AddAlias(L"Value1", TestEnum::Value3);
+        if (!bNameToEnum(L"Value1", eStd) || (eStd != TestEnum::Value1))
+        {
+            std::wcout << L"Alias should not override a name" << std::endl;
+        }
+
+        TestEnumAliases().Clear();
+        if (bNameToEnum(L"Legacy2", eStd))
+        {
+            std::wcout << L"Aliases were not cleared" << std::endl;
+        }
+    }
+
+
+    // Lookup instrumentation, if enabled in this build
+#if defined(CQENUM_INSTRUMENT)
+    {
+        using CQSL::CQEnum::ELookups;
+        const CQSL::CQEnum::LookupCounts lcntsBefore = CQSL::CQEnum::lcntsLookupTotals
+        (
+            "CQSL::Test::TestBmp", ELookups::NameToEnum
+        );
+        bNameToEnum(L"Value2", eBmp);
+        bNameToEnum(L"Bogus", eBmp);
+
+        const CQSL::CQEnum::LookupCounts lcntsAfter = CQSL::CQEnum::lcntsLookupTotals
+        (
+            "CQSL::Test::TestBmp", ELookups::NameToEnum
+        );
+        if ((lcntsAfter.uCalls - lcntsBefore.uCalls != 2)
+        ||  (lcntsAfter.uMisses - lcntsBefore.uMisses != 1)
+        ||  (lcntsAfter.uProbes - lcntsBefore.uProbes != 5))
+        {
+            std::wcout << L"Wrong lookup instrumentation counts" << std::endl;
+        }
+
+        // The ordinal search stops at the first one past it, so a zero misses on the first probe
+        const CQSL::CQEnum::LookupCounts lcntsNameBefore = CQSL::CQEnum::lcntsLookupTotals
+        (
+            "CQSL::Test::TestBmp", ELookups::EnumToName
+        );
+        pszEnumToName(static_cast<TestBmp>(0));
+        const CQSL::CQEnum::LookupCounts lcntsNameAfter = CQSL::CQEnum::lcntsLookupTotals
+        (
+            "CQSL::Test::TestBmp", ELookups::EnumToName
+        );
+        if ((lcntsNameAfter.uMisses - lcntsNameBefore.uMisses != 1)
+        ||  (lcntsNameAfter.uProbes - lcntsNameBefore.uProbes != 1))
+        {
+            std::wcout << L"Wrong lookup instrumentation miss probes" << std::endl;
+        }
+
+        std::ostringstream strmDump;
+        CQSL::CQEnum::DumpLookupStats(strmDump);
+        if (strmDump.str().find("CQSL::Test::TestBmp::NameToEnum Calls=") == std::string::npos)
+        {
+            std::wcout << L"Lookup stats were not dumped" << std::endl;
+        }
+    }
+#endif
+
+
+    // Bitmap flag word validity checks
+    {
+        static_assert(bIsValidBits(TestBmp::Syn2) && !bIsValidBits(static_cast<TestBmp>(0x8)), "Wrong bit validity");
+        static_assert(bIsSingleBit(TestBmp::Value2) && !bIsSingleBit(TestBmp::Syn2), "Wrong single bit check");
+        static_assert(!bIsSingleBit(TestBmp::NoBits) && !bIsSingleBit(static_cast<TestBmp>(0x10)), "Wrong single bit check");
+
+        // Enough values to go through the vector path, with a tail
+        TestBmp aeFlags[37];
+        for (uint32_t uIndex = 0; uIndex < 37; uIndex++)
+        {
+            aeFlags[uIndex] = (uIndex % 3) ? TestBmp::Value1 : TestBmp::Value3;
+        }
+        if (!bIsValidBits(aeFlags, 37) || !bIsSingleBit(aeFlags, 37))
+        {
+            std::wcout << L"Flag word list should be valid" << std::endl;
+        }
+
+        aeFlags[35] = TestBmp::Syn2;
+        if (!bIsValidBits(aeFlags, 37) || bIsSingleBit(aeFlags, 37))
+        {
+            std::wcout << L"Flag word list has multiple bits" << std::endl;
+        }
+
+        aeFlags[17] = static_cast<TestBmp>(0x100);
+        if (bIsValidBits(aeFlags, 37))
+        {
+            std::wcout << L"Flag word list should be invalid" << std::endl;
+        }
+    }
+
+
+    // Dense combination indices for bitmaps with scattered bits
+    {
+        static_assert(CQSL::CQEnum::BitmapCombos<TestPerms>::c_uBits == 5, "Wrong combination bit count");
+
+        if ((uCombinationIndex(TestPerms::NoBits) != 0)
+        ||  (uCombinationIndex(TestPerms::ReadWrite) != 0x3)
+        ||  (uCombinationIndex(TestPerms::Exec | TestPerms::Locked) != 0x14)
+        ||  (uCombinationIndex(TestPerms::AllBits) != 0x1F)
+        ||  (uCombinationIndex(static_cast<TestPerms>(0x101)) != 0))
+        {
+            std::wcout << L"Wrong bitmap combination index" << std::endl;
+        }
+
+        // Every combination should round trip and get its own slot
+        CQSL::CQEnum::EnumComboTable<TestPerms, uint32_t> ctblTest(0xFFFFFFFF);
+        for (uint32_t uIndex = 0; uIndex < ctblTest.c_uSize; uIndex++)
+        {
+            const TestPerms eCombo = ctblTest.eCombination(uIndex);
+            if ((uCombinationIndex(eCombo) != uIndex) || (ctblTest[eCombo] != 0xFFFFFFFF))
+            {
+                std::wcout << L"Bitmap combination did not round trip" << std::endl;
+                break;
+            }
+            ctblTest[eCombo] = uIndex;
+        }
+        static_assert(CQSL::CQEnum::EnumComboTable<TestPerms, int>::eCombination(0x9) == (TestPerms::Read | TestPerms::Hidden), "Wrong combination");
+        if (ctblTest[TestPerms::Write | TestPerms::Hidden] != 0xA)
+        {
+            std::wcout << L"Wrong bitmap combination table entry" << std::endl;
+        }
+    }
+
+
+    // Constant tables loaded from data files at generation time
+    {
+        static_assert(apszTestNames.size() == 3, "Wrong CSV table size");
+        static_assert((aiTestCurve.size() == 5) && (aiTestCurve[2] == -1000), "Wrong binary table values");
+        static_assert((aiTestCurve[3] == -32768) && (aiTestCurve[4] == 32767), "Wrong binary table limits");
+        if (std::strcmp(apszTestNames[1], "Two, Three") != 0)
+        {
+            std::wcout << L"Wrong CSV table value" << std::endl;
+        }
+    }
+
+
+    // Bulk alt value translation, a dense table one way and sorted the other
+    {
+        const TestState aeStates[4] =
+        {
+            TestState::Idle, TestState::Connecting, TestState::Connected, TestState::Failed
+        };
+        const int32_t aiAlts[4] = { 5000, -7, 123456, 3 };
+
+        // Enough to go through the vector loops plus a tail, with some bad ones
+        std::vector<TestState> veStates;
+        std::vector<int32_t> viAlts;
+        for (uint32_t uIndex = 0; uIndex < 139; uIndex++)
+        {
+            if (uIndex % 5 == 4)
+            {
+                veStates.push_back(static_cast<TestState>(uIndex));
+                viAlts.push_back(static_cast<int32_t>(uIndex) - 70);
+            }
+            else
+            {
+                veStates.push_back(aeStates[uIndex % 4]);
+                viAlts.push_back(aiAlts[(uIndex + 1) % 4]);
+            }
+        }
+
+        std::vector<int32_t> viOut(veStates.size());
+        std::vector<uint64_t> vuToMask((veStates.size() + 63) / 64, ~uint64_t(0));
+        const size_t szToBad = EnumsToAltValues
+        (
+            veStates.data(), veStates.size(), viOut.data(), vuToMask.data()
+        );
+
+        std::vector<TestState> veOut(viAlts.size());
+        std::vector<uint64_t> vuFromMask((viAlts.size() + 63) / 64);
+        const size_t szFromBad = CQSL::CQEnum::EnumTraits<TestState>::pfnFromAltVals
+        (
+            viAlts.data(), viAlts.size(), veOut.data(), vuFromMask.data()
+        );
+
+        size_t szExpToBad = 0;
+        size_t szExpFromBad = 0;
+        for (size_t szIndex = 0; szIndex < veStates.size(); szIndex++)
+        {
+            int32_t iExpAlt = 0;
+            const bool bToOK = bEnumToAltValue(veStates[szIndex], iExpAlt);
+            TestState eExp = static_cast<TestState>(0);
+            const bool bFromOK = bEnumFromAltValue(viAlts[szIndex], eExp);
+            if (!bToOK)
+            {
+                szExpToBad++;
+            }
+            if (!bFromOK)
+            {
+                szExpFromBad++;
+            }
+
+            if ((viOut[szIndex] != iExpAlt)
+            ||  (((vuToMask[szIndex / 64] >> (szIndex % 64)) & 1) == bToOK))
+            {
+                std::wcout << L"Bulk enum to alt value failed at " << szIndex << std::endl;
+                break;
+            }
+            if ((veOut[szIndex] != eExp)
+            ||  (((vuFromMask[szIndex / 64] >> (szIndex % 64)) & 1) == bFromOK))
+            {
+                std::wcout << L"Bulk alt value to enum failed at " << szIndex << std::endl;
+                break;
+            }
+        }
+        if ((szToBad != szExpToBad) || (szFromBad != szExpFromBad) || !szToBad || !szFromBad)
+        {
+            std::wcout << L"Bulk alt value translation got the wrong bad counts" << std::endl;
+        }
+
+        //
+        //  A sorted table too big to do by comparing against each key, with unsigned
+        //  keys on both sides of the sign bit.
+        //
+        std::vector<uint32_t> vuKeys;
+        std::vector<int32_t> viRes;
+        for (uint32_t uIndex = 0; uIndex < 40; uIndex++)
+        {
+            vuKeys.push_back(0x7FFF0000 + (uIndex * uIndex * 997));
+            viRes.push_back(static_cast<int32_t>(uIndex) + 1);
+        }
+        const CQSL::CQEnum::XlatTable<uint32_t, int32_t> xtblTest =
+        {
+            0, 0, nullptr, 0, 40, vuKeys.data(), viRes.data()
+        };
+        std::vector<uint32_t> vuSrc;
+        for (uint32_t uIndex = 0; uIndex < 61; uIndex++)
+        {
+            vuSrc.push_back(vuKeys[(uIndex * 7) % 40] + (((uIndex % 3) == 0) ? 1 : 0));
+        }
+        std::vector<int32_t> viSortedOut(vuSrc.size());
+        const size_t szSortedBad = CQSL::CQEnum::szXlatValues
+        (
+            vuSrc.data(), vuSrc.size(), viSortedOut.data(), xtblTest, -1, nullptr
+        );
+        for (size_t szIndex = 0; szIndex < vuSrc.size(); szIndex++)
+        {
+            const int32_t iExp = ((szIndex % 3) == 0) ? -1 : static_cast<int32_t>(((szIndex * 7) % 40) + 1);
+            if (viSortedOut[szIndex] != iExp)
+            {
+                std::wcout << L"Sorted table translation failed at " << szIndex << std::endl;
+                break;
+            }
+        }
+        if (szSortedBad != 21)
+        {
+            std::wcout << L"Sorted table translation got the wrong bad count" << std::endl;
+        }
+
+        // And a smaller underlying type, without a mask
+        const int32_t aiBmpAlts[5] = { 103, 101, 100, 102, 104 };
+        TestBmp aeBmps[5];
+        if ((AltValuesToEnums(aiBmpAlts, 5, aeBmps) != 2)
+        ||  (aeBmps[0] != TestBmp::Value3)
+        ||  (aeBmps[1] != TestBmp::Value1)
+        ||  (aeBmps[3] != TestBmp::Value2))
+        {
+            std::wcout << L"Bulk alt value to bitmap failed" << std::endl;
+        }
+    }
+
+    // Stable ids, schema fingerprints and remapping from the previous version
+    {
+        static_assert(uEnumToStableId(TestState::Connecting) == 7, "Wrong stable id");
+        static_assert(uEnumToStableId(static_cast<TestState>(11)) == 0xFFFFFFFF, "Bad value got a stable id");
+        static_assert(TestStateSchema::c_uFingerprint != TestStateRemap::c_uFromFingerprint, "Fingerprint didn't change");
+        static_assert
+        (
+            CQSL::CQEnum::EnumTraits<TestEnum>::c_uFingerprint == TestEnumSchema::c_uFingerprint
+            , "Wrong traits fingerprint"
+        );
+
+        TestState eState = TestState::Idle;
+        if (!bStableIdToEnum(42, eState) || (eState != TestState::Connected) || bStableIdToEnum(55, eState))
+        {
+            std::wcout << L"Stable id lookup failed" << std::endl;
+        }
+
+        // Old Dialing (2) is now Connecting, and old Closed (3) is gone
+        if (!TestStateRemap::bRemap(2, eState)
+        ||  (eState != TestState::Connecting)
+        ||  TestStateRemap::bRemap(3, eState)
+        ||  TestStateRemap::bRemap(0, eState)
+        ||  TestStateRemap::bRemap(-1, eState))
+        {
+            std::wcout << L"Single state remap failed" << std::endl;
+        }
+
+        // Bitmap words are remapped a bit at a time
+        TestPerms ePerms = TestPerms::Read;
+        if (!TestPermsRemap::bRemap(0x3, ePerms)
+        ||  (ePerms != TestPerms::ReadWrite)
+        ||  !TestPermsRemap::bRemap(0x8005, ePerms)
+        ||  (ePerms != (TestPerms::Read | TestPerms::Exec | TestPerms::Locked))
+        ||  !TestPermsRemap::bRemap(0, ePerms)
+        ||  (ePerms != static_cast<TestPerms>(0))
+        ||  TestPermsRemap::bRemap(0x9, ePerms)
+        ||  TestPermsRemap::bRemap(0x10, ePerms))
+        {
+            std::wcout << L"Bitmap remap failed" << std::endl;
+        }
+
+        const unsigned int auOldPerms[4] = { 0x2, 0x8, 0x8004, 0x10 };
+        unsigned int auNewPerms[4] = {};
+        if ((TestPermsRemap::szRemap(auOldPerms, 4, auNewPerms, 0xFFFFFFFF) != 2)
+        ||  (auNewPerms[0] != 0x4)
+        ||  (auNewPerms[1] != 0xFFFFFFFF)
+        ||  (auNewPerms[2] != 0x40000040)
+        ||  (auNewPerms[3] != 0xFFFFFFFF))
+        {
+            std::wcout << L"Bulk bitmap remap failed" << std::endl;
+        }
+
+        // Enough to go through the vector loops plus a tail, with some bad ones
+        std::vector<int> viOld;
+        for (int iIndex = 0; iIndex < 37; iIndex++)
+        {
+            viOld.push_back((iIndex % 7) - 1);
+        }
+        std::vector<int> viNew(viOld.size());
+        const size_t szBad = TestEnumRemap::szRemap(viOld.data(), viOld.size(), viNew.data(), -1);
+        size_t szExpBad = 0;
+        for (size_t szIndex = 0; szIndex < viOld.size(); szIndex++)
+        {
+            const int aiExp[4] = { 2, 0, -1, 1 };
+            const int iExp = ((viOld[szIndex] >= 0) && (viOld[szIndex] < 4)) ? aiExp[viOld[szIndex]] : -1;
+            if (iExp == -1)
+            {
+                szExpBad++;
+            }
+            if (viNew[szIndex] != iExp)
+            {
+                std::wcout << L"Bulk remap got the wrong value at " << szIndex << std::endl;
+                break;
+            }
+        }
+        if (szBad != szExpBad)
+        {
+            std::wcout << L"Bulk remap got the wrong bad count" << std::endl;
+        }
+
+        // In place, with byte values, which can use the shuffle
+        const uint8_t auTable[3] = { 2, 9, 0 };
+        std::vector<uint8_t> vuVals;
+        for (uint32_t uIndex = 0; uIndex < 41; uIndex++)
+        {
+            vuVals.push_back(static_cast<uint8_t>((uIndex * 37) % 5));
+        }
+        const std::vector<uint8_t> vuOrg = vuVals;
+        const size_t szByteBad = CQSL::CQEnum::szRemapValues<uint8_t>
+        (
+            vuVals.data(), vuVals.size(), vuVals.data(), auTable, 3, 9, 0xFF
+        );
+        size_t szByteExp = 0;
+        for (size_t szIndex = 0; szIndex < vuVals.size(); szIndex++)
+        {
+            const uint8_t uOrg = vuOrg[szIndex];
+            const uint8_t uExp = ((uOrg < 3) && (auTable[uOrg] != 9)) ? auTable[uOrg] : 0xFF;
+            if (uExp == 0xFF)
+            {
+                szByteExp++;
+            }
+            if (vuVals[szIndex] != uExp)
+            {
+                std::wcout << L"Byte remap got the wrong value at " << szIndex << std::endl;
+                break;
+            }
+        }
+        if (szByteBad != szByteExp)
+        {
+            std::wcout << L"Byte remap got the wrong bad count" << std::endl;
+        }
+    }
+
+    // The static reflection registry
+    {
+        const CQSL::CQEnum::EnumDescriptor* pedescStd = CQSL::CQEnum::pFindEnumDescriptor("CQSL::Test::TestEnum");
+        if (!pedescStd)
+        {
+            std::wcout << L"TestEnum was not found in the registry" << std::endl;
+        }
+        else
+        {
+            int64_t iVal = 0;
+            if ((pedescStd->uCount != 3)
+            ||  (pedescStd->eKind != CQSL::CQEnum::EEnumKinds::Standard)
+            ||  (pedescStd->pfnValueAt(2) != 2)
+            ||  (std::wstring(pedescStd->pfnToName(1)) != L"Value2")
+            ||  !pedescStd->pfnFromName(L"value3", iVal)
+            ||  (iVal != 2)
+            ||  !pedescStd->pfnIsValid(0)
+            ||  pedescStd->pfnIsValid(3)
+            ||  (std::wstring(pedescStd->pfnToText1(0)) != L"The text for value 1"))
+            {
+                std::wcout << L"Wrong registry descriptor for TestEnum" << std::endl;
+            }
+        }
+
+        const CQSL::CQEnum::EnumDescriptor* pedescPerms = CQSL::CQEnum::pFindEnumDescriptor("CQSL::Test::TestPerms");
+        if (!pedescPerms
+        ||  (pedescPerms->pfnValueAt(4) != 0x40000000)
+        ||  pedescPerms->pfnToText1
+        ||  CQSL::CQEnum::pFindEnumDescriptor("CQSL::Test::NotAnEnum")
+        ||  CQSL::CQEnum::pFindEnumDescriptor("TestEnum"))
+        {
+            std::wcout << L"Wrong registry lookup results" << std::endl;
+        }
+
+        uint32_t uRegCount = 0;
+        CQSL::CQEnum::ForEachEnumDescriptor
+        (
+            [&uRegCount](const CQSL::CQEnum::EnumDescriptor&) { uRegCount++; }
+        );
+        if (uRegCount != 5)
+        {
+            std::wcout << L"Expected 5 enums in the registry, got " << uRegCount << std::endl;
+        }
+    }
+
     // Test inlined constants
     if (uTest != 10)
     {
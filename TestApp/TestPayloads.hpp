@@ -0,0 +1,18 @@
+#pragma once
+
+//
+//  Payload types for the tagged union test enum, included into the generated
+//  header via the Includes= line of the File block.
+//
+#include <cstdint>
+#include <string>
+
+namespace CQSL { namespace Test {
+
+struct ConnectInfo
+{
+    std::string     strHost;
+    uint16_t        uPort = 0;
+};
+
+}};